@@ -9,6 +9,7 @@ License: No restrictions, use this as you need.
 import argparse
 import json
 import os
+import struct
 import sys
 import subprocess
 
@@ -31,6 +32,7 @@ except ImportError:
         sys.stderr.write('%s [%s]\n' % (message, error_id))
     sys.exit(1)
 
+from array import array
 from xml.etree import ElementTree
 from fnmatch import fnmatch
 
@@ -207,7 +209,7 @@ class ValueType:
 
 
     def setId(self, IdMap):
-        self.typeScope = IdMap[self.typeScopeId]
+        self.typeScope = IdMap.get(self.typeScopeId)
 
     def isIntegral(self):
         return self.type in {'bool', 'char', 'short', 'int', 'long', 'long long'}
@@ -449,21 +451,21 @@ class Token:
         )
 
     def setId(self, IdMap):
-        self.scope = IdMap[self.scopeId]
-        self.link = IdMap[self.linkId]
-        self.variable = IdMap[self.variableId]
-        self.function = IdMap[self.functionId]
+        self.scope = IdMap.get(self.scopeId)
+        self.link = IdMap.get(self.linkId)
+        self.variable = IdMap.get(self.variableId)
+        self.function = IdMap.get(self.functionId)
         self.values = []
         self.impossible_values = []
-        if IdMap[self.valuesId]:
-            for v in IdMap[self.valuesId]:
+        if IdMap.get(self.valuesId):
+            for v in IdMap.get(self.valuesId):
                 if v.isImpossible():
                     self.impossible_values.append(v)
                 else:
                     self.values.append(v)
                 v.setId(IdMap)
-        self.typeScope = IdMap[self.typeScopeId]
-        self.astParent = IdMap[self.astParentId]
+        self.typeScope = IdMap.get(self.typeScopeId)
+        self.astParent = IdMap.get(self.astParentId)
         self.astOperand1 = IdMap[self.astOperand1Id]
         self.astOperand2 = IdMap[self.astOperand2Id]
         if self.valueType:
@@ -606,12 +608,12 @@ class Scope:
         )
 
     def setId(self, IdMap):
-        self.bodyStart = IdMap[self.bodyStartId]
-        self.bodyEnd = IdMap[self.bodyEndId]
-        self.nestedIn = IdMap[self.nestedInId]
+        self.bodyStart = IdMap.get(self.bodyStartId)
+        self.bodyEnd = IdMap.get(self.bodyEndId)
+        self.nestedIn = IdMap.get(self.nestedInId)
         if self.nestedIn:
             self.nestedIn.nestedList.append(self)
-        self.function = IdMap[self.functionId]
+        self.function = IdMap.get(self.functionId)
         for v in self.varlistId:
             value = IdMap.get(v)
             if value:
@@ -687,9 +689,9 @@ class Function:
 
     def setId(self, IdMap):
         for argnr, argid in self.argumentId.items():
-            self.argument[argnr] = IdMap[argid]
+            self.argument[argnr] = IdMap.get(argid)
         self.token = IdMap.get(self.tokenId, None)
-        self.tokenDef = IdMap[self.tokenDefId]
+        self.tokenDef = IdMap.get(self.tokenDefId)
 
 
 #todo add class Types:
@@ -781,10 +783,10 @@ class Variable:
         )
 
     def setId(self, IdMap):
-        self.nameToken = IdMap[self.nameTokenId]
-        self.typeStartToken = IdMap[self.typeStartTokenId]
-        self.typeEndToken = IdMap[self.typeEndTokenId]
-        self.scope = IdMap[self.scopeId]
+        self.nameToken = IdMap.get(self.nameTokenId)
+        self.typeStartToken = IdMap.get(self.typeStartTokenId)
+        self.typeEndToken = IdMap.get(self.typeEndTokenId)
+        self.scope = IdMap.get(self.scopeId)
 
 class Container:
     """
@@ -1174,6 +1176,62 @@ class Standards:
         )
 
 
+# The first bytes of a dump file that is written with --dump-format=binary
+BINARY_DUMP_MAGIC = b'cppcheck-dump 1\n'
+_BINARY_DUMP_HEADER = struct.Struct('<5I')
+_BINARY_DUMP_TYPECODES = {array(typecode).itemsize: typecode for typecode in ('L', 'I', 'H')}
+
+
+def _iterparse_binary(f):
+    """
+    Read the elements of a binary dump file, see lib/binarydump.h for the format.
+    """
+    stack = []
+    while True:
+        header = f.read(_BINARY_DUMP_HEADER.size)
+        if not header:
+            break
+        width, _, strings_size, elements_count, attributes_count = _BINARY_DUMP_HEADER.unpack(header)
+        strings = f.read(strings_size).decode('utf-8').split('\0')
+        elements = array(_BINARY_DUMP_TYPECODES[width])
+        elements.frombytes(f.read(width * elements_count))
+        attributes = array(_BINARY_DUMP_TYPECODES[width])
+        attributes.frombytes(f.read(width * attributes_count))
+        if sys.byteorder == 'big':
+            elements.byteswap()
+            attributes.byteswap()
+
+        tags = [None] + strings
+        names = [strings[i] for i in attributes[0::2]]
+        values = [strings[i] for i in attributes[1::2]]
+        attribute = 0
+        items = iter(elements)
+        for item in items:
+            if item == 0:
+                yield 'end', stack.pop()
+                continue
+            end = attribute + next(items)
+            node = ElementTree.Element(tags[item], dict(zip(names[attribute:end], values[attribute:end])))
+            attribute = end
+            if stack:
+                stack[-1].append(node)
+            stack.append(node)
+            yield 'start', node
+
+
+def _iterparse(filename):
+    """
+    Iterate over the elements of a XML or binary dump file like ElementTree.iterparse() with the events 'start' and 'end'.
+    """
+    with open(filename, 'rb') as f:
+        if f.read(len(BINARY_DUMP_MAGIC)) == BINARY_DUMP_MAGIC:
+            for event, node in _iterparse_binary(f):
+                yield event, node
+            return
+    for event, node in ElementTree.iterparse(filename, events=('start', 'end')):
+        yield event, node
+
+
 class CppcheckData:
     """
     Class that makes cppcheck dump data available
@@ -1230,9 +1288,12 @@ class CppcheckData:
         # Parse general configuration options from <dumps> node
         # We intentionally don't clean node resources here because we
         # want to serialize in memory only small part of the XML tree.
-        for event, node in ElementTree.iterparse(self.filename, events=('start', 'end')):
+        for event, node in _iterparse(self.filename):
             if platform_done and rawtokens_done and suppressions_done:
                 break
+            # The sections that are not used by the addons are not dumped
+            if node.tag == 'dump':
+                break
             if node.tag == 'platform' and event == 'start':
                 self.platform = Platform(node)
                 platform_done = True
@@ -1287,7 +1348,7 @@ class CppcheckData:
         # Use iterable objects to traverse XML tree for dump files incrementally.
         # Iterative approach is required to avoid large memory consumption.
         # Calling .clear() is necessary to let the element be garbage collected.
-        for event, node in ElementTree.iterparse(self.filename, events=('start', 'end')):
+        for event, node in _iterparse(self.filename):
             # Serialize new configuration node
             if node.tag == 'dump':
                 if event == 'start':
@@ -1,12 +1,60 @@
-import cppcheckdata, cppcheck, runpy, sys, os
+import cppcheckdata, cppcheck, runpy, sys, os, io
 
-if __name__ == '__main__':
-    addon = sys.argv[1]
-    __addon_name__ = os.path.splitext(os.path.basename(addon))[0]
-    sys.argv.pop(0)
 
+def run_addon(addon):
     runpy.run_path(addon, run_name='__main__')
 
     # Run registered checkers
     cppcheck.runcheckers()
-    sys.exit(cppcheckdata.EXIT_CODE)
\ No newline at end of file
+    return cppcheckdata.EXIT_CODE
+
+
+def serve():
+    # Run the addons requested by Cppcheck (--addon-server). Each request is a line with
+    # the number of arguments followed by the arguments of the addon, one per line. The
+    # response is a line with the exit code and the size of the output in bytes followed
+    # by the output.
+    stdout, stderr = sys.stdout, sys.stderr
+    while True:
+        request = sys.stdin.readline()
+        if not request:
+            break
+        if not request.strip():
+            continue
+        sys.argv = [sys.stdin.readline().rstrip('\n') for _ in range(int(request))]
+        del cppcheck.__checkers__[:]
+        cppcheckdata.EXIT_CODE = 0
+        output = io.StringIO()
+        sys.stdout = sys.stderr = output
+        try:
+            exitcode = run_addon(sys.argv[0])
+        except SystemExit as e:
+            if e.code is None:
+                exitcode = 0
+            elif isinstance(e.code, int):
+                exitcode = e.code
+            else:
+                output.write(str(e.code) + '\n')
+                exitcode = 1
+        except Exception:
+            import traceback
+            traceback.print_exc(file=output)
+            exitcode = 1
+        finally:
+            sys.stdout, sys.stderr = stdout, stderr
+        data = output.getvalue().encode('utf-8')
+        stdout.buffer.write(('%d %d\n' % (exitcode, len(data))).encode('ascii'))
+        stdout.buffer.write(data)
+        stdout.flush()
+
+
+if __name__ == '__main__':
+    if len(sys.argv) == 2 and sys.argv[1] == '--server':
+        serve()
+        sys.exit(0)
+
+    addon = sys.argv[1]
+    __addon_name__ = os.path.splitext(os.path.basename(addon))[0]
+    sys.argv.pop(0)
+
+    sys.exit(run_addon(addon))
@@ -466,6 +466,14 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             else if (std::strncmp(argv[i],"--addon-python=", 15) == 0)
                 mSettings.addonPython.assign(argv[i]+15);
 
+            // Run the Python addons in a resident interpreter
+            else if (std::strcmp(argv[i], "--addon-server") == 0)
+                mSettings.addonServer = true;
+
+            // Share lexed headers between the checked files
+            else if (std::strcmp(argv[i], "--cache-headers") == 0)
+                mSettings.cacheHeaders = true;
+
             // Check configuration
             else if (std::strcmp(argv[i], "--check-config") == 0)
                 mSettings.checkConfiguration = true;
@@ -505,6 +513,17 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             else if (std::strncmp(argv[i], "--checkers-report=", 18) == 0)
                 mSettings.checkersReportFilename = argv[i] + 18;
 
+            else if (std::strncmp(argv[i], "--checks-jobs=", 14) == 0) {
+                unsigned int tmp;
+                if (!parseNumberArg(argv[i], 14, tmp))
+                    return Result::Fail;
+                if (tmp == 0) {
+                    mLogger.printError("argument for '--checks-jobs=' must be greater than 0.");
+                    return Result::Fail;
+                }
+                mSettings.checksJobs = tmp;
+            }
+
             else if (std::strncmp(argv[i], "--checks-max-time=", 18) == 0) {
                 if (!parseNumberArg(argv[i], 18, mSettings.checksMaxTime, true))
                     return Result::Fail;
@@ -519,6 +538,17 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
                 mSettings.clangExecutable = argv[i] + 8;
             }
 
+            else if (std::strncmp(argv[i], "--config-jobs=", 14) == 0) {
+                unsigned int tmp;
+                if (!parseNumberArg(argv[i], 14, tmp))
+                    return Result::Fail;
+                if (tmp == 0) {
+                    mLogger.printError("argument for '--config-jobs=' must be greater than 0.");
+                    return Result::Fail;
+                }
+                mSettings.configJobs = tmp;
+            }
+
             else if (std::strncmp(argv[i], "--config-exclude=",17) ==0) {
                 mSettings.configExcludePaths.insert(Path::fromNativeSeparators(argv[i] + 17));
             }
@@ -583,6 +613,18 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
             else if (std::strcmp(argv[i], "--dump") == 0)
                 mSettings.dump = true;
 
+            else if (std::strncmp(argv[i], "--dump-format=", 14) == 0) {
+                const std::string format = argv[i] + 14;
+                if (format == "xml")
+                    mSettings.dumpFormat = Settings::DumpFormat::Xml;
+                else if (format == "binary")
+                    mSettings.dumpFormat = Settings::DumpFormat::Binary;
+                else {
+                    mLogger.printError("unknown dump format: '" + format + "'.");
+                    return Result::Fail;
+                }
+            }
+
             else if (std::strncmp(argv[i], "--enable=", 9) == 0) {
                 const std::string enable_arg = argv[i] + 9;
                 const std::string errmsg = mSettings.addEnabled(enable_arg);
@@ -697,6 +739,14 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
                 }
             }
 
+            else if (std::strncmp(argv[i], "--file-statistics=", 18) == 0) {
+                mSettings.fileStatistics = Path::simplifyPath(argv[i] + 18);
+                if (mSettings.fileStatistics.empty()) {
+                    mLogger.printError("no file name specified for '--file-statistics'.");
+                    return Result::Fail;
+                }
+            }
+
             // file list specified
             else if (std::strncmp(argv[i], "--file-list=", 12) == 0) {
                 // open this file and read every input file (1 file name per line)
@@ -922,6 +972,14 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
                     return Result::Fail;
             }
 
+            // Limit the memory of the ValueFlow analysis of a translation unit (MiB)
+            else if (std::strncmp(argv[i], "--performance-valueflow-max-memory=", 35) == 0) {
+                std::size_t maxMemory = 0;
+                if (!parseNumberArg(argv[i], 35, maxMemory))
+                    return Result::Fail;
+                mSettings.vfOptions.maxMemory = maxMemory * 1024 * 1024;
+            }
+
             // Specify platform
             else if (std::strncmp(argv[i], "--platform=", 11) == 0) {
                 const std::string platform(11+argv[i]);
@@ -1223,6 +1281,16 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
                     mSettings.showtime = SHOWTIME_MODES::SHOWTIME_TOP5_FILE;
                 else if (showtimeMode == "top5_summary")
                     mSettings.showtime = SHOWTIME_MODES::SHOWTIME_TOP5_SUMMARY;
+                else if (showtimeMode == "trace")
+                    mSettings.showtime = SHOWTIME_MODES::SHOWTIME_TRACE;
+                else if (startsWith(showtimeMode, "trace:")) {
+                    mSettings.showtime = SHOWTIME_MODES::SHOWTIME_TRACE;
+                    mSettings.showtimeTraceFile = Path::simplifyPath(showtimeMode.substr(6));
+                    if (mSettings.showtimeTraceFile.empty()) {
+                        mLogger.printError("no file name specified for '--showtime=trace:'.");
+                        return Result::Fail;
+                    }
+                }
                 else if (showtimeMode == "none")
                     mSettings.showtime = SHOWTIME_MODES::SHOWTIME_NONE;
                 else if (showtimeMode.empty()) {
@@ -1230,7 +1298,7 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
                     return Result::Fail;
                 }
                 else {
-                    mLogger.printError("unrecognized --showtime mode: '" + showtimeMode + "'. Supported modes: file, file-total, summary, top5, top5_file, top5_summary.");
+                    mLogger.printError("unrecognized --showtime mode: '" + showtimeMode + "'. Supported modes: file, file-total, summary, top5, top5_file, top5_summary, trace, trace:<file>.");
                     return Result::Fail;
                 }
             }
@@ -1341,6 +1409,17 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
                     return Result::Fail;
             }
 
+            else if (std::strncmp(argv[i], "--valueflow-jobs=", 17) == 0) {
+                unsigned int tmp;
+                if (!parseNumberArg(argv[i], 17, tmp))
+                    return Result::Fail;
+                if (tmp == 0) {
+                    mLogger.printError("argument for '--valueflow-jobs=' must be greater than 0.");
+                    return Result::Fail;
+                }
+                mSettings.vfOptions.jobs = tmp;
+            }
+
             else if (std::strncmp(argv[i], "--valueflow-max-iterations=", 27) == 0) {
                 if (!parseNumberArg(argv[i], 27, mSettings.vfOptions.maxIterations))
                     return Result::Fail;
@@ -1393,6 +1472,12 @@ CmdLineParser::Result CmdLineParser::parseFromArgs(int argc, const char* const a
     if (!executorAuto && mSettings.useSingleJob())
         mLogger.printMessage("'--executor' has no effect as only a single job will be used.");
 
+#if defined(HAS_THREADING_MODEL_THREAD)
+    // the processes of the process executor only check a single file so they cannot share an addon server
+    if (executorAuto && mSettings.addonServer)
+        mSettings.executor = Settings::ExecutorType::Thread;
+#endif
+
     // Default template format..
     if (mSettings.templateFormat.empty()) {
         mSettings.templateFormat = "{bold}{file}:{line}:{column}: {red}{inconclusive:{magenta}}{severity}:{inconclusive: inconclusive:}{default} {message} [{id}]{reset}\\n{code}";
@@ -1475,6 +1560,13 @@ void CmdLineParser::printHelp() const
         "                         addon json files or through this command line option.\n"
         "                         If not present, Cppcheck will try \"python3\" first and\n"
         "                         then \"python\".\n"
+        "    --addon-server       Start one Python interpreter per thread that runs the\n"
+        "                         addons for all files instead of starting Python for\n"
+        "                         each addon and file. Uses the thread executor unless\n"
+        "                         --executor is given. Not available on Windows.\n"
+        "    --cache-headers      Lex each included file only once and reuse the tokens\n"
+        "                         for all files that include it. Uses more memory. The\n"
+        "                         cache hits are shown by --showtime.\n"
         "    --cppcheck-build-dir=<dir>\n"
         "                         Cppcheck work folder. Advantages:\n"
         "                          * whole program analysis\n"
@@ -1495,6 +1587,11 @@ void CmdLineParser::printHelp() const
         "                         incomplete info.\n"
         "    --checkers-report=<file>\n"
         "                         Write a report of all the active checkers to the given file.\n"
+        "    --checks-jobs=<n>    Run the checks of a single translation unit in <n>\n"
+        "                         threads. The findings are reported in the same order\n"
+        "                         as with a single thread. The whole program analysis\n"
+        "                         uses <n> threads too when it runs after a single job,\n"
+        "                         otherwise it uses the -j threads. Default is 1.\n"
         "    --clang=<path>       Experimental: Use Clang parser instead of the builtin Cppcheck\n"
         "                         parser. Takes the executable as optional parameter and\n"
         "                         defaults to `clang`. Cppcheck will run the given Clang\n"
@@ -1509,12 +1606,22 @@ void CmdLineParser::printHelp() const
         "                         be considered for evaluation.\n"
         "    --config-excludes-file=<file>\n"
         "                         A file that contains a list of config-excludes\n"
+        "    --config-jobs=<n>    Check up to <n> preprocessor configurations of a single\n"
+        "                         file in parallel. The output is the same as when the\n"
+        "                         configurations are checked one after another. Default\n"
+        "                         is 1.\n"
         "    --disable=<id>       Disable individual checks.\n"
         "                         Please refer to the documentation of --enable=<id>\n"
         "                         for further details.\n"
         "    --dump               Dump xml data for each translation unit. The dump\n"
         "                         files have the extension .dump and contain ast,\n"
         "                         tokenlist, symboldatabase, valueflow.\n"
+        "    --dump-format=<format>\n"
+        "                         Format of the dump files that are written for --dump\n"
+        "                         and for the addons:\n"
+        "                          * xml: XML (default)\n"
+        "                          * binary: compact format that is smaller and faster\n"
+        "                            to read. cppcheckdata.py reads both formats.\n"
         "    -D<ID>               Define preprocessor symbol. Unless --max-configs or\n"
         "                         --force is used, Cppcheck will only check the given\n"
         "                         configuration when -D is used.\n"
@@ -1562,6 +1669,12 @@ void CmdLineParser::printHelp() const
         "    --file-list=<file>   Specify the files to check in a text file. Add one\n"
         "                         filename per line. When file is '-,' the file list will\n"
         "                         be read from standard input.\n"
+        "    --file-statistics=<file>\n"
+        "                         Write statistics of each checked file and configuration\n"
+        "                         to the file: token, scope, function and ValueFlow value\n"
+        "                         counts, growth of the peak memory usage and the time in\n"
+        "                         the simplification and in the checks. The file is\n"
+        "                         written in JSON format if it ends with '.json'.\n"
         "    -f, --force          Force checking of all configurations in files. If used\n"
         "                         together with '--max-configs=', the last option is the\n"
         "                         one that is effective.\n"
@@ -1615,6 +1728,12 @@ void CmdLineParser::printHelp() const
         "                         is 2. A larger value will mean more errors can be found\n"
         "                         but also means the analysis will be slower.\n"
         "    --output-file=<file> Write results to file, rather than standard error.\n"
+        "    --performance-valueflow-max-memory=<MiB>\n"
+        "                         Memory budget for the tokens, ValueFlow values and\n"
+        "                         symbol database of each translation unit. When it is\n"
+        "                         exceeded the possible values are dropped and then the\n"
+        "                         extended ValueFlow analysis is skipped. Default is '0'\n"
+        "                         (no limit).\n"
         "    --platform=<type>, --platform=<file>\n"
         "                         Specifies platform specific types and sizes. The\n"
         "                         available builtin platforms are:\n"
@@ -1693,7 +1812,9 @@ void CmdLineParser::printHelp() const
         "    --rule=<rule>        Match regular expression.\n"
         "    --rule-file=<file>   Use given rule file. For more information, see:\n"
         "                         http://sourceforge.net/projects/cppcheck/files/Articles/\n"
-        "    --showtime=<mode>    Show timing information.\n"
+        "    --showtime=<mode>    Show timing information. The CPU time of the\n"
+        "                         threads that did the work and the elapsed (wall)\n"
+        "                         time are shown.\n"
         "                         The available modes are:\n"
         "                          * none\n"
         "                                 Show nothing (default)\n"
@@ -1709,6 +1830,13 @@ void CmdLineParser::printHelp() const
         "                                 Show the top 5 summary at the end\n"
         "                          * top5\n"
         "                                 Alias for top5_file (deprecated)\n"
+        "                          * trace\n"
+        "                                 Write the timeline of the files, configurations\n"
+        "                                 and analysis steps of each thread to the Chrome\n"
+        "                                 trace file cppcheck-trace.json in the build dir\n"
+        "                                 or else in the current dir\n"
+        "                          * trace:<file>\n"
+        "                                 Write the Chrome trace to the given file\n"
         "    --std=<id>           Set standard.\n"
         "                         The available options are:\n"
         "                          * c89\n"
@@ -1778,6 +1906,9 @@ void CmdLineParser::printHelp() const
         "    -U<ID>               Undefine preprocessor symbol. Use -U to explicitly\n"
         "                         hide certain #ifdef <ID> code paths from checking.\n"
         "                         Example: '-UDEBUG'\n"
+        "    --valueflow-jobs=<n> Run the ValueFlow analysis of functions which do not\n"
+        "                         call each other in <n> threads. The results are the\n"
+        "                         same as with a single thread. Default is 1.\n"
         "    -v, --verbose        Output more detailed error information.\n"
         "                         Note that this option is not mutually exclusive with --quiet.\n"
         "    --version            Print out version number.\n"
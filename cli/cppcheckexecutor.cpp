@@ -48,6 +48,8 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
+#include <memory>
 #include <set>
 #include <sstream>
 #include <unordered_set>
@@ -70,6 +72,16 @@
 #include <sys/wait.h> // WIFEXITED and friends
 #endif
 
+#if defined(HAS_THREADING_MODEL_FORK)
+#include <csignal>
+#include <fcntl.h>
+#include <spawn.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+extern char **environ;
+#endif
+
 namespace {
     class CmdLineLoggerStd : public CmdLineLogger
     {
@@ -174,6 +186,189 @@ namespace {
          */
         std::string mCriticalErrors;
     };
+
+#if defined(HAS_THREADING_MODEL_FORK)
+    /**
+     * A resident "runaddon.py --server" that runs the addons of one thread
+     * (--addon-server). The requests are written to its stdin and the
+     * responses are read from its stdout.
+     */
+    class AddonWorker
+    {
+    public:
+        AddonWorker(std::string exe, std::string runScript)
+            : mExe(std::move(exe)), mRunScript(std::move(runScript))
+        {}
+
+        ~AddonWorker() {
+            stop(false);
+        }
+
+        AddonWorker(const AddonWorker &) = delete;
+        AddonWorker& operator=(const AddonWorker &) = delete;
+
+        /**
+         * Run the addon.
+         * @param args arguments of the addon, the first one is the addon script
+         * @param output output of the addon, stdout and stderr
+         * @param exitcode exitcode of the addon
+         * @return false if the worker could not run the addon
+         */
+        bool run(const std::vector<std::string> &args, std::string &output, int &exitcode)
+        {
+            if (mBroken)
+                return false;
+            // a forked ProcessExecutor child must not talk to the worker of its parent
+            if (mFd >= 0 && mOwner != getpid()) {
+                close(mFd);
+                mFd = -1;
+                mPid = -1;
+            }
+            if (mFd < 0 && !start()) {
+                mBroken = true;
+                return false;
+            }
+
+            std::string request = std::to_string(args.size()) + "\n";
+            for (const std::string &arg : args)
+                request += arg + "\n";
+
+            std::string header;
+            if (!writeAll(request) || !readLine(header)) {
+                stop(true);
+                mBroken = true;
+                return false;
+            }
+            std::istringstream istr(header);
+            std::size_t size = 0;
+            if (!(istr >> exitcode >> size) || !readBytes(size, output)) {
+                stop(true);
+                mBroken = true;
+                return false;
+            }
+            return true;
+        }
+
+    private:
+        bool start()
+        {
+            // No process started by another thread may inherit an end of the socket. A worker would
+            // not see the end of its input or the parent would not see the end of a crashed worker.
+            // The dup2() of the spawn clears the flag on the standard input and output of the worker.
+            int fds[2];
+#ifdef SOCK_CLOEXEC
+            if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0)
+                return false;
+#else
+            // there is a small window in which the ends can be inherited
+            if (socketpair(AF_UNIX, SOCK_STREAM, 0, fds) != 0)
+                return false;
+            fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+            fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+#endif
+
+            posix_spawn_file_actions_t actions;
+            posix_spawn_file_actions_init(&actions);
+            posix_spawn_file_actions_adddup2(&actions, fds[1], STDIN_FILENO);
+            posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+            posix_spawn_file_actions_addclose(&actions, fds[1]);
+            posix_spawn_file_actions_addopen(&actions, STDERR_FILENO, "/dev/null", O_WRONLY, 0);
+
+            std::string exe = mExe;
+            if (exe.size() > 2 && exe.front() == '\"' && exe.back() == '\"')
+                exe = exe.substr(1, exe.size() - 2);
+            const std::string server = "--server";
+            char * const argv[] = { const_cast<char*>(exe.c_str()), const_cast<char*>(mRunScript.c_str()), const_cast<char*>(server.c_str()), nullptr };
+
+            pid_t pid;
+            const int res = posix_spawnp(&pid, exe.c_str(), &actions, nullptr, argv, environ);
+            posix_spawn_file_actions_destroy(&actions);
+            close(fds[1]);
+            if (res != 0) {
+                close(fds[0]);
+                return false;
+            }
+            mFd = fds[0];
+            mPid = pid;
+            mOwner = getpid();
+            mBuffer.clear();
+            return true;
+        }
+
+        void stop(bool kill)
+        {
+            if (mFd < 0)
+                return;
+            if (mOwner == getpid()) {
+                if (kill)
+                    ::kill(mPid, SIGKILL);
+                // closing the input terminates the worker
+                close(mFd);
+                waitpid(mPid, nullptr, 0);
+            }
+            mFd = -1;
+            mPid = -1;
+        }
+
+        bool writeAll(const std::string &data) const
+        {
+#ifdef MSG_NOSIGNAL
+            const int flags = MSG_NOSIGNAL;
+#else
+            const int flags = 0;
+#endif
+            std::size_t pos = 0;
+            while (pos < data.size()) {
+                const ssize_t n = send(mFd, data.data() + pos, data.size() - pos, flags);
+                if (n <= 0)
+                    return false;
+                pos += n;
+            }
+            return true;
+        }
+
+        bool fill()
+        {
+            char buf[4096];
+            const ssize_t n = read(mFd, buf, sizeof(buf));
+            if (n <= 0)
+                return false;
+            mBuffer.append(buf, n);
+            return true;
+        }
+
+        bool readLine(std::string &line)
+        {
+            std::string::size_type pos;
+            while ((pos = mBuffer.find('\n')) == std::string::npos) {
+                if (!fill())
+                    return false;
+            }
+            line = mBuffer.substr(0, pos);
+            mBuffer.erase(0, pos + 1);
+            return true;
+        }
+
+        bool readBytes(std::size_t size, std::string &data)
+        {
+            while (mBuffer.size() < size) {
+                if (!fill())
+                    return false;
+            }
+            data = mBuffer.substr(0, size);
+            mBuffer.erase(0, size);
+            return true;
+        }
+
+        const std::string mExe;
+        const std::string mRunScript;
+        int mFd = -1;
+        pid_t mPid = -1;
+        pid_t mOwner = -1;
+        bool mBroken{};
+        std::string mBuffer;
+    };
+#endif
 }
 
 // TODO: do not directly write to stdout
@@ -268,7 +463,9 @@ int CppCheckExecutor::check_internal(const Settings& settings) const
     if (!settings.checkersReportFilename.empty())
         std::remove(settings.checkersReportFilename.c_str());
 
-    CppCheck cppcheck(stdLogger, true, executeCommand);
+    const CppCheck::ExecuteCmdFn executeCmd = settings.addonServer ? executeAddonServerCommand : executeCommand;
+
+    CppCheck cppcheck(stdLogger, true, executeCmd);
     cppcheck.settings() = settings; // this is a copy
     auto& suppressions = cppcheck.settings().supprs.nomsg;
 
@@ -280,13 +477,13 @@ int CppCheckExecutor::check_internal(const Settings& settings) const
     } else {
 #if defined(HAS_THREADING_MODEL_THREAD)
         if (settings.executor == Settings::ExecutorType::Thread) {
-            ThreadExecutor executor(mFiles, mFileSettings, settings, suppressions, stdLogger, CppCheckExecutor::executeCommand);
+            ThreadExecutor executor(mFiles, mFileSettings, settings, suppressions, stdLogger, executeCmd);
             returnValue = executor.check();
         }
 #endif
 #if defined(HAS_THREADING_MODEL_FORK)
         if (settings.executor == Settings::ExecutorType::Process) {
-            ProcessExecutor executor(mFiles, mFileSettings, settings, suppressions, stdLogger, CppCheckExecutor::executeCommand);
+            ProcessExecutor executor(mFiles, mFileSettings, settings, suppressions, stdLogger, executeCmd);
             returnValue = executor.check();
         }
 #endif
@@ -534,3 +731,22 @@ int CppCheckExecutor::executeCommand(std::string exe, std::vector<std::string> a
     return res;
 }
 
+// cppcheck-suppress passedByValueCallback - used as callback so we need to preserve the signature
+// NOLINTNEXTLINE(performance-unnecessary-value-param) - used as callback so we need to preserve the signature
+int CppCheckExecutor::executeAddonServerCommand(std::string exe, std::vector<std::string> args, std::string redirect, std::string &output_)
+{
+#if defined(HAS_THREADING_MODEL_FORK)
+    // python runaddon.py <addon> ... 2>&1
+    if (args.size() >= 2 && endsWith(args[0], "runaddon.py") && redirect == "2>&1") {
+        // one worker per thread and interpreter
+        thread_local std::map<std::string, std::unique_ptr<AddonWorker>> workers;
+        std::unique_ptr<AddonWorker> &worker = workers[exe + '\n' + args[0]];
+        if (!worker)
+            worker.reset(new AddonWorker(exe, args[0]));
+        int exitcode = 0;
+        if (worker->run(std::vector<std::string>(args.cbegin() + 1, args.cend()), output_, exitcode))
+            return exitcode;
+    }
+#endif
+    return executeCommand(std::move(exe), std::move(args), std::move(redirect), output_);
+}
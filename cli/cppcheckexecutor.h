@@ -78,6 +78,12 @@ private:
      */
     static int executeCommand(std::string exe, std::vector<std::string> args, std::string redirect, std::string &output_);
 
+    /**
+     * Same as executeCommand() but runs the Python addons in a resident
+     * runaddon.py per thread instead of starting Python for each file (--addon-server).
+     */
+    static int executeAddonServerCommand(std::string exe, std::vector<std::string> args, std::string redirect, std::string &output_);
+
 protected:
 
     static bool reportSuppressions(const Settings &settings, const SuppressionList& suppressions, bool unusedFunctionCheckEnabled, const std::list<FileWithDetails> &files, const std::list<FileSettings>& fileSettings, ErrorLogger& errorLogger);
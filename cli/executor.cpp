@@ -19,17 +19,24 @@
 #include "executor.h"
 
 #include "color.h"
+#include "cppcheck.h"
 #include "errorlogger.h"
+#include "filesettings.h"
+#include "filestatistics.h"
 #include "library.h"
+#include "path.h"
 #include "settings.h"
 #include "suppressions.h"
+#include "timer.h"
+#include "utils.h"
 
+#include <algorithm>
 #include <cassert>
+#include <fstream>
+#include <iterator>
 #include <sstream>
 #include <utility>
 
-struct FileSettings;
-
 Executor::Executor(const std::list<FileWithDetails> &files, const std::list<FileSettings>& fileSettings, const Settings &settings, SuppressionList &suppressions, ErrorLogger &errorLogger)
     : mFiles(files), mFileSettings(fileSettings), mSettings(settings), mSuppressions(suppressions), mErrorLogger(errorLogger)
 {
@@ -70,3 +77,124 @@ void Executor::reportStatus(std::size_t fileindex, std::size_t filecount, std::s
     }
 }
 
+
+static std::string getDurationsFileName(const std::string &buildDir)
+{
+    return Path::join(buildDir, "durations.txt");
+}
+
+std::map<std::string, std::size_t> Executor::readDurations(const std::string &buildDir)
+{
+    std::map<std::string, std::size_t> durations;
+    if (buildDir.empty())
+        return durations;
+
+    std::ifstream fin(getDurationsFileName(buildDir));
+    std::string line;
+    while (std::getline(fin, line)) {
+        // <milliseconds> <name>
+        const std::string::size_type pos = line.find(' ');
+        if (pos == std::string::npos)
+            continue;
+        std::size_t duration;
+        if (!strToInt(line.substr(0, pos), duration))
+            continue;
+        durations[line.substr(pos + 1)] = duration;
+    }
+    return durations;
+}
+
+void Executor::writeDurations(const std::map<std::string, std::size_t> &durations) const
+{
+    if (mSettings.buildDir.empty() || durations.empty())
+        return;
+
+    // keep the durations of the files which have not been checked this time
+    std::map<std::string, std::size_t> allDurations = readDurations(mSettings.buildDir);
+    for (const std::pair<const std::string, std::size_t> &duration : durations)
+        allDurations[duration.first] = duration.second;
+
+    std::ofstream fout(getDurationsFileName(mSettings.buildDir));
+    for (const std::pair<const std::string, std::size_t> &duration : allDurations)
+        fout << duration.second << ' ' << duration.first << '\n';
+}
+
+void Executor::writeTrace(const std::string &childTraceEvents) const
+{
+    if (mSettings.showtime != SHOWTIME_MODES::SHOWTIME_TRACE)
+        return;
+
+    std::string traceFile = mSettings.showtimeTraceFile;
+    if (traceFile.empty())
+        traceFile = Path::join(mSettings.buildDir, "cppcheck-trace.json");
+    std::ofstream fout(traceFile);
+    TimerResults::writeTrace(fout, CppCheck::getTraceEvents() + childTraceEvents);
+}
+
+void Executor::writeFileStatistics(std::vector<FileStatistics> childStatistics) const
+{
+    if (mSettings.fileStatistics.empty())
+        return;
+
+    std::vector<FileStatistics> statistics = CppCheck::getFileStatistics();
+    statistics.insert(statistics.end(), std::make_move_iterator(childStatistics.begin()), std::make_move_iterator(childStatistics.end()));
+    FileStatistics::sort(statistics);
+
+    std::ofstream fout(mSettings.fileStatistics);
+    if (!fout.is_open()) {
+        mErrorLogger.reportOut("Failed to write the file statistics to '" + mSettings.fileStatistics + "'", Color::FgRed);
+        return;
+    }
+    if (endsWith(mSettings.fileStatistics, ".json"))
+        fout << FileStatistics::toJson(statistics) << '\n';
+    else
+        FileStatistics::writeText(fout, statistics);
+}
+
+std::vector<Executor::ScheduledFile> Executor::scheduleFiles(const std::list<FileWithDetails> &files, const std::list<FileSettings> &fileSettings, const std::map<std::string, std::size_t> &durations)
+{
+    std::vector<ScheduledFile> scheduled;
+    scheduled.reserve(files.size() + fileSettings.size());
+    for (const FileWithDetails &file : files)
+        scheduled.push_back({&file, nullptr, file.path(), file.size()});
+    for (const FileSettings &fs : fileSettings)
+        scheduled.push_back({nullptr, &fs, fs.filename() + ' ' + fs.cfg, fs.file.size()});
+
+    // the duration of files without history is estimated from their size
+    double knownDuration = 0;
+    double knownSize = 0;
+    for (const ScheduledFile &f : scheduled) {
+        const auto it = durations.find(f.name);
+        if (it != durations.cend() && f.size > 0) {
+            knownDuration += it->second;
+            knownSize += f.size;
+        }
+    }
+    const double durationPerByte = (knownSize > 0) ? (knownDuration / knownSize) : 1.0;
+
+    std::vector<double> expected;
+    expected.reserve(scheduled.size());
+    for (const ScheduledFile &f : scheduled) {
+        const auto it = durations.find(f.name);
+        expected.push_back((it != durations.cend()) ? it->second : (f.size * durationPerByte));
+    }
+
+    // longest first - files with the same expectation are kept in the given order
+    std::vector<std::size_t> order(scheduled.size());
+    for (std::size_t i = 0; i < order.size(); ++i)
+        order[i] = i;
+    std::stable_sort(order.begin(), order.end(), [&expected](std::size_t i1, std::size_t i2) {
+        return expected[i1] > expected[i2];
+    });
+
+    std::vector<ScheduledFile> ret;
+    ret.reserve(scheduled.size());
+    for (const std::size_t i : order)
+        ret.push_back(std::move(scheduled[i]));
+    return ret;
+}
+
+std::vector<Executor::ScheduledFile> Executor::scheduleFiles() const
+{
+    return scheduleFiles(mFiles, mFileSettings, readDurations(mSettings.buildDir));
+}
@@ -19,11 +19,15 @@
 #ifndef EXECUTOR_H
 #define EXECUTOR_H
 
+#include "filestatistics.h"
+
 #include <cstddef>
 #include <list>
+#include <map>
 #include <mutex>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 class Settings;
 class ErrorLogger;
@@ -49,6 +53,30 @@ public:
 
     virtual unsigned int check() = 0;
 
+    /** @brief A file to check - either a file or file settings */
+    struct ScheduledFile {
+        const FileWithDetails *file;
+        const FileSettings *fs;
+        /** @brief name of the file, for file settings followed by the configuration */
+        std::string name;
+        std::size_t size;
+    };
+
+    /**
+     * @brief Get the order in which the files are checked.
+     * The files which are expected to take longest are checked first so the end of the
+     * analysis does not wait for a single large file. The expectation is based on the
+     * durations of the previous analysis and on the file sizes.
+     * @param files the files to check
+     * @param fileSettings the file settings to check
+     * @param durations durations of the previous analysis in milliseconds by file name
+     * @return the files in the order they should be checked
+     */
+    static std::vector<ScheduledFile> scheduleFiles(const std::list<FileWithDetails> &files, const std::list<FileSettings> &fileSettings, const std::map<std::string, std::size_t> &durations);
+
+    /** @brief Read the durations of the previous analysis from the build dir */
+    static std::map<std::string, std::size_t> readDurations(const std::string &buildDir);
+
     /**
      * Information about how many files have been checked
      *
@@ -67,6 +95,27 @@ protected:
      */
     bool hasToLog(const ErrorMessage &msg);
 
+    /** @brief Get the files in the order they should be checked */
+    std::vector<ScheduledFile> scheduleFiles() const;
+
+    /**
+     * @brief Store the durations of the checked files in the build dir for the next analysis
+     * @param durations durations in milliseconds by file name
+     */
+    void writeDurations(const std::map<std::string, std::size_t> &durations) const;
+
+    /**
+     * @brief Write the trace file for --showtime=trace
+     * @param childTraceEvents trace events of the child processes
+     */
+    void writeTrace(const std::string &childTraceEvents = "") const;
+
+    /**
+     * @brief Write the statistics of the checked files for --file-statistics
+     * @param childStatistics statistics of the child processes
+     */
+    void writeFileStatistics(std::vector<FileStatistics> childStatistics = {}) const;
+
     const std::list<FileWithDetails> &mFiles;
     const std::list<FileSettings>& mFileSettings;
     const Settings &mSettings;
@@ -25,28 +25,31 @@
 #include "errorlogger.h"
 #include "errortypes.h"
 #include "filesettings.h"
+#include "filestatistics.h"
 #include "settings.h"
 #include "suppressions.h"
 #include "timer.h"
 
 #include <algorithm>
+#include <array>
 #include <numeric>
 #include <cassert>
 #include <cerrno>
+#include <chrono>
 #include <csignal>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
+#include <iterator>
 #include <list>
 #include <map>
 #include <sstream>
-#include <sys/select.h>
-#include <sys/time.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 #include <utility>
+#include <vector>
 #include <fcntl.h>
 
 
@@ -55,14 +58,14 @@
 #endif
 
 #if defined(__linux__)
+#include <sys/epoll.h>
 #include <sys/prctl.h>
+#else
+#include <poll.h>
 #endif
 
 enum class Color : std::uint8_t;
 
-// NOLINTNEXTLINE(misc-unused-using-decls) - required for FD_ZERO
-using std::memset;
-
 
 ProcessExecutor::ProcessExecutor(const std::list<FileWithDetails> &files, const std::list<FileSettings>& fileSettings, const Settings &settings, SuppressionList &suppressions, ErrorLogger &errorLogger, CppCheck::ExecuteCmdFn executeCommand)
     : Executor(files, fileSettings, settings, suppressions, errorLogger)
@@ -74,7 +77,7 @@ ProcessExecutor::ProcessExecutor(const std::list<FileWithDetails> &files, const
 namespace {
     class PipeWriter : public ErrorLogger {
     public:
-        enum PipeSignal : std::uint8_t {REPORT_OUT='1',REPORT_ERROR='2', CHILD_END='5'};
+        enum PipeSignal : std::uint8_t {REPORT_OUT='1',REPORT_ERROR='2', REPORT_TRACE='3', REPORT_STATISTICS='4', CHILD_END='5', REPORT_REUSED='6'};
 
         explicit PipeWriter(int pipe) : mWpipe(pipe) {}
 
@@ -86,102 +89,171 @@ namespace {
             writeToPipe(REPORT_ERROR, msg.serialize());
         }
 
+        void writeTrace(const std::string& traceEvents) const {
+            writeToPipe(REPORT_TRACE, traceEvents);
+        }
+
+        void writeStatistics(const std::string& statistics) const {
+            writeToPipe(REPORT_STATISTICS, statistics);
+        }
+
+        void writeReused() const {
+            writeToPipe(REPORT_REUSED, "");
+        }
+
         void writeEnd(const std::string& str) const {
             writeToPipe(CHILD_END, str);
         }
 
     private:
         // TODO: how to log file name in error?
-        void writeToPipeInternal(PipeSignal type, const void* data, std::size_t to_write) const
+        void writeToPipeInternal(PipeSignal type, const char* data, std::size_t to_write) const
         {
-            const ssize_t bytes_written = write(mWpipe, data, to_write);
-            if (bytes_written <= 0) {
-                const int err = errno;
-                std::cerr << "#### ThreadExecutor::writeToPipeInternal() error for type " << type << ": " << std::strerror(err) << std::endl;
-                std::exit(EXIT_FAILURE);
-            }
-            // TODO: write until everything is written
-            if (bytes_written != to_write) {
-                std::cerr << "#### ThreadExecutor::writeToPipeInternal() error for type " << type << ": insufficient data written (expected: " << to_write << " / got: " << bytes_written << ")" << std::endl;
-                std::exit(EXIT_FAILURE);
+            while (to_write > 0) {
+                const ssize_t bytes_written = write(mWpipe, data, to_write);
+                if (bytes_written < 0 && errno == EINTR)
+                    continue;
+                if (bytes_written <= 0) {
+                    const int err = errno;
+                    std::cerr << "#### ThreadExecutor::writeToPipeInternal() error for type " << type << ": " << std::strerror(err) << std::endl;
+                    std::exit(EXIT_FAILURE);
+                }
+                data += bytes_written;
+                to_write -= bytes_written;
             }
         }
 
+        // a message is the type, the length and the data - it is written with a single write()
         void writeToPipe(PipeSignal type, const std::string &data) const
         {
-            {
-                const auto t = static_cast<char>(type);
-                writeToPipeInternal(type, &t, 1);
+            const auto len = static_cast<unsigned int>(data.length());
+            std::string message;
+            message.reserve(1 + sizeof(len) + len);
+            message += static_cast<char>(type);
+            message.append(reinterpret_cast<const char*>(&len), sizeof(len));
+            message += data;
+            writeToPipeInternal(type, message.data(), message.size());
+        }
+
+        const int mWpipe;
+    };
+
+    /**
+     * Waits until the pipes of the child processes can be read. On Linux epoll is used so
+     * a wait does not need to pass and scan all the pipes.
+     */
+    class PipePoller {
+    public:
+        PipePoller() {
+#if defined(__linux__)
+            mEpoll = epoll_create1(EPOLL_CLOEXEC);
+            if (mEpoll < 0) {
+                std::cerr << "#### ThreadExecutor::check, epoll_create1() failed: "<< std::strerror(errno) << std::endl;
+                std::exit(EXIT_FAILURE);
             }
+#endif
+        }
 
-            const auto len = static_cast<unsigned int>(data.length());
-            {
-                static constexpr std::size_t l_size = sizeof(unsigned int);
-                writeToPipeInternal(type, &len, l_size);
+        ~PipePoller() {
+#if defined(__linux__)
+            close(mEpoll);
+#endif
+        }
+
+        PipePoller(const PipePoller &) = delete;
+        PipePoller& operator=(const PipePoller &) = delete;
+
+        void add(int rpipe) {
+#if defined(__linux__)
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.fd = rpipe;
+            if (epoll_ctl(mEpoll, EPOLL_CTL_ADD, rpipe, &event) < 0) {
+                std::cerr << "#### ThreadExecutor::check, epoll_ctl() failed: "<< std::strerror(errno) << std::endl;
+                std::exit(EXIT_FAILURE);
             }
+#endif
+            mPipes.push_back(rpipe);
+        }
 
-            writeToPipeInternal(type, data.c_str(), len);
+        // the pipe has to be removed before it is closed since the later children have a copy of it
+        void remove(int rpipe) {
+#if defined(__linux__)
+            epoll_ctl(mEpoll, EPOLL_CTL_DEL, rpipe, nullptr);
+#endif
+            mPipes.erase(std::find(mPipes.begin(), mPipes.end(), rpipe));
         }
 
-        const int mWpipe;
+        /** @return the pipes which can be read, empty if the timeout expired */
+        std::vector<int> wait(int timeoutMs) const {
+            std::vector<int> ready;
+#if defined(__linux__)
+            std::array<epoll_event, 64> events;
+            const int n = epoll_wait(mEpoll, events.data(), events.size(), timeoutMs);
+            for (int i = 0; i < n; ++i)
+                ready.push_back(events[i].data.fd);
+#else
+            std::vector<pollfd> fds;
+            fds.reserve(mPipes.size());
+            for (const int rpipe : mPipes)
+                fds.push_back({rpipe, POLLIN, 0});
+            if (poll(fds.data(), fds.size(), timeoutMs) > 0) {
+                for (const pollfd &fd : fds) {
+                    if (fd.revents != 0)
+                        ready.push_back(fd.fd);
+                }
+            }
+#endif
+            return ready;
+        }
+
+    private:
+#if defined(__linux__)
+        int mEpoll = -1;
+#endif
+        std::vector<int> mPipes;
     };
 }
 
-bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::string& filename)
+bool ProcessExecutor::handleRead(int rpipe, std::string &buffer, unsigned int &result, const std::string& filename)
 {
-    std::size_t bytes_to_read;
-    ssize_t bytes_read;
-
-    char type = 0;
-    bytes_to_read = sizeof(char);
-    bytes_read = read(rpipe, &type, bytes_to_read);
+    char data[64 * 1024];
+    const ssize_t bytes_read = read(rpipe, data, sizeof(data));
+    if (bytes_read < 0 && (errno == EAGAIN || errno == EINTR))
+        return true;
     if (bytes_read <= 0) {
-        if (errno == EAGAIN)
-            return true;
-
         // TODO: log details about failure
 
         // need to increment so a missing pipe (i.e. premature exit of forked process) results in an error exitcode
         ++result;
         return false;
     }
-    if (bytes_read != bytes_to_read) {
-        std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") error (type): insufficient data read (expected: " << bytes_to_read << " / got: " << bytes_read << ")" << std::endl;
-        std::exit(EXIT_FAILURE);
-    }
+    buffer.append(data, bytes_read);
 
-    if (type != PipeWriter::REPORT_OUT && type != PipeWriter::REPORT_ERROR && type != PipeWriter::CHILD_END) {
-        std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") invalid type " << int(type) << std::endl;
-        std::exit(EXIT_FAILURE);
+    // handle all complete messages, the rest is kept for the next read
+    static constexpr std::size_t header_size = 1 + sizeof(unsigned int);
+    std::string::size_type pos = 0;
+    bool res = true;
+    while (res && buffer.size() - pos >= header_size) {
+        const char type = buffer[pos];
+        unsigned int len = 0;
+        std::memcpy(&len, &buffer[pos + 1], sizeof(len));
+        if (buffer.size() - pos - header_size < len)
+            break;
+        res = handleMessage(type, buffer.substr(pos + header_size, len), result, filename);
+        pos += header_size + len;
     }
+    buffer.erase(0, pos);
+    return res;
+}
 
-    unsigned int len = 0;
-    bytes_to_read = sizeof(len);
-    bytes_read = read(rpipe, &len, bytes_to_read);
-    if (bytes_read <= 0) {
-        const int err = errno;
-        std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") error (len) for type " << int(type) << ": " << std::strerror(err) << std::endl;
-        std::exit(EXIT_FAILURE);
-    }
-    if (bytes_read != bytes_to_read) {
-        std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") error (len) for type" << int(type) << ": insufficient data read (expected: " << bytes_to_read << " / got: " << bytes_read << ")"  << std::endl;
+bool ProcessExecutor::handleMessage(char type, const std::string &buf, unsigned int &result, const std::string& filename)
+{
+    if (type != PipeWriter::REPORT_OUT && type != PipeWriter::REPORT_ERROR && type != PipeWriter::REPORT_TRACE && type != PipeWriter::REPORT_STATISTICS && type != PipeWriter::REPORT_REUSED && type != PipeWriter::CHILD_END) {
+        std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") invalid type " << int(type) << std::endl;
         std::exit(EXIT_FAILURE);
     }
 
-    std::string buf(len, '\0');
-    char *data_start = &buf[0];
-    bytes_to_read = len;
-    do {
-        bytes_read = read(rpipe, data_start, bytes_to_read);
-        if (bytes_read <= 0) {
-            const int err = errno;
-            std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") error (buf) for type" << int(type) << ": " << std::strerror(err) << std::endl;
-            std::exit(EXIT_FAILURE);
-        }
-        bytes_to_read -= bytes_read;
-        data_start += bytes_read;
-    } while (bytes_to_read != 0);
-
     bool res = true;
     if (type == PipeWriter::REPORT_OUT) {
         // the first character is the color
@@ -199,6 +271,18 @@ bool ProcessExecutor::handleRead(int rpipe, unsigned int &result, const std::str
 
         if (hasToLog(msg))
             mErrorLogger.reportErr(msg);
+    } else if (type == PipeWriter::REPORT_TRACE) {
+        mTraceEvents += buf;
+    } else if (type == PipeWriter::REPORT_STATISTICS) {
+        try {
+            std::vector<FileStatistics> statistics = FileStatistics::fromJson(buf);
+            mFileStatistics.insert(mFileStatistics.end(), std::make_move_iterator(statistics.begin()), std::make_move_iterator(statistics.end()));
+        } catch (const InternalError& e) {
+            std::cerr << "#### ThreadExecutor::handleRead(" << filename << ") internal error: " << e.errorMessage << std::endl;
+            std::exit(EXIT_FAILURE);
+        }
+    } else if (type == PipeWriter::REPORT_REUSED) {
+        mReusedResults.insert(filename);
     } else if (type == PipeWriter::CHILD_END) {
         result += std::stoi(buf);
         res = false;
@@ -238,16 +322,21 @@ unsigned int ProcessExecutor::check()
         return v + p.size();
     });
 
-    std::list<int> rpipes;
+    PipePoller poller;
     std::map<pid_t, std::string> childFile;
-    std::map<int, std::string> pipeFile;
+    std::map<pid_t, std::chrono::steady_clock::time_point> childStart;
+    std::map<int, const ScheduledFile*> pipeFile;
+    // data of the pipes which is not a complete message yet
+    std::map<int, std::string> pipeBuffer;
+    std::map<std::string, std::size_t> durations;
     std::size_t processedsize = 0;
-    std::list<FileWithDetails>::const_iterator iFile = mFiles.cbegin();
-    std::list<FileSettings>::const_iterator iFileSettings = mFileSettings.cbegin();
+    // the files are scheduled longest first so whichever child slot becomes free takes the largest remaining one
+    const std::vector<ScheduledFile> schedule = scheduleFiles();
+    std::vector<ScheduledFile>::const_iterator iFile = schedule.cbegin();
     for (;;) {
         // Start a new child
         const size_t nchildren = childFile.size();
-        if ((iFile != mFiles.cend() || iFileSettings != mFileSettings.cend()) && nchildren < mSettings.jobs && checkLoadAverage(nchildren)) {
+        if (iFile != schedule.cend() && nchildren < mSettings.jobs && checkLoadAverage(nchildren)) {
             int pipes[2];
             if (pipe(pipes) == -1) {
                 std::cerr << "#### ThreadExecutor::check, pipe() failed: "<< std::strerror(errno) << std::endl;
@@ -281,112 +370,106 @@ unsigned int ProcessExecutor::check()
                 fileChecker.settings() = mSettings;
                 unsigned int resultOfCheck = 0;
 
-                if (iFileSettings != mFileSettings.end()) {
-                    resultOfCheck = fileChecker.check(*iFileSettings);
+                if (iFile->fs) {
+                    resultOfCheck = fileChecker.check(*iFile->fs);
                     if (fileChecker.settings().clangTidy)
-                        fileChecker.analyseClangTidy(*iFileSettings);
+                        fileChecker.analyseClangTidy(*iFile->fs);
                 } else {
                     // Read file from a file
-                    resultOfCheck = fileChecker.check(*iFile);
+                    resultOfCheck = fileChecker.check(*iFile->file);
                     // TODO: call analyseClangTidy()?
                 }
 
+                if (mSettings.showtime == SHOWTIME_MODES::SHOWTIME_TRACE)
+                    pipewriter.writeTrace(CppCheck::getTraceEvents());
+                if (!mSettings.fileStatistics.empty())
+                    pipewriter.writeStatistics(FileStatistics::toJson(CppCheck::getFileStatistics()));
+                if (fileChecker.reusedResults())
+                    pipewriter.writeReused();
                 pipewriter.writeEnd(std::to_string(resultOfCheck));
                 std::exit(EXIT_SUCCESS);
             }
 
             close(pipes[1]);
-            rpipes.push_back(pipes[0]);
-            if (iFileSettings != mFileSettings.end()) {
-                childFile[pid] = iFileSettings->filename() + ' ' + iFileSettings->cfg;
-                pipeFile[pipes[0]] = iFileSettings->filename() + ' ' + iFileSettings->cfg;
-                ++iFileSettings;
-            } else {
-                childFile[pid] = iFile->path();
-                pipeFile[pipes[0]] = iFile->path();
-                ++iFile;
-            }
+            poller.add(pipes[0]);
+            childFile[pid] = iFile->name;
+            childStart[pid] = std::chrono::steady_clock::now();
+            pipeFile[pipes[0]] = &(*iFile);
+            ++iFile;
+            // start the other children before waiting
+            continue;
         }
-        if (!rpipes.empty()) {
-            fd_set rfds;
-            FD_ZERO(&rfds);
-            for (std::list<int>::const_iterator rp = rpipes.cbegin(); rp != rpipes.cend(); ++rp)
-                FD_SET(*rp, &rfds);
-            timeval tv; // for every second polling of load average condition
-            tv.tv_sec = 1;
-            tv.tv_usec = 0;
-            const int r = select(*std::max_element(rpipes.cbegin(), rpipes.cend()) + 1, &rfds, nullptr, nullptr, &tv);
-
-            if (r > 0) {
-                std::list<int>::iterator rp = rpipes.begin();
-                while (rp != rpipes.end()) {
-                    if (FD_ISSET(*rp, &rfds)) {
-                        std::string name;
-                        const std::map<int, std::string>::iterator p = pipeFile.find(*rp);
-                        if (p != pipeFile.end()) {
-                            name = p->second;
-                        }
-                        const bool readRes = handleRead(*rp, result, name);
-                        if (!readRes) {
-                            std::size_t size = 0;
-                            if (p != pipeFile.end()) {
-                                pipeFile.erase(p);
-                                const auto fs = std::find_if(mFiles.cbegin(), mFiles.cend(), [&name](const FileWithDetails& entry) {
-                                    return entry.path() == name;
-                                });
-                                if (fs != mFiles.end()) {
-                                    size = fs->size();
-                                }
-                            }
-
-                            fileCount++;
-                            processedsize += size;
-                            if (!mSettings.quiet)
-                                Executor::reportStatus(fileCount, mFiles.size() + mFileSettings.size(), processedsize, totalfilesize);
-
-                            close(*rp);
-                            rp = rpipes.erase(rp);
-                        } else
-                            ++rp;
-                    } else
-                        ++rp;
+        if (!childFile.empty() || !pipeFile.empty()) {
+            // A child which has sent its results exits right away, it is waited for shortly so the
+            // next child can be started. Otherwise the load average condition is polled every second.
+            // A child may also be reaped before all of its results have been read.
+            const int timeoutMs = (childFile.size() > pipeFile.size()) ? 10 : 1000;
+            for (const int rpipe : poller.wait(timeoutMs)) {
+                const std::map<int, const ScheduledFile*>::iterator p = pipeFile.find(rpipe);
+                if (p == pipeFile.end())
+                    continue;
+                const bool readRes = handleRead(rpipe, pipeBuffer[rpipe], result, p->second->name);
+                if (!readRes) {
+                    std::size_t size = 0;
+                    if (p->second->file)
+                        size = p->second->size;
+                    pipeFile.erase(p);
+                    pipeBuffer.erase(rpipe);
+
+                    fileCount++;
+                    processedsize += size;
+                    if (!mSettings.quiet)
+                        Executor::reportStatus(fileCount, mFiles.size() + mFileSettings.size(), processedsize, totalfilesize);
+
+                    poller.remove(rpipe);
+                    close(rpipe);
                 }
             }
         }
-        if (!childFile.empty()) {
-            int stat = 0;
-            const pid_t child = waitpid(0, &stat, WNOHANG);
-            if (child > 0) {
-                std::string childname;
-                const std::map<pid_t, std::string>::iterator c = childFile.find(child);
-                if (c != childFile.end()) {
-                    childname = c->second;
-                    childFile.erase(c);
-                }
+        int stat = 0;
+        pid_t child;
+        while (!childFile.empty() && (child = waitpid(0, &stat, WNOHANG)) > 0) {
+            std::string childname;
+            const std::map<pid_t, std::string>::iterator c = childFile.find(child);
+            if (c != childFile.end()) {
+                childname = c->second;
+                childFile.erase(c);
+            }
+            const std::map<pid_t, std::chrono::steady_clock::time_point>::iterator start = childStart.find(child);
+            if (start != childStart.end()) {
+                durations[childname] = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start->second).count();
+                childStart.erase(start);
+            }
 
-                if (WIFEXITED(stat)) {
-                    const int exitstatus = WEXITSTATUS(stat);
-                    if (exitstatus != EXIT_SUCCESS) {
-                        std::ostringstream oss;
-                        oss << "Child process exited with " << exitstatus;
-                        reportInternalChildErr(childname, oss.str());
-                    }
-                } else if (WIFSIGNALED(stat)) {
+            if (WIFEXITED(stat)) {
+                const int exitstatus = WEXITSTATUS(stat);
+                if (exitstatus != EXIT_SUCCESS) {
                     std::ostringstream oss;
-                    oss << "Child process crashed with signal " << WTERMSIG(stat);
+                    oss << "Child process exited with " << exitstatus;
                     reportInternalChildErr(childname, oss.str());
                 }
+            } else if (WIFSIGNALED(stat)) {
+                std::ostringstream oss;
+                oss << "Child process crashed with signal " << WTERMSIG(stat);
+                reportInternalChildErr(childname, oss.str());
             }
         }
-        if (iFile == mFiles.end() && iFileSettings == mFileSettings.end() && rpipes.empty() && childFile.empty()) {
+        if (iFile == schedule.cend() && pipeFile.empty() && childFile.empty()) {
             // All done
             break;
         }
     }
 
+    // the reused results took no time, the durations of the previous analysis are kept
+    for (const std::string &name : mReusedResults)
+        durations.erase(name);
+    writeDurations(durations);
+
     // TODO: wee need to get the timing information from the subprocess
     if (mSettings.showtime == SHOWTIME_MODES::SHOWTIME_SUMMARY || mSettings.showtime == SHOWTIME_MODES::SHOWTIME_TOP5_SUMMARY)
-        CppCheck::printTimerResults(mSettings.showtime);
+        CppCheck::printTimerResults(mSettings.showtime, mErrorLogger);
+    writeTrace(mTraceEvents);
+    writeFileStatistics(std::move(mFileStatistics));
 
     return result;
 }
@@ -21,10 +21,13 @@
 
 #include "cppcheck.h"
 #include "executor.h"
+#include "filestatistics.h"
 
 #include <cstddef>
 #include <list>
+#include <set>
 #include <string>
+#include <vector>
 
 class Settings;
 class ErrorLogger;
@@ -49,10 +52,17 @@ public:
 
 private:
     /**
-     * Read from the pipe, parse and handle what ever is in there.
-     * @return False in case of an recoverable error - will exit process on others
+     * Read from the pipe and handle the complete messages.
+     * @param buffer data of the pipe which is not a complete message yet
+     * @return False when the child is done or in case of an recoverable error - will exit process on others
      */
-    bool handleRead(int rpipe, unsigned int &result, const std::string& filename);
+    bool handleRead(int rpipe, std::string &buffer, unsigned int &result, const std::string& filename);
+
+    /**
+     * Handle a message of a child.
+     * @return False when the child is done - will exit process on errors
+     */
+    bool handleMessage(char type, const std::string &buf, unsigned int &result, const std::string& filename);
 
     /**
      * @brief Check load average condition
@@ -68,6 +78,15 @@ private:
     void reportInternalChildErr(const std::string &childname, const std::string &msg);
 
     CppCheck::ExecuteCmdFn mExecuteCommand;
+
+    /** Trace events of the child processes for --showtime=trace */
+    std::string mTraceEvents;
+
+    /** Statistics of the child processes for --file-statistics */
+    std::vector<FileStatistics> mFileStatistics;
+
+    /** The files of which the child processes reused the results from the build dir */
+    std::set<std::string> mReusedResults;
 };
 
 /// @}
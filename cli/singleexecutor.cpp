@@ -73,7 +73,9 @@ unsigned int SingleExecutor::check()
         result++;
 
     if (mSettings.showtime == SHOWTIME_MODES::SHOWTIME_SUMMARY || mSettings.showtime == SHOWTIME_MODES::SHOWTIME_TOP5_SUMMARY)
-        CppCheck::printTimerResults(mSettings.showtime);
+        CppCheck::printTimerResults(mSettings.showtime, mErrorLogger);
+    writeTrace();
+    writeFileStatistics();
 
     return result;
 }
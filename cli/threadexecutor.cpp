@@ -25,12 +25,15 @@
 #include "settings.h"
 #include "timer.h"
 
+#include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <future>
 #include <iostream>
 #include <list>
+#include <map>
 #include <numeric>
 #include <mutex>
 #include <string>
@@ -82,39 +85,24 @@ private:
 class ThreadData
 {
 public:
-    ThreadData(ThreadExecutor &threadExecutor, ErrorLogger &errorLogger, const Settings &settings, const std::list<FileWithDetails> &files, const std::list<FileSettings> &fileSettings, CppCheck::ExecuteCmdFn executeCommand)
-        : mFiles(files), mFileSettings(fileSettings), mSettings(settings), mExecuteCommand(std::move(executeCommand)), logForwarder(threadExecutor, errorLogger)
+    ThreadData(ThreadExecutor &threadExecutor, ErrorLogger &errorLogger, const Settings &settings, std::vector<Executor::ScheduledFile> schedule, CppCheck::ExecuteCmdFn executeCommand)
+        : mSchedule(std::move(schedule)), mSettings(settings), mExecuteCommand(std::move(executeCommand)), logForwarder(threadExecutor, errorLogger)
     {
-        mItNextFile = mFiles.begin();
-        mItNextFileSettings = mFileSettings.begin();
-
-        mTotalFiles = mFiles.size() + mFileSettings.size();
-        mTotalFileSize = std::accumulate(mFiles.cbegin(), mFiles.cend(), std::size_t(0), [](std::size_t v, const FileWithDetails& p) {
-            return v + p.size();
+        mTotalFiles = mSchedule.size();
+        mTotalFileSize = std::accumulate(mSchedule.cbegin(), mSchedule.cend(), std::size_t(0), [](std::size_t v, const Executor::ScheduledFile& f) {
+            return f.file ? (v + f.size) : v;
         });
     }
 
-    bool next(const FileWithDetails *&file, const FileSettings *&fs, std::size_t &fileSize) {
-        std::lock_guard<std::mutex> l(mFileSync);
-        if (mItNextFile != mFiles.end()) {
-            file = &(*mItNextFile);
-            fs = nullptr;
-            fileSize = mItNextFile->size();
-            ++mItNextFile;
-            return true;
-        }
-        if (mItNextFileSettings != mFileSettings.end()) {
-            file = nullptr;
-            fs = &(*mItNextFileSettings);
-            fileSize = 0;
-            ++mItNextFileSettings;
-            return true;
-        }
-
-        return false;
+    // the files are scheduled longest first so whichever thread becomes idle takes the largest remaining one
+    const Executor::ScheduledFile *next() {
+        const std::size_t index = mNextFile++;
+        if (index >= mSchedule.size())
+            return nullptr;
+        return &mSchedule[index];
     }
 
-    unsigned int check(ErrorLogger &errorLogger, const FileWithDetails *file, const FileSettings *fs) const {
+    unsigned int check(ErrorLogger &errorLogger, const FileWithDetails *file, const FileSettings *fs, bool &reusedResults) const {
         CppCheck fileChecker(errorLogger, false, mExecuteCommand);
         fileChecker.settings() = mSettings; // this is a copy
 
@@ -129,22 +117,30 @@ public:
             result = fileChecker.check(*file);
             // TODO: call analyseClangTidy()?
         }
+        reusedResults = fileChecker.reusedResults();
         return result;
     }
 
-    void status(std::size_t fileSize) {
+    void status(const Executor::ScheduledFile &f, std::size_t duration, bool reusedResults) {
         std::lock_guard<std::mutex> l(mFileSync);
-        mProcessedSize += fileSize;
+        // the reused results took no time, the duration of the previous analysis is kept
+        if (!reusedResults)
+            mDurations[f.name] = duration;
+        if (f.file)
+            mProcessedSize += f.size;
         mProcessedFiles++;
         if (!mSettings.quiet)
             logForwarder.reportStatus(mProcessedFiles, mTotalFiles, mProcessedSize, mTotalFileSize);
     }
 
+    const std::map<std::string, std::size_t> &durations() const {
+        return mDurations;
+    }
+
 private:
-    const std::list<FileWithDetails> &mFiles;
-    std::list<FileWithDetails>::const_iterator mItNextFile;
-    const std::list<FileSettings> &mFileSettings;
-    std::list<FileSettings>::const_iterator mItNextFileSettings;
+    const std::vector<Executor::ScheduledFile> mSchedule;
+    std::atomic<std::size_t> mNextFile{};
+    std::map<std::string, std::size_t> mDurations;
 
     std::size_t mProcessedFiles{};
     std::size_t mTotalFiles{};
@@ -163,14 +159,13 @@ static unsigned int STDCALL threadProc(ThreadData *data)
 {
     unsigned int result = 0;
 
-    const FileWithDetails *file;
-    const FileSettings *fs;
-    std::size_t fileSize;
+    while (const Executor::ScheduledFile *f = data->next()) {
+        const auto start = std::chrono::steady_clock::now();
+        bool reusedResults = false;
+        result += data->check(data->logForwarder, f->file, f->fs, reusedResults);
+        const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
 
-    while (data->next(file, fs, fileSize)) {
-        result += data->check(data->logForwarder, file, fs);
-
-        data->status(fileSize);
+        data->status(*f, duration.count(), reusedResults);
     }
 
     return result;
@@ -181,7 +176,7 @@ unsigned int ThreadExecutor::check()
     std::vector<std::future<unsigned int>> threadFutures;
     threadFutures.reserve(mSettings.jobs);
 
-    ThreadData data(*this, mErrorLogger, mSettings, mFiles, mFileSettings, mExecuteCommand);
+    ThreadData data(*this, mErrorLogger, mSettings, scheduleFiles(), mExecuteCommand);
 
     for (unsigned int i = 0; i < mSettings.jobs; ++i) {
         try {
@@ -197,8 +192,12 @@ unsigned int ThreadExecutor::check()
         return v + f.get();
     });
 
+    writeDurations(data.durations());
+
     if (mSettings.showtime == SHOWTIME_MODES::SHOWTIME_SUMMARY || mSettings.showtime == SHOWTIME_MODES::SHOWTIME_TOP5_SUMMARY)
-        CppCheck::printTimerResults(mSettings.showtime);
+        CppCheck::printTimerResults(mSettings.showtime, mErrorLogger);
+    writeTrace();
+    writeFileStatistics();
 
     return result;
 }
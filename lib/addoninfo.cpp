@@ -84,6 +84,36 @@ static std::string parseAddonInfo(AddonInfo& addoninfo, const picojson::value &j
         }
     }
 
+    {
+        const auto it = obj.find("dump");
+        if (it != obj.cend()) {
+            const auto& val = it->second;
+            if (!val.is<picojson::array>())
+                return "Loading " + fileName + " failed. 'dump' must be an array.";
+            addoninfo.dumpSections = 0;
+            for (const picojson::value &v : val.get<picojson::array>()) {
+                if (!v.is<std::string>())
+                    return "Loading " + fileName + " failed. 'dump' entry is not a string.";
+                const std::string &section = v.get<std::string>();
+                if (section == "rawtokens")
+                    addoninfo.dumpSections |= AddonInfo::DumpRawTokens;
+                else if (section == "directives")
+                    addoninfo.dumpSections |= AddonInfo::DumpDirectives;
+                else if (section == "tokens")
+                    addoninfo.dumpSections |= AddonInfo::DumpTokens;
+                else if (section == "scopes")
+                    addoninfo.dumpSections |= AddonInfo::DumpScopes;
+                else if (section == "valueflow")
+                    addoninfo.dumpSections |= AddonInfo::DumpValueFlow;
+                else
+                    return "Loading " + fileName + " failed. Unknown 'dump' section '" + section + "'.";
+            }
+        }
+        else {
+            addoninfo.dumpSections = AddonInfo::DumpAll;
+        }
+    }
+
     {
         const auto it = obj.find("python");
         if (it != obj.cend()) {
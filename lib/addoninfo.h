@@ -21,15 +21,27 @@
 
 #include "config.h"
 
+#include <cstdint>
 #include <string>
 
 struct CPPCHECKLIB AddonInfo {
+    /** The sections of the dump file, an addon can list the ones it uses in its JSON ("dump") */
+    enum DumpSection : std::uint8_t {
+        DumpRawTokens = 1 << 0,
+        DumpDirectives = 1 << 1,
+        DumpTokens = 1 << 2,
+        DumpScopes = 1 << 3,
+        DumpValueFlow = 1 << 4,
+        DumpAll = DumpRawTokens | DumpDirectives | DumpTokens | DumpScopes | DumpValueFlow
+    };
+
     std::string name;
     std::string scriptFile; // addon script
     std::string executable; // addon executable
     std::string args;       // special extra arguments
     std::string python;     // script interpreter
     bool ctu = false;
+    std::uint8_t dumpSections = DumpAll;
     std::string runScript;
 
     std::string getAddonInfo(const std::string &fileName, const std::string &exename);
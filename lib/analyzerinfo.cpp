@@ -18,13 +18,32 @@
 
 #include "analyzerinfo.h"
 
+#include "binarystream.h"
+#include "check.h"
+#include "ctu.h"
 #include "errorlogger.h"
+#include "errortypes.h"
 #include "filesettings.h"
 #include "path.h"
+#include "preprocessor.h"
 #include "utils.h"
+#include "version.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
 #include <cstring>
+#include <future>
+#include <ios>
+#include <istream>
 #include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 #include "xml.h"
 
@@ -73,14 +92,84 @@ void AnalyzerInformation::close()
     }
 }
 
-static bool skipAnalysis(const std::string &analyzerInfoFile, std::size_t hash, std::list<ErrorMessage> &errors)
+static void getErrors(const tinyxml2::XMLElement *rootNode, std::list<ErrorMessage> &errors)
+{
+    for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
+        if (std::strcmp(e->Name(), "error") == 0)
+            errors.emplace_back(e);
+    }
+}
+
+static std::string getAttribute(const tinyxml2::XMLElement *e, const char *name)
+{
+    const char *attr = e->Attribute(name);
+    return attr ? attr : "";
+}
+
+static void getSuppressionsAndRemarks(const tinyxml2::XMLElement *rootNode, std::list<SuppressionList::Suppression> &suppressions, std::vector<RemarkComment> &remarkComments,
+                                      std::map<std::pair<std::string, int>, std::set<std::string>> &locationMacros)
+{
+    for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
+        if (std::strcmp(e->Name(), "inline-suppression") == 0) {
+            SuppressionList::Suppression s;
+            s.errorId = getAttribute(e, "errorId");
+            s.fileName = getAttribute(e, "fileName");
+            s.lineNumber = e->IntAttribute("lineNumber", SuppressionList::Suppression::NO_LINE);
+            s.lineBegin = e->IntAttribute("lineBegin", SuppressionList::Suppression::NO_LINE);
+            s.lineEnd = e->IntAttribute("lineEnd", SuppressionList::Suppression::NO_LINE);
+            s.type = static_cast<SuppressionList::Type>(e->UnsignedAttribute("type"));
+            s.symbolName = getAttribute(e, "symbolName");
+            s.macroName = getAttribute(e, "macroName");
+            s.hash = e->Unsigned64Attribute("hash");
+            s.thisAndNextLine = e->BoolAttribute("thisAndNextLine");
+            s.matched = e->BoolAttribute("matched");
+            s.checked = e->BoolAttribute("checked");
+            s.isInline = true;
+            suppressions.push_back(std::move(s));
+        } else if (std::strcmp(e->Name(), "remark") == 0) {
+            remarkComments.emplace_back(getAttribute(e, "file"), e->UnsignedAttribute("line"), getAttribute(e, "str"));
+        } else if (std::strcmp(e->Name(), "macros") == 0) {
+            std::set<std::string> &macroNames = locationMacros[{getAttribute(e, "file"), e->IntAttribute("line")}];
+            std::istringstream names(getAttribute(e, "names"));
+            std::string name;
+            while (names >> name)
+                macroNames.insert(name);
+        }
+    }
+}
+
+static std::string toString(const tinyxml2::XMLNode *node)
+{
+    tinyxml2::XMLPrinter printer(nullptr, true);
+    node->Accept(&printer);
+    return printer.CStr();
+}
+
+// the dependencies are updated when the file is unchanged but has been touched so the next run can skip it without preprocessing
+static void updateDependencies(const std::string &analyzerInfoFile, tinyxml2::XMLDocument &doc, tinyxml2::XMLElement *rootNode, const std::string &dependencies)
+{
+    tinyxml2::XMLDocument depsDoc;
+    if (depsDoc.Parse(dependencies.c_str()) != tinyxml2::XML_SUCCESS || !depsDoc.FirstChildElement())
+        return;
+
+    tinyxml2::XMLElement *oldNode = rootNode->FirstChildElement("dependencies");
+    if (oldNode) {
+        if (toString(oldNode) == toString(depsDoc.FirstChildElement()))
+            return;
+        rootNode->DeleteChild(oldNode);
+    }
+    rootNode->InsertFirstChild(depsDoc.FirstChildElement()->DeepClone(&doc));
+    doc.SaveFile(analyzerInfoFile.c_str());
+}
+
+static bool skipAnalysis(const std::string &analyzerInfoFile, std::size_t hash, std::list<ErrorMessage> &errors, const std::string &dependencies)
 {
     tinyxml2::XMLDocument doc;
     const tinyxml2::XMLError error = doc.LoadFile(analyzerInfoFile.c_str());
     if (error != tinyxml2::XML_SUCCESS)
         return false;
 
-    const tinyxml2::XMLElement * const rootNode = doc.FirstChildElement();
+    tinyxml2::XMLElement * const rootNode = doc.FirstChildElement();
     if (rootNode == nullptr)
         return false;
 
@@ -88,10 +177,10 @@ static bool skipAnalysis(const std::string &analyzerInfoFile, std::size_t hash,
     if (!attr || attr != std::to_string(hash))
         return false;
 
-    for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
-        if (std::strcmp(e->Name(), "error") == 0)
-            errors.emplace_back(e);
-    }
+    getErrors(rootNode, errors);
+
+    if (!dependencies.empty())
+        updateDependencies(analyzerInfoFile, doc, rootNode, dependencies);
 
     return true;
 }
@@ -136,13 +225,17 @@ bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::st
 
     mAnalyzerInfoFile = AnalyzerInformation::getAnalyzerInfoFile(buildDir,sourcefile,cfg);
 
-    if (skipAnalysis(mAnalyzerInfoFile, hash, errors))
+    const std::string dependencies = std::move(mDependencies);
+    mDependencies.clear();
+
+    if (skipAnalysis(mAnalyzerInfoFile, hash, errors, dependencies))
         return false;
 
     mOutputStream.open(mAnalyzerInfoFile);
     if (mOutputStream.is_open()) {
         mOutputStream << "<?xml version=\"1.0\"?>\n";
         mOutputStream << "<analyzerinfo hash=\"" << hash << "\">\n";
+        mOutputStream << dependencies;
     } else {
         mAnalyzerInfoFile.clear();
     }
@@ -150,10 +243,169 @@ bool AnalyzerInformation::analyzeFile(const std::string &buildDir, const std::st
     return true;
 }
 
-void AnalyzerInformation::reportErr(const ErrorMessage &msg)
+bool AnalyzerInformation::isUnchanged(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t settingsHash, std::list<ErrorMessage> &errors,
+                                      std::list<SuppressionList::Suppression> &suppressions, std::vector<RemarkComment> &remarkComments,
+                                      std::map<std::pair<std::string, int>, std::set<std::string>> &locationMacros)
 {
-    if (mOutputStream.is_open())
-        mOutputStream << msg.toXML() << '\n';
+    if (buildDir.empty() || sourcefile.empty())
+        return false;
+
+    const std::string analyzerInfoFile = AnalyzerInformation::getAnalyzerInfoFile(buildDir,sourcefile,cfg);
+
+    tinyxml2::XMLDocument doc;
+    if (doc.LoadFile(analyzerInfoFile.c_str()) != tinyxml2::XML_SUCCESS)
+        return false;
+
+    const tinyxml2::XMLElement * const rootNode = doc.FirstChildElement();
+    if (rootNode == nullptr)
+        return false;
+
+    const tinyxml2::XMLElement * const depsNode = rootNode->FirstChildElement("dependencies");
+    if (depsNode == nullptr)
+        return false;
+
+    const char *attr = depsNode->Attribute("hash");
+    if (!attr || attr != std::to_string(settingsHash))
+        return false;
+
+    // a header which was created in one of the directories shadows an included one
+    for (const tinyxml2::XMLElement *e = depsNode->FirstChildElement("dir"); e; e = e->NextSiblingElement("dir")) {
+        const char *name = e->Attribute("name");
+        if (!name)
+            return false;
+        std::uint64_t size;
+        std::uint64_t mtime;
+        const char *mtimeAttr = e->Attribute("mtime");
+        if (!Path::getFileStamp(name, size, mtime)) {
+            if (mtimeAttr)
+                return false;
+        } else if (!mtimeAttr || mtimeAttr != std::to_string(mtime)) {
+            return false;
+        }
+    }
+
+    bool hasFiles = false;
+    for (const tinyxml2::XMLElement *e = depsNode->FirstChildElement("file"); e; e = e->NextSiblingElement("file")) {
+        const char *name = e->Attribute("name");
+        std::uint64_t size;
+        std::uint64_t mtime;
+        if (!name || !Path::getFileStamp(name, size, mtime))
+            return false;
+        const char *sizeAttr = e->Attribute("size");
+        const char *mtimeAttr = e->Attribute("mtime");
+        if (!sizeAttr || sizeAttr != std::to_string(size) || !mtimeAttr || mtimeAttr != std::to_string(mtime))
+            return false;
+        hasFiles = true;
+    }
+    if (!hasFiles)
+        return false;
+
+    getErrors(rootNode, errors);
+    getSuppressionsAndRemarks(rootNode, suppressions, remarkComments, locationMacros);
+    return true;
+}
+
+// the directories which are searched before the included files are found
+static std::set<std::string> getSearchedDirs(const std::vector<std::string> &files, const std::list<std::string> &includePaths)
+{
+    std::set<std::string> dirs;
+
+    // quoted includes are searched in the directory of the including file first
+    for (const std::string &f : files) {
+        const std::string dir = Path::getPathFromFilename(f);
+        dirs.insert(dir.empty() ? "." : dir);
+    }
+
+    for (std::size_t i = 1; i < files.size(); ++i) {
+        const std::string &f = files[i];
+        std::vector<std::string> searched;
+        for (std::string includePath : includePaths) {
+            if (!endsWith(includePath, '/'))
+                includePath += '/';
+            if (startsWith(f, includePath)) {
+                // the include can be in a sub directory of the include paths
+                const std::string subdir = Path::getPathFromFilename(f.substr(includePath.size()));
+                for (const std::string &s : searched)
+                    dirs.insert(s + subdir);
+                break;
+            }
+            searched.push_back(std::move(includePath));
+        }
+    }
+    return dirs;
+}
+
+void AnalyzerInformation::setDependencies(std::size_t settingsHash, const std::vector<std::string> &files, const std::list<std::string> &includePaths)
+{
+    std::ostringstream ostr;
+    ostr << "  <dependencies hash=\"" << settingsHash << "\">\n";
+    for (const std::string &f : files) {
+        std::uint64_t size;
+        std::uint64_t mtime;
+        if (!Path::getFileStamp(f, size, mtime)) {
+            // the file can not be checked later - the TU will always be preprocessed
+            mDependencies.clear();
+            return;
+        }
+        ostr << "    <file name=\"" << ErrorLogger::toxml(f) << "\" size=\"" << size << "\" mtime=\"" << mtime << "\"/>\n";
+    }
+    for (const std::string &dir : getSearchedDirs(files, includePaths)) {
+        std::uint64_t size;
+        std::uint64_t mtime;
+        // a directory which does not exist is recorded without a modification time
+        if (Path::getFileStamp(dir, size, mtime))
+            ostr << "    <dir name=\"" << ErrorLogger::toxml(dir) << "\" mtime=\"" << mtime << "\"/>\n";
+        else
+            ostr << "    <dir name=\"" << ErrorLogger::toxml(dir) << "\"/>\n";
+    }
+    ostr << "  </dependencies>\n";
+    mDependencies = ostr.str();
+}
+
+void AnalyzerInformation::reportErr(const ErrorMessage &msg, const std::set<std::string> &macroNames)
+{
+    if (!mOutputStream.is_open())
+        return;
+    mOutputStream << msg.toXML() << '\n';
+    // the macro suppressions are matched against the macros at the location
+    if (!macroNames.empty()) {
+        mOutputStream << "  <macros file=\"" << ErrorLogger::toxml(msg.callStack.back().getfile(false))
+                      << "\" line=\"" << msg.callStack.back().line << "\" names=\"";
+        for (const std::string &name : macroNames)
+            mOutputStream << ErrorLogger::toxml(name) << ' ';
+        mOutputStream << "\"/>\n";
+    }
+}
+
+void AnalyzerInformation::setSuppressionsAndRemarks(const std::list<SuppressionList::Suppression> &suppressions, const std::vector<RemarkComment> &remarkComments)
+{
+    if (!mOutputStream.is_open())
+        return;
+    for (const SuppressionList::Suppression &s : suppressions) {
+        mOutputStream << "  <inline-suppression errorId=\"" << ErrorLogger::toxml(s.errorId) << '"';
+        if (!s.fileName.empty())
+            mOutputStream << " fileName=\"" << ErrorLogger::toxml(s.fileName) << '"';
+        if (s.lineNumber != SuppressionList::Suppression::NO_LINE)
+            mOutputStream << " lineNumber=\"" << s.lineNumber << '"';
+        if (s.lineBegin != SuppressionList::Suppression::NO_LINE)
+            mOutputStream << " lineBegin=\"" << s.lineBegin << '"';
+        if (s.lineEnd != SuppressionList::Suppression::NO_LINE)
+            mOutputStream << " lineEnd=\"" << s.lineEnd << '"';
+        mOutputStream << " type=\"" << static_cast<unsigned int>(s.type) << '"';
+        if (!s.symbolName.empty())
+            mOutputStream << " symbolName=\"" << ErrorLogger::toxml(s.symbolName) << '"';
+        if (!s.macroName.empty())
+            mOutputStream << " macroName=\"" << ErrorLogger::toxml(s.macroName) << '"';
+        if (s.hash > 0)
+            mOutputStream << " hash=\"" << s.hash << '"';
+        mOutputStream << " thisAndNextLine=\"" << bool_to_string(s.thisAndNextLine) << '"'
+                      << " matched=\"" << bool_to_string(s.matched) << '"'
+                      << " checked=\"" << bool_to_string(s.checked) << "\"/>\n";
+    }
+    for (const RemarkComment &r : remarkComments) {
+        mOutputStream << "  <remark file=\"" << ErrorLogger::toxml(r.file) << "\" line=\"" << r.lineNumber
+                      << "\" str=\"" << ErrorLogger::toxml(r.str) << "\"/>\n";
+    }
 }
 
 void AnalyzerInformation::setFileInfo(const std::string &check, const std::string &fileInfo)
@@ -161,3 +413,354 @@ void AnalyzerInformation::setFileInfo(const std::string &check, const std::strin
     if (mOutputStream.is_open() && !fileInfo.empty())
         mOutputStream << "  <FileInfo check=\"" << check << "\">\n" << fileInfo << "  </FileInfo>\n";
 }
+
+namespace {
+    /** The size and the hash of the content of an analyzer info file, the records of the store are looked up by it */
+    struct FileInfoKey {
+        std::uint64_t size{};
+        std::uint64_t hash{};
+
+        bool operator==(const FileInfoKey &other) const {
+            return size == other.size && hash == other.hash;
+        }
+    };
+
+    struct FileInfoKeyHash {
+        std::size_t operator()(const FileInfoKey &key) const {
+            return static_cast<std::size_t>(key.hash);
+        }
+    };
+
+    /** Position of a record in the store */
+    struct FileInfoRecordPos {
+        std::uint64_t offset{};
+        std::uint64_t size{};
+    };
+
+    using FileInfoIndex = std::unordered_map<FileInfoKey, FileInfoRecordPos, FileInfoKeyHash>;
+}
+
+/** Layout of the store: the magic, the offset of the index, the records and the index. The format of the records depends on the version. */
+static const std::string fileInfoStoreMagic("cppcheck-fileinfo " CPPCHECK_VERSION_STRING "\n");
+static const std::size_t fileInfoStoreHeaderSize = fileInfoStoreMagic.size() + 8;
+
+static bool readFile(const std::string &filename, std::string &content)
+{
+    std::ifstream fin(filename, std::ios::binary | std::ios::ate);
+    if (!fin.is_open())
+        return false;
+    const std::streamoff size = fin.tellg();
+    if (size < 0 || !fin.seekg(0))
+        return false;
+    content.resize(static_cast<std::size_t>(size));
+    return size == 0 || static_cast<bool>(fin.read(&content[0], size));
+}
+
+static bool readIndex(const std::string &store, FileInfoIndex &index)
+{
+    if (store.size() < fileInfoStoreHeaderSize || store.compare(0, fileInfoStoreMagic.size(), fileInfoStoreMagic) != 0)
+        return false;
+    BinaryReader header(store.data() + fileInfoStoreMagic.size(), 8);
+    const std::uint64_t indexOffset = header.number();
+    if (indexOffset < fileInfoStoreHeaderSize || indexOffset > store.size())
+        return false;
+    BinaryReader in(store.data() + indexOffset, static_cast<std::size_t>(store.size() - indexOffset));
+    const std::uint64_t count = in.number(4);
+    for (std::uint64_t i = 0; i < count && in.good(); ++i) {
+        FileInfoKey key;
+        key.size = in.number();
+        key.hash = in.number();
+        FileInfoRecordPos pos;
+        pos.offset = in.number();
+        pos.size = in.number();
+        // the records are before the index
+        if (pos.offset < fileInfoStoreHeaderSize || pos.offset > indexOffset || pos.size > indexOffset - pos.offset)
+            return false;
+        index.emplace(key, pos);
+    }
+    return in.good() && in.atEnd();
+}
+
+static const Check *findCheck(const std::string &name)
+{
+    for (const Check *check : Check::instances()) {
+        if (check->name() == name)
+            return check;
+    }
+    return nullptr;
+}
+
+static void loadUnusedFunctionsFromXml(const tinyxml2::XMLElement *xmlElement, AnalyzerInformation::FileInfoData &data)
+{
+    for (const tinyxml2::XMLElement *e = xmlElement->FirstChildElement(); e; e = e->NextSiblingElement()) {
+        const char* functionName = e->Attribute("functionName");
+        if (functionName == nullptr)
+            continue;
+        if (std::strcmp(e->Name(), "functioncall") == 0) {
+            data.functionCalls.emplace_back(functionName);
+            continue;
+        }
+        if (std::strcmp(e->Name(), "functiondecl") == 0) {
+            const char* lineNumber = e->Attribute("lineNumber");
+            if (lineNumber)
+                data.functionDecls.emplace_back(functionName, strToInt<int>(lineNumber));
+        }
+    }
+}
+
+static bool loadFileInfoFromXml(const std::string &content, AnalyzerInformation::FileInfoData &data)
+{
+    tinyxml2::XMLDocument doc;
+    if (doc.Parse(content.data(), content.size()) != tinyxml2::XML_SUCCESS)
+        return false;
+
+    const tinyxml2::XMLElement * const rootNode = doc.FirstChildElement();
+    if (rootNode == nullptr)
+        return false;
+
+    getErrors(rootNode, data.errors);
+
+    for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement("FileInfo"); e; e = e->NextSiblingElement("FileInfo")) {
+        const char *checkAttr = e->Attribute("check");
+        if (!checkAttr)
+            continue;
+        if (std::strcmp(checkAttr, "ctu") == 0) {
+            data.ctu->loadFromXml(e);
+        } else if (std::strcmp(checkAttr, "CheckUnusedFunctions") == 0) {
+            loadUnusedFunctionsFromXml(e, data);
+        } else if (const Check *check = findCheck(checkAttr)) {
+            Check::FileInfo *fileInfo = check->loadFileInfoFromXml(e);
+            if (fileInfo)
+                data.fileInfo.emplace_back(check->name(), std::shared_ptr<Check::FileInfo>(fileInfo));
+        }
+    }
+    return true;
+}
+
+/**
+ * A record holds the decoded data of an analyzer info file: the findings,
+ * the CTU data, the declared and called functions and the data of each
+ * check in its own format, see Check::FileInfo::toBinary().
+ */
+static std::string serializeRecord(const FileInfoKey &key, const AnalyzerInformation::FileInfoData &data)
+{
+    BinaryWriter out;
+    out.number(key.size);
+    out.number(key.hash);
+    out.number(data.errors.size(), 4);
+    for (const ErrorMessage &msg : data.errors)
+        out.str(msg.serialize());
+    BinaryWriter ctu;
+    data.ctu->toBinary(ctu);
+    out.str(ctu.data());
+    out.number(data.functionDecls.size(), 4);
+    for (const std::pair<std::string, int> &functionDecl : data.functionDecls) {
+        out.str(functionDecl.first);
+        out.integer(functionDecl.second);
+    }
+    out.number(data.functionCalls.size(), 4);
+    for (const std::string &functionCall : data.functionCalls)
+        out.str(functionCall);
+    out.number(data.fileInfo.size(), 4);
+    for (const std::pair<std::string, std::shared_ptr<Check::FileInfo>> &fileInfo : data.fileInfo) {
+        BinaryWriter check;
+        fileInfo.second->toBinary(check);
+        out.str(fileInfo.first);
+        out.str(check.data());
+    }
+    return out.data();
+}
+
+static bool deserializeRecord(const char *record, std::size_t size, const FileInfoKey &key, AnalyzerInformation::FileInfoData &data)
+{
+    BinaryReader in(record, size);
+    if (in.number() != key.size || in.number() != key.hash)
+        return false;
+    const std::uint64_t errorCount = in.number(4);
+    for (std::uint64_t i = 0; i < errorCount && in.good(); ++i) {
+        ErrorMessage msg;
+        try {
+            msg.deserialize(in.str());
+        } catch (const InternalError &) {
+            return false;
+        }
+        data.errors.push_back(std::move(msg));
+    }
+    const std::string ctu = in.str();
+    BinaryReader ctuIn(ctu);
+    data.ctu->loadFromBinary(ctuIn);
+    if (!ctuIn.good())
+        return false;
+    const std::uint64_t functionDeclCount = in.number(4);
+    for (std::uint64_t i = 0; i < functionDeclCount && in.good(); ++i) {
+        std::string functionName = in.str();
+        const int lineNumber = static_cast<int>(in.integer());
+        data.functionDecls.emplace_back(std::move(functionName), lineNumber);
+    }
+    const std::uint64_t functionCallCount = in.number(4);
+    for (std::uint64_t i = 0; i < functionCallCount && in.good(); ++i)
+        data.functionCalls.push_back(in.str());
+    const std::uint64_t checkCount = in.number(4);
+    for (std::uint64_t i = 0; i < checkCount && in.good(); ++i) {
+        const std::string name = in.str();
+        const std::string checkData = in.str();
+        const Check *check = findCheck(name);
+        if (!check)
+            return false;
+        BinaryReader checkIn(checkData);
+        Check::FileInfo *fileInfo = check->loadFileInfoFromBinary(checkIn);
+        if (fileInfo)
+            data.fileInfo.emplace_back(name, std::shared_ptr<Check::FileInfo>(fileInfo));
+        if (!checkIn.good())
+            return false;
+    }
+    return in.good() && in.atEnd();
+}
+
+std::list<AnalyzerInformation::FileInfoData> AnalyzerInformation::loadFileInfo(const std::string &buildDir, unsigned int jobs)
+{
+    const std::string storeFile = Path::join(buildDir, "fileinfo.bin");
+
+    // all the records are used so the whole store is read at once
+    std::string store;
+    FileInfoIndex index;
+    if (!readFile(storeFile, store) || !readIndex(store, index)) {
+        store.clear();
+        index.clear();
+    }
+
+    struct Entry {
+        std::string afile;
+        FileInfoKey key;
+        bool loaded{};
+        const FileInfoRecordPos *storedPos{};
+        /** the record of an analyzer info file that is not in the store */
+        std::string record;
+    };
+    std::vector<Entry> entries;
+    std::vector<FileInfoData> data;
+
+    std::ifstream fin(Path::join(buildDir, "files.txt"));
+    std::string filesTxtLine;
+    while (std::getline(fin, filesTxtLine)) {
+        const std::string::size_type firstColon = filesTxtLine.find(':');
+        if (firstColon == std::string::npos)
+            continue;
+        const std::string::size_type secondColon = filesTxtLine.find(':', firstColon+1);
+        if (secondColon == std::string::npos)
+            continue;
+        entries.emplace_back();
+        entries.back().afile = filesTxtLine.substr(0, firstColon);
+        data.emplace_back();
+        data.back().sourcefile = filesTxtLine.substr(secondColon+1);
+    }
+
+    // the analyzer info files are read and decoded in parallel, only the ones that are not in the store are parsed
+    std::atomic<std::size_t> nextEntry{0};
+    const auto worker = [&]() {
+        for (std::size_t i = nextEntry++; i < entries.size(); i = nextEntry++) {
+            Entry &entry = entries[i];
+            std::string content;
+            if (!readFile(Path::join(buildDir, entry.afile), content))
+                continue;
+            entry.key.size = content.size();
+            entry.key.hash = std::hash<std::string>{}(content);
+
+            data[i].ctu = std::make_shared<CTU::FileInfo>();
+            const auto it = index.find(entry.key);
+            if (it != index.end() && deserializeRecord(store.data() + it->second.offset, static_cast<std::size_t>(it->second.size), entry.key, data[i])) {
+                entry.storedPos = &it->second;
+            } else {
+                FileInfoData xmlData;
+                xmlData.sourcefile = std::move(data[i].sourcefile);
+                xmlData.ctu = std::make_shared<CTU::FileInfo>();
+                data[i] = std::move(xmlData);
+                if (!loadFileInfoFromXml(content, data[i]))
+                    continue;
+                entry.record = serializeRecord(entry.key, data[i]);
+            }
+            entry.loaded = true;
+        }
+    };
+    std::vector<std::future<void>> futures;
+    for (std::size_t t = 1; t < std::min<std::size_t>(jobs, entries.size()); ++t)
+        futures.emplace_back(std::async(std::launch::async, worker));
+    worker();
+    for (std::future<void> &f : futures)
+        f.get();
+
+    std::list<FileInfoData> result;
+    // the analyzer info files with the same content share a record
+    std::vector<const Entry *> records;
+    std::unordered_set<FileInfoKey, FileInfoKeyHash> keys;
+    bool changed = false;
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        if (!entries[i].loaded)
+            continue;
+        result.push_back(std::move(data[i]));
+        if (keys.insert(entries[i].key).second) {
+            records.push_back(&entries[i]);
+            if (!entries[i].storedPos)
+                changed = true;
+        }
+    }
+
+    if (!changed && records.size() == index.size())
+        return result;
+
+    // the records of the changed files are appended, the store is rewritten when more than half of it would be unused
+    std::uint64_t liveSize = 0;
+    std::uint64_t appendSize = 0;
+    for (const Entry *entry : records) {
+        if (entry->storedPos) {
+            liveSize += entry->storedPos->size;
+        } else {
+            liveSize += entry->record.size();
+            appendSize += entry->record.size();
+        }
+    }
+    const bool rewrite = store.empty() || store.size() + appendSize > 2 * (liveSize + fileInfoStoreHeaderSize);
+
+    const std::uint64_t start = rewrite ? fileInfoStoreHeaderSize : store.size();
+    std::string newRecords;
+    BinaryWriter newIndex;
+    newIndex.number(records.size(), 4);
+    for (const Entry *entry : records) {
+        FileInfoRecordPos pos;
+        if (!rewrite && entry->storedPos) {
+            pos = *entry->storedPos;
+        } else {
+            pos.offset = start + newRecords.size();
+            if (entry->storedPos)
+                newRecords.append(store, static_cast<std::size_t>(entry->storedPos->offset), static_cast<std::size_t>(entry->storedPos->size));
+            else
+                newRecords += entry->record;
+            pos.size = start + newRecords.size() - pos.offset;
+        }
+        newIndex.number(entry->key.size);
+        newIndex.number(entry->key.hash);
+        newIndex.number(pos.offset);
+        newIndex.number(pos.size);
+    }
+    BinaryWriter indexOffset;
+    indexOffset.number(start + newRecords.size());
+
+    if (rewrite) {
+        const std::string tempFile = storeFile + ".tmp";
+        {
+            std::ofstream fout(tempFile, std::ios::binary);
+            fout << fileInfoStoreMagic << indexOffset.data() << newRecords << newIndex.data();
+            if (!fout)
+                return result;
+        }
+        std::remove(storeFile.c_str());
+        std::rename(tempFile.c_str(), storeFile.c_str());
+    } else {
+        // the old index is still valid until the offset of the new index is written
+        std::fstream fout(storeFile, std::ios::in | std::ios::out | std::ios::binary);
+        if (fout.seekp(static_cast<std::streamoff>(store.size())) && fout << newRecords << newIndex.data() && fout.flush() && fout.seekp(fileInfoStoreMagic.size()))
+            fout << indexOffset.data();
+    }
+
+    return result;
+}
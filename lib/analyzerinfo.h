@@ -21,16 +21,28 @@
 #define analyzerinfoH
 //---------------------------------------------------------------------------
 
+#include "check.h"
 #include "config.h"
+#include "errorlogger.h"
+#include "suppressions.h"
 
 #include <cstddef>
 #include <fstream>
 #include <list>
+#include <map>
+#include <memory>
+#include <set>
 #include <string>
+#include <utility>
+#include <vector>
 
-class ErrorMessage;
+class RemarkComment;
 struct FileSettings;
 
+namespace CTU {
+    class FileInfo;
+}
+
 /// @addtogroup Core
 /// @{
 
@@ -39,7 +51,9 @@ struct FileSettings;
  *
  * Store various analysis information:
  * - checksum
+ * - size and modification time of the files the TU depends on
  * - error messages
+ * - inline suppressions, remark comments and the macros at the locations of the errors
  * - whole program analysis data
  *
  * The information can be used for various purposes. It allows:
@@ -56,14 +70,77 @@ public:
     /** Close current TU.analyzerinfo file */
     void close();
     bool analyzeFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t hash, std::list<ErrorMessage> &errors);
-    void reportErr(const ErrorMessage &msg);
+
+    /**
+     * Check if the stored results for the file can be reused without preprocessing it. That is the
+     * case when the file and all files it included have the same size and modification time as
+     * when the results were written, and the directories which were searched before the included
+     * files were found have the same modification time so no header shadows an included one.
+     * @param buildDir      build dir
+     * @param sourcefile    source file
+     * @param cfg           configuration
+     * @param settingsHash  hash of the settings that affect the result
+     * @param errors        output: the stored errors
+     * @param suppressions  output: the inline suppressions of the files with their state after the analysis
+     * @param remarkComments output: the remark comments of the files
+     * @param locationMacros output: the macros which are used at the locations of the errors
+     * @return true if the stored results are still valid
+     */
+    static bool isUnchanged(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg, std::size_t settingsHash, std::list<ErrorMessage> &errors,
+                            std::list<SuppressionList::Suppression> &suppressions, std::vector<RemarkComment> &remarkComments,
+                            std::map<std::pair<std::string, int>, std::set<std::string>> &locationMacros);
+
+    /**
+     * Set the files the TU depends on. Must be called before analyzeFile() so they are written to the analyzer info file.
+     * @param settingsHash  hash of the settings that affect the result
+     * @param files         the source file and the files it included
+     * @param includePaths  include paths the files were searched in
+     */
+    void setDependencies(std::size_t settingsHash, const std::vector<std::string> &files, const std::list<std::string> &includePaths);
+    void reportErr(const ErrorMessage &msg, const std::set<std::string> &macroNames);
+
+    /**
+     * Store the inline suppressions and the remark comments of the TU so they can be restored when its results are reused.
+     * @param suppressions   the inline suppressions of the files of the TU with their state after the analysis
+     * @param remarkComments the remark comments of the files of the TU
+     */
+    void setSuppressionsAndRemarks(const std::list<SuppressionList::Suppression> &suppressions, const std::vector<RemarkComment> &remarkComments);
+
     void setFileInfo(const std::string &check, const std::string &fileInfo);
     static std::string getAnalyzerInfoFile(const std::string &buildDir, const std::string &sourcefile, const std::string &cfg);
+
+    /** The findings and the whole program analysis data of an analyzer info file */
+    struct FileInfoData {
+        std::string sourcefile;
+        /** The findings */
+        std::list<ErrorMessage> errors;
+        /** The CTU data */
+        std::shared_ptr<CTU::FileInfo> ctu;
+        /** The check name and the FileInfo of each check */
+        std::list<std::pair<std::string, std::shared_ptr<Check::FileInfo>>> fileInfo;
+        /** The declared functions with their line and the called functions for the unused functions check */
+        std::list<std::pair<std::string, int>> functionDecls;
+        std::list<std::string> functionCalls;
+    };
+
+    /**
+     * Load the findings and the whole program analysis data of the files
+     * in files.txt using @p jobs threads.
+     *
+     * The decoded data is kept in an indexed store in the build dir
+     * (fileinfo.bin). The records are looked up by the size and the hash
+     * of the content of the analyzer info files, so only the analyzer info
+     * files that changed since the last whole program analysis are parsed.
+     * The records of the changed files are appended to the store, it is
+     * rewritten when more than half of it is unused.
+     */
+    static std::list<FileInfoData> loadFileInfo(const std::string &buildDir, unsigned int jobs = 1);
 protected:
     static std::string getAnalyzerInfoFileFromFilesTxt(std::istream& filesTxt, const std::string &sourcefile, const std::string &cfg);
 private:
     std::ofstream mOutputStream;
     std::string mAnalyzerInfoFile;
+    std::string mDependencies;
 };
 
 /// @}
@@ -29,6 +29,7 @@
 #include "settings.h"
 #include "symboldatabase.h"
 #include "token.h"
+#include "tokenmatch.h"
 #include "utils.h"
 #include "valueflow.h"
 #include "valueptr.h"
@@ -406,9 +407,11 @@ bool isVariableDecl(const Token* tok)
     return Token::Match(varDeclEndToken, "; %var%") && varDeclEndToken->next() == tok;
 }
 
+static constexpr char stlString[] = "std :: string|wstring|u16string|u32string !!::";
+
 bool isStlStringType(const Token* tok)
 {
-    return Token::Match(tok, "std :: string|wstring|u16string|u32string !!::") ||
+    return Token::Match<stlString>(tok) ||
            (Token::simpleMatch(tok, "std :: basic_string <") && !Token::simpleMatch(tok->linkAt(3), "> ::"));
 }
 
@@ -3645,7 +3648,9 @@ bool isGlobalData(const Token *expr)
     return globalData || !var;
 }
 
+static constexpr char unevaluated[] = "alignof|_Alignof|_alignof|__alignof|__alignof__|decltype|offsetof|sizeof|typeid|typeof|__typeof__ (";
+
 bool isUnevaluated(const Token *tok)
 {
-    return Token::Match(tok, "alignof|_Alignof|_alignof|__alignof|__alignof__|decltype|offsetof|sizeof|typeid|typeof|__typeof__ (");
+    return Token::Match<unevaluated>(tok);
 }
@@ -0,0 +1,216 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2024 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "binarydump.h"
+
+#include "errortypes.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+    struct Block {
+        std::unordered_map<std::string, std::uint32_t> ids;
+        std::string strings;
+        std::vector<std::uint32_t> elements;
+        std::vector<std::uint32_t> attributes;
+
+        std::uint32_t id(std::string str) {
+            const auto it = ids.emplace(std::move(str), static_cast<std::uint32_t>(ids.size()));
+            if (it.second) {
+                if (it.first->second != 0)
+                    strings += '\0';
+                strings += it.first->first;
+            }
+            return it.first->second;
+        }
+
+        static void write(std::string &out, std::size_t size, std::size_t value) {
+            for (std::size_t i = 0; i < size; ++i)
+                out += static_cast<char>((value >> (8 * i)) & 0xff);
+        }
+
+        std::string str() const {
+            // the tags are stored as their index plus one
+            const std::size_t width = ids.size() < 0xffff ? 2 : 4;
+            std::string out;
+            out.reserve(20 + strings.size() + width * (elements.size() + attributes.size()));
+            write(out, 4, width);
+            write(out, 4, ids.size());
+            write(out, 4, strings.size());
+            write(out, 4, elements.size());
+            write(out, 4, attributes.size());
+            out += strings;
+            for (const std::uint32_t e : elements)
+                write(out, width, e);
+            for (const std::uint32_t a : attributes)
+                write(out, width, a);
+            return out;
+        }
+    };
+}
+
+static bool isSpace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+NORETURN static void malformed(const std::string &what)
+{
+    throw InternalError(nullptr, "Failed to encode the binary dump: " + what);
+}
+
+static void appendUtf8(std::string &str, unsigned long c)
+{
+    if (c < 0x80) {
+        str += static_cast<char>(c);
+    } else if (c < 0x800) {
+        str += static_cast<char>(0xc0 | (c >> 6));
+        str += static_cast<char>(0x80 | (c & 0x3f));
+    } else if (c < 0x10000) {
+        str += static_cast<char>(0xe0 | (c >> 12));
+        str += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+        str += static_cast<char>(0x80 | (c & 0x3f));
+    } else {
+        str += static_cast<char>(0xf0 | (c >> 18));
+        str += static_cast<char>(0x80 | ((c >> 12) & 0x3f));
+        str += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+        str += static_cast<char>(0x80 | (c & 0x3f));
+    }
+}
+
+/** The value of an attribute like an XML parser reads it: the entities are replaced and the whitespace is normalized */
+static std::string attributeValue(const std::string &xml, std::size_t begin, std::size_t end)
+{
+    std::string value;
+    value.reserve(end - begin);
+    for (std::size_t i = begin; i < end; ++i) {
+        const char c = xml[i];
+        if (c == '&') {
+            const std::size_t semicolon = xml.find(';', i);
+            if (semicolon >= end)
+                malformed("unterminated entity");
+            const std::string entity = xml.substr(i + 1, semicolon - i - 1);
+            if (entity == "lt")
+                value += '<';
+            else if (entity == "gt")
+                value += '>';
+            else if (entity == "amp")
+                value += '&';
+            else if (entity == "quot")
+                value += '\"';
+            else if (entity == "apos")
+                value += '\'';
+            else if (entity.size() > 1 && entity[0] == '#') {
+                const bool hex = entity[1] == 'x';
+                appendUtf8(value, std::strtoul(entity.c_str() + (hex ? 2 : 1), nullptr, hex ? 16 : 10));
+            } else
+                malformed("unknown entity '" + entity + "'");
+            i = semicolon;
+        } else if (c == '\r' && i + 1 < end && xml[i + 1] == '\n') {
+            // line break is normalized first
+        } else if (isSpace(c)) {
+            value += ' ';
+        } else {
+            value += c;
+        }
+    }
+    return value;
+}
+
+static std::size_t skipPast(const std::string &xml, std::size_t pos, const char *end)
+{
+    const std::size_t found = xml.find(end, pos);
+    if (found == std::string::npos)
+        malformed("unterminated markup");
+    return found + std::char_traits<char>::length(end);
+}
+
+const std::string &BinaryDump::magic()
+{
+    static const std::string m("cppcheck-dump 1\n");
+    return m;
+}
+
+std::string BinaryDump::encode(const std::string &xml)
+{
+    Block block;
+    std::size_t pos = 0;
+    while ((pos = xml.find('<', pos)) != std::string::npos) {
+        if (xml.compare(pos, 2, "<?") == 0) {
+            pos = skipPast(xml, pos, "?>");
+            continue;
+        }
+        if (xml.compare(pos, 4, "<!--") == 0) {
+            pos = skipPast(xml, pos, "-->");
+            continue;
+        }
+        if (xml.compare(pos, 2, "</") == 0) {
+            pos = skipPast(xml, pos, ">");
+            block.elements.push_back(0);
+            continue;
+        }
+
+        // start of an element
+        ++pos;
+        const std::size_t tagEnd = xml.find_first_of(" \t\r\n/>", pos);
+        if (tagEnd == std::string::npos || tagEnd == pos)
+            malformed("missing tag");
+        block.elements.push_back(block.id(xml.substr(pos, tagEnd - pos)) + 1);
+        const std::size_t attributeCount = block.elements.size();
+        block.elements.push_back(0);
+        pos = tagEnd;
+        for (;;) {
+            pos = xml.find_first_not_of(" \t\r\n", pos);
+            if (pos == std::string::npos)
+                malformed("unterminated element");
+            if (xml[pos] == '>') {
+                ++pos;
+                break;
+            }
+            if (xml[pos] == '/') {
+                if (xml.compare(pos, 2, "/>") != 0)
+                    malformed("unexpected '/'");
+                pos += 2;
+                block.elements.push_back(0);
+                break;
+            }
+            const std::size_t eq = xml.find('=', pos);
+            if (eq == std::string::npos)
+                malformed("missing attribute value");
+            std::size_t nameEnd = eq;
+            while (nameEnd > pos && isSpace(xml[nameEnd - 1]))
+                --nameEnd;
+            const std::size_t quote = xml.find_first_not_of(" \t\r\n", eq + 1);
+            if (quote == std::string::npos || (xml[quote] != '\"' && xml[quote] != '\''))
+                malformed("unquoted attribute value");
+            const std::size_t valueEnd = xml.find(xml[quote], quote + 1);
+            if (valueEnd == std::string::npos)
+                malformed("unterminated attribute value");
+            block.attributes.push_back(block.id(xml.substr(pos, nameEnd - pos)));
+            block.attributes.push_back(block.id(attributeValue(xml, quote + 1, valueEnd)));
+            ++block.elements[attributeCount];
+            pos = valueEnd + 1;
+        }
+    }
+    return block.str();
+}
@@ -0,0 +1,60 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2024 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef binarydumpH
+#define binarydumpH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <string>
+
+/**
+ * @brief Compact binary encoding of the dump files (--dump-format=binary).
+ *
+ * A binary dump file starts with the magic bytes and is followed by
+ * blocks. Each block encodes a fragment of the XML dump:
+ * - a header of five little endian 32 bit numbers: the size of the
+ *   numbers that follow (2 or 4 bytes), the number of strings, the size
+ *   of the strings in bytes, the number of element items and the number
+ *   of attribute items
+ * - the UTF-8 strings of the block, separated by '\\0'
+ * - the element items: the start of an element is the index of its tag
+ *   in the strings plus one followed by its number of attributes, the end
+ *   of an element is 0
+ * - the attribute items: the indexes of the name and the value of each
+ *   attribute in the strings
+ *
+ * The elements can start and end in different blocks. cppcheckdata.py
+ * reads a binary dump into the same elements as the XML dump.
+ */
+namespace BinaryDump {
+    /** The first bytes of a binary dump file */
+    CPPCHECKLIB const std::string &magic();
+
+    /**
+     * Encode a fragment of the XML dump as a block.
+     * The text between the elements is not kept, the dump does not have any.
+     * @throws InternalError if the XML is malformed
+     */
+    CPPCHECKLIB std::string encode(const std::string &xml);
+}
+
+//---------------------------------------------------------------------------
+#endif
@@ -0,0 +1,124 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2024 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef binarystreamH
+#define binarystreamH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Writes numbers and strings in a compact binary format.
+ *
+ * The numbers are little endian, a string is its size as a 32 bit number
+ * followed by its bytes. The data of the whole program analysis is
+ * stored in this format in the build dir, see
+ * AnalyzerInformation::loadFileInfo().
+ */
+class BinaryWriter {
+public:
+    void number(std::uint64_t value, std::size_t bytes = 8) {
+        for (std::size_t i = 0; i < bytes; ++i)
+            mData += static_cast<char>((value >> (8 * i)) & 0xff);
+    }
+
+    void integer(long long value) {
+        number(static_cast<std::uint64_t>(value));
+    }
+
+    void str(const std::string &s) {
+        number(s.size(), 4);
+        mData += s;
+    }
+
+    const std::string &data() const {
+        return mData;
+    }
+
+private:
+    std::string mData;
+};
+
+/**
+ * @brief Reads the data of a BinaryWriter.
+ *
+ * Reading past the end of the data fails, the values read after that
+ * are 0 and empty strings.
+ */
+class BinaryReader {
+public:
+    BinaryReader(const char *data, std::size_t size) : mData(data), mSize(size) {}
+
+    explicit BinaryReader(const std::string &data) : BinaryReader(data.data(), data.size()) {}
+
+    std::uint64_t number(std::size_t bytes = 8) {
+        std::uint64_t value = 0;
+        if (mFailed || mSize - mPos < bytes) {
+            mFailed = true;
+            return value;
+        }
+        for (std::size_t i = 0; i < bytes; ++i)
+            value |= static_cast<std::uint64_t>(static_cast<unsigned char>(mData[mPos + i])) << (8 * i);
+        mPos += bytes;
+        return value;
+    }
+
+    long long integer() {
+        return static_cast<long long>(number());
+    }
+
+    std::string str() {
+        const std::uint64_t size = number(4);
+        // do not allocate a string for a broken size
+        if (mFailed || mSize - mPos < size) {
+            mFailed = true;
+            return "";
+        }
+        std::string s(mData + mPos, static_cast<std::size_t>(size));
+        mPos += static_cast<std::size_t>(size);
+        return s;
+    }
+
+    /** @return true if nothing was read past the end of the data */
+    bool good() const {
+        return !mFailed;
+    }
+
+    /** @return true if all data is read */
+    bool atEnd() const {
+        return mPos == mSize;
+    }
+
+private:
+    const char *mData;
+    std::size_t mSize;
+    std::size_t mPos{};
+    bool mFailed{};
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // binarystreamH
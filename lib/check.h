@@ -40,6 +40,8 @@ namespace ValueFlow {
     class Value;
 }
 
+class BinaryReader;
+class BinaryWriter;
 class Settings;
 class Token;
 class ErrorLogger;
@@ -107,6 +109,11 @@ public:
         virtual std::string toString() const {
             return std::string();
         }
+
+        /** Write the data for the whole program analysis store in the build dir */
+        virtual void toBinary(BinaryWriter &out) const {
+            (void)out;
+        }
     };
 
     virtual FileInfo * getFileInfo(const Tokenizer& /*tokenizer*/, const Settings& /*settings*/) const {
@@ -118,6 +125,12 @@ public:
         return nullptr;
     }
 
+    /** Load the data that FileInfo::toBinary() wrote */
+    virtual FileInfo * loadFileInfoFromBinary(BinaryReader &in) const {
+        (void)in;
+        return nullptr;
+    }
+
     // Return true if an error is reported.
     virtual bool analyseWholeProgram(const CTU::FileInfo *ctu, const std::list<FileInfo*> &fileInfo, const Settings& /*settings*/, ErrorLogger & /*errorLogger*/) {
         (void)ctu;
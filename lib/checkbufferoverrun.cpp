@@ -23,6 +23,7 @@
 #include "checkbufferoverrun.h"
 
 #include "astutils.h"
+#include "binarystream.h"
 #include "errorlogger.h"
 #include "library.h"
 #include "mathlib.h"
@@ -67,7 +68,7 @@ static const CWE CWE_BUFFER_OVERRUN(788U);   // Access of Memory Location After
 
 static const ValueFlow::Value *getBufferSizeValue(const Token *tok)
 {
-    const std::list<ValueFlow::Value> &tokenValues = tok->values();
+    const ValueFlow::ValueList &tokenValues = tok->values();
     const auto it = std::find_if(tokenValues.cbegin(), tokenValues.cend(), std::mem_fn(&ValueFlow::Value::isBufferSizeValue));
     return it == tokenValues.cend() ? nullptr : &*it;
 }
@@ -772,7 +773,7 @@ void CheckBufferOverrun::stringNotZeroTerminated()
             if (bufferSize.intvalue < 0 || sizeToken->getKnownIntValue() < bufferSize.intvalue)
                 continue;
             if (Token::simpleMatch(args[1], "(") && Token::simpleMatch(args[1]->astOperand1(), ". c_str") && args[1]->astOperand1()->astOperand1()) {
-                const std::list<ValueFlow::Value>& contValues = args[1]->astOperand1()->astOperand1()->values();
+                const ValueFlow::ValueList& contValues = args[1]->astOperand1()->astOperand1()->values();
                 auto it = std::find_if(contValues.cbegin(), contValues.cend(), [](const ValueFlow::Value& value) {
                     return value.isContainerSizeValue() && !value.isImpossible();
                 });
@@ -910,6 +911,12 @@ namespace
                 xml += "    <pointer-arith>\n" + CTU::toString(unsafePointerArith) + "    </pointer-arith>\n";
             return xml;
         }
+
+        void toBinary(BinaryWriter &out) const override
+        {
+            CTU::toBinary(unsafeArrayIndex, out);
+            CTU::toBinary(unsafePointerArith, out);
+        }
     };
 }
 
@@ -980,6 +987,20 @@ Check::FileInfo * CheckBufferOverrun::loadFileInfoFromXml(const tinyxml2::XMLEle
     return fileInfo;
 }
 
+Check::FileInfo * CheckBufferOverrun::loadFileInfoFromBinary(BinaryReader &in) const
+{
+    auto *fileInfo = new MyFileInfo;
+    fileInfo->unsafeArrayIndex = CTU::loadUnsafeUsageListFromBinary(in);
+    fileInfo->unsafePointerArith = CTU::loadUnsafeUsageListFromBinary(in);
+
+    if (fileInfo->unsafeArrayIndex.empty() && fileInfo->unsafePointerArith.empty()) {
+        delete fileInfo;
+        return nullptr;
+    }
+
+    return fileInfo;
+}
+
 /** @brief Analyse all file infos for all TU */
 bool CheckBufferOverrun::analyseWholeProgram(const CTU::FileInfo *ctu, const std::list<Check::FileInfo*> &fileInfo, const Settings& settings, ErrorLogger &errorLogger)
 {
@@ -992,28 +1013,28 @@ bool CheckBufferOverrun::analyseWholeProgram(const CTU::FileInfo *ctu, const std
     dummy.
     logChecker("CheckBufferOverrun::analyseWholeProgram");
 
-    const std::map<std::string, std::list<const CTU::FileInfo::CallBase *>> callsMap = ctu->getCallsMap();
+    const CTU::FileInfo::CallGraph callGraph(*ctu);
 
     for (const Check::FileInfo* fi1 : fileInfo) {
         const auto *fi = dynamic_cast<const MyFileInfo*>(fi1);
         if (!fi)
             continue;
         for (const CTU::FileInfo::UnsafeUsage &unsafeUsage : fi->unsafeArrayIndex)
-            foundErrors |= analyseWholeProgram1(callsMap, unsafeUsage, 1, errorLogger);
+            foundErrors |= analyseWholeProgram1(callGraph, unsafeUsage, 1, errorLogger);
         for (const CTU::FileInfo::UnsafeUsage &unsafeUsage : fi->unsafePointerArith)
-            foundErrors |= analyseWholeProgram1(callsMap, unsafeUsage, 2, errorLogger);
+            foundErrors |= analyseWholeProgram1(callGraph, unsafeUsage, 2, errorLogger);
     }
     return foundErrors;
 }
 
-bool CheckBufferOverrun::analyseWholeProgram1(const std::map<std::string, std::list<const CTU::FileInfo::CallBase *>> &callsMap, const CTU::FileInfo::UnsafeUsage &unsafeUsage, int type, ErrorLogger &errorLogger)
+bool CheckBufferOverrun::analyseWholeProgram1(const CTU::FileInfo::CallGraph &callGraph, const CTU::FileInfo::UnsafeUsage &unsafeUsage, int type, ErrorLogger &errorLogger)
 {
     const CTU::FileInfo::FunctionCall *functionCall = nullptr;
 
     const std::list<ErrorMessage::FileLocation> &locationList =
         CTU::FileInfo::getErrorPath(CTU::FileInfo::InvalidValueType::bufferOverflow,
                                     unsafeUsage,
-                                    callsMap,
+                                    callGraph,
                                     "Using argument ARG",
                                     &functionCall,
                                     false);
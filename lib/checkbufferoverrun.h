@@ -32,7 +32,6 @@
 #include "vfvalue.h"
 
 #include <list>
-#include <map>
 #include <string>
 #include <vector>
 
@@ -40,6 +39,7 @@ namespace tinyxml2 {
     class XMLElement;
 }
 
+class BinaryReader;
 class ErrorLogger;
 class Settings;
 class Token;
@@ -135,7 +135,8 @@ private:
     static bool isCtuUnsafePointerArith(const Settings &settings, const Token *argtok, MathLib::bigint *offset);
 
     Check::FileInfo * loadFileInfoFromXml(const tinyxml2::XMLElement *xmlElement) const override;
-    static bool analyseWholeProgram1(const std::map<std::string, std::list<const CTU::FileInfo::CallBase *>> &callsMap, const CTU::FileInfo::UnsafeUsage &unsafeUsage, int type, ErrorLogger &errorLogger);
+    Check::FileInfo * loadFileInfoFromBinary(BinaryReader &in) const override;
+    static bool analyseWholeProgram1(const CTU::FileInfo::CallGraph &callGraph, const CTU::FileInfo::UnsafeUsage &unsafeUsage, int type, ErrorLogger &errorLogger);
 
 
     static std::string myName() {
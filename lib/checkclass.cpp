@@ -20,6 +20,7 @@
 #include "checkclass.h"
 
 #include "astutils.h"
+#include "binarystream.h"
 #include "library.h"
 #include "settings.h"
 #include "standards.h"
@@ -35,6 +36,7 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstdint>
 #include <cstring>
 #include <iterator>
 #include <utility>
@@ -3545,6 +3547,18 @@ namespace
             }
             return ret;
         }
+
+        void toBinary(BinaryWriter &out) const override
+        {
+            out.number(classDefinitions.size(), 4);
+            for (const NameLoc &nameLoc: classDefinitions) {
+                out.str(nameLoc.className);
+                out.str(nameLoc.fileName);
+                out.integer(nameLoc.lineNumber);
+                out.integer(nameLoc.column);
+                out.number(nameLoc.hash);
+            }
+        }
     };
 }
 
@@ -3645,6 +3659,27 @@ Check::FileInfo * CheckClass::loadFileInfoFromXml(const tinyxml2::XMLElement *xm
     return fileInfo;
 }
 
+Check::FileInfo * CheckClass::loadFileInfoFromBinary(BinaryReader &in) const
+{
+    auto *fileInfo = new MyFileInfo;
+    const std::uint64_t count = in.number(4);
+    for (std::uint64_t i = 0; i < count && in.good(); ++i) {
+        MyFileInfo::NameLoc nameLoc;
+        nameLoc.className = in.str();
+        nameLoc.fileName = in.str();
+        nameLoc.lineNumber = static_cast<int>(in.integer());
+        nameLoc.column = static_cast<int>(in.integer());
+        nameLoc.hash = static_cast<std::size_t>(in.number());
+        if (in.good())
+            fileInfo->classDefinitions.push_back(std::move(nameLoc));
+    }
+    if (fileInfo->classDefinitions.empty()) {
+        delete fileInfo;
+        fileInfo = nullptr;
+    }
+    return fileInfo;
+}
+
 bool CheckClass::analyseWholeProgram(const CTU::FileInfo *ctu, const std::list<Check::FileInfo*> &fileInfo, const Settings& settings, ErrorLogger &errorLogger)
 {
     bool foundErrors = false;
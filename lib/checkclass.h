@@ -33,6 +33,7 @@
 #include <string>
 #include <vector>
 
+class BinaryReader;
 class ErrorLogger;
 class Settings;
 class Token;
@@ -173,6 +174,8 @@ private:
 
     Check::FileInfo * loadFileInfoFromXml(const tinyxml2::XMLElement *xmlElement) const override;
 
+    Check::FileInfo * loadFileInfoFromBinary(BinaryReader &in) const override;
+
     /** @brief Analyse all file infos for all TU */
     bool analyseWholeProgram(const CTU::FileInfo *ctu, const std::list<Check::FileInfo*> &fileInfo, const Settings& settings, ErrorLogger &errorLogger) override;
 
@@ -510,7 +510,7 @@ static bool findFormat(nonneg int arg, const Token *firstArg,
           argTok->variable()->dimension(0) != 0))) {
         formatArgTok = argTok->nextArgument();
         if (!argTok->values().empty()) {
-            const std::list<ValueFlow::Value>::const_iterator value = std::find_if(
+            const ValueFlow::ValueList::const_iterator value = std::find_if(
                 argTok->values().cbegin(), argTok->values().cend(), std::mem_fn(&ValueFlow::Value::isTokValue));
             if (value != argTok->values().cend() && value->isTokValue() && value->tokvalue &&
                 value->tokvalue->tokType() == Token::eString) {
@@ -698,7 +698,7 @@ void CheckIO::checkFormatString(const Token * const tok,
                 }
 
                 // Perform type checks
-                ArgumentInfo argInfo(argListTok, *mSettings, mTokenizer->isCPP());
+                ArgumentInfo argInfo(argListTok, *mSettings, mTokenizer->list);
 
                 if ((argInfo.typeToken && !argInfo.isLibraryType(*mSettings)) || *i == ']') {
                     if (scan) {
@@ -1344,8 +1344,9 @@ void CheckIO::checkFormatString(const Token * const tok,
 // We currently only support string literals, variables, and functions.
 /// @todo add non-string literals, and generic expressions
 
-CheckIO::ArgumentInfo::ArgumentInfo(const Token * arg, const Settings &settings, bool _isCPP)
-    : isCPP(_isCPP)
+CheckIO::ArgumentInfo::ArgumentInfo(const Token * arg, const Settings &settings, const TokenList &list)
+    : isCPP(list.isCPP())
+    , mTempTokensFrontBack(list)
 {
     if (!arg)
         return;
@@ -1360,7 +1361,7 @@ CheckIO::ArgumentInfo::ArgumentInfo(const Token * arg, const Settings &settings,
             top = top->astParent();
         const ValueType *valuetype = top->argumentType();
         if (valuetype && valuetype->type >= ValueType::Type::BOOL) {
-            typeToken = tempToken = new Token(top);
+            typeToken = tempToken = new Token(mTempTokensFrontBack, top);
             if (valuetype->pointer && valuetype->constness & 1) {
                 tempToken->str("const");
                 tempToken->insertToken("a");
@@ -1442,7 +1443,7 @@ CheckIO::ArgumentInfo::ArgumentInfo(const Token * arg, const Settings &settings,
                             if (function->retType->classScope->enumType)
                                 typeToken = function->retType->classScope->enumType;
                             else {
-                                tempToken = new Token(tok1);
+                                tempToken = new Token(mTempTokensFrontBack, tok1);
                                 tempToken->str("int");
                                 typeToken = tempToken;
                             }
@@ -1461,7 +1462,7 @@ CheckIO::ArgumentInfo::ArgumentInfo(const Token * arg, const Settings &settings,
                         if (function->retType->classScope->enumType)
                             typeToken = function->retType->classScope->enumType;
                         else {
-                            tempToken = new Token(tok1);
+                            tempToken = new Token(mTempTokensFrontBack, tok1);
                             tempToken->str("int");
                             typeToken = tempToken;
                         }
@@ -1485,7 +1486,7 @@ CheckIO::ArgumentInfo::ArgumentInfo(const Token * arg, const Settings &settings,
             // check for some common well known functions
             else if (isCPP && ((Token::Match(tok1->previous(), "%var% . size|empty|c_str ( ) [,)]") && isStdContainer(tok1->previous())) ||
                                (Token::Match(tok1->previous(), "] . size|empty|c_str ( ) [,)]") && isStdContainer(tok1->linkAt(-1)->previous())))) {
-                tempToken = new Token(tok1);
+                tempToken = new Token(mTempTokensFrontBack, tok1);
                 if (tok1->strAt(1) == "size") {
                     // size_t is platform dependent
                     if (settings.platform.sizeof_size_t == 8) {
@@ -1544,7 +1545,7 @@ CheckIO::ArgumentInfo::ArgumentInfo(const Token * arg, const Settings &settings,
                     if (variableInfo->type() && variableInfo->type()->classScope && variableInfo->type()->classScope->enumType)
                         typeToken = variableInfo->type()->classScope->enumType;
                     else {
-                        tempToken = new Token(tok1);
+                        tempToken = new Token(mTempTokensFrontBack, tok1);
                         tempToken->str("int");
                         typeToken = tempToken;
                     }
@@ -1582,7 +1583,7 @@ bool CheckIO::ArgumentInfo::isStdVectorOrString()
         return true;
     }
     if (variableInfo->isStlType(stl_string)) {
-        tempToken = new Token(variableInfo->typeStartToken());
+        tempToken = new Token(mTempTokensFrontBack, variableInfo->typeStartToken());
         if (variableInfo->typeStartToken()->strAt(2) == "string")
             tempToken->str("char");
         else
@@ -1600,7 +1601,7 @@ bool CheckIO::ArgumentInfo::isStdVectorOrString()
                 return true;
             }
             if (Token::Match(nameTok, "std :: string|wstring")) {
-                tempToken = new Token(variableInfo->typeStartToken());
+                tempToken = new Token(mTempTokensFrontBack, variableInfo->typeStartToken());
                 if (nameTok->strAt(2) == "string")
                     tempToken->str("char");
                 else
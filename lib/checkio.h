@@ -24,6 +24,7 @@
 #include "check.h"
 #include "config.h"
 #include "tokenize.h"
+#include "tokenlist.h"
 
 #include <cstdint>
 #include <ostream>
@@ -76,7 +77,7 @@ private:
 
     class ArgumentInfo {
     public:
-        ArgumentInfo(const Token *arg, const Settings &settings, bool _isCPP);
+        ArgumentInfo(const Token *arg, const Settings &settings, const TokenList &list);
         ~ArgumentInfo();
 
         ArgumentInfo(const ArgumentInfo &) = delete;
@@ -97,6 +98,10 @@ private:
         bool _template{};
         bool address{};
         bool isCPP{};
+
+    private:
+        // the temporary tokens are not part of the checked token list
+        TokensFrontBack mTempTokensFrontBack;
     };
 
     void checkFormatString(const Token * const tok,
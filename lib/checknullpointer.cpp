@@ -21,6 +21,7 @@
 #include "checknullpointer.h"
 
 #include "astutils.h"
+#include "binarystream.h"
 #include "ctu.h"
 #include "errorlogger.h"
 #include "errortypes.h"
@@ -35,8 +36,8 @@
 
 #include <algorithm>
 #include <cctype>
-#include <map>
 #include <set>
+#include <utility>
 #include <vector>
 
 //---------------------------------------------------------------------------
@@ -583,6 +584,11 @@ namespace
         {
             return CTU::toString(unsafeUsage);
         }
+
+        void toBinary(BinaryWriter &out) const override
+        {
+            CTU::toBinary(unsafeUsage, out);
+        }
     };
 }
 
@@ -608,6 +614,17 @@ Check::FileInfo * CheckNullPointer::loadFileInfoFromXml(const tinyxml2::XMLEleme
     return fileInfo;
 }
 
+Check::FileInfo * CheckNullPointer::loadFileInfoFromBinary(BinaryReader &in) const
+{
+    std::list<CTU::FileInfo::UnsafeUsage> unsafeUsage = CTU::loadUnsafeUsageListFromBinary(in);
+    if (unsafeUsage.empty())
+        return nullptr;
+
+    auto *fileInfo = new MyFileInfo;
+    fileInfo->unsafeUsage = std::move(unsafeUsage);
+    return fileInfo;
+}
+
 bool CheckNullPointer::analyseWholeProgram(const CTU::FileInfo *ctu, const std::list<Check::FileInfo*> &fileInfo, const Settings& settings, ErrorLogger &errorLogger)
 {
     if (!ctu)
@@ -619,7 +636,7 @@ bool CheckNullPointer::analyseWholeProgram(const CTU::FileInfo *ctu, const std::
     dummy.
     logChecker("CheckNullPointer::analyseWholeProgram"); // unusedfunctions
 
-    const std::map<std::string, std::list<const CTU::FileInfo::CallBase *>> callsMap = ctu->getCallsMap();
+    const CTU::FileInfo::CallGraph callGraph(*ctu);
 
     for (const Check::FileInfo* fi1 : fileInfo) {
         const auto *fi = dynamic_cast<const MyFileInfo*>(fi1);
@@ -633,7 +650,7 @@ bool CheckNullPointer::analyseWholeProgram(const CTU::FileInfo *ctu, const std::
                 const std::list<ErrorMessage::FileLocation> &locationList =
                     CTU::FileInfo::getErrorPath(CTU::FileInfo::InvalidValueType::null,
                                                 unsafeUsage,
-                                                callsMap,
+                                                callGraph,
                                                 "Dereferencing argument ARG that is null",
                                                 nullptr,
                                                 warning);
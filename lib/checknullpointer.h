@@ -30,6 +30,7 @@
 #include <list>
 #include <string>
 
+class BinaryReader;
 class ErrorLogger;
 class Library;
 class Settings;
@@ -110,6 +111,8 @@ private:
 
     Check::FileInfo * loadFileInfoFromXml(const tinyxml2::XMLElement *xmlElement) const override;
 
+    Check::FileInfo * loadFileInfoFromBinary(BinaryReader &in) const override;
+
     /** @brief Analyse all file infos for all TU */
     bool analyseWholeProgram(const CTU::FileInfo *ctu, const std::list<Check::FileInfo*> &fileInfo, const Settings& settings, ErrorLogger &errorLogger) override;
 
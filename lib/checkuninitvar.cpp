@@ -21,6 +21,7 @@
 #include "checkuninitvar.h"
 
 #include "astutils.h"
+#include "binarystream.h"
 #include "ctu.h"
 #include "errorlogger.h"
 #include "library.h"
@@ -39,6 +40,7 @@
 #include <list>
 #include <map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 
@@ -1700,6 +1702,11 @@ namespace
         {
             return CTU::toString(unsafeUsage);
         }
+
+        void toBinary(BinaryWriter &out) const override
+        {
+            CTU::toBinary(unsafeUsage, out);
+        }
     };
 }
 
@@ -1725,6 +1732,17 @@ Check::FileInfo * CheckUninitVar::loadFileInfoFromXml(const tinyxml2::XMLElement
     return fileInfo;
 }
 
+Check::FileInfo * CheckUninitVar::loadFileInfoFromBinary(BinaryReader &in) const
+{
+    std::list<CTU::FileInfo::UnsafeUsage> unsafeUsage = CTU::loadUnsafeUsageListFromBinary(in);
+    if (unsafeUsage.empty())
+        return nullptr;
+
+    auto *fileInfo = new MyFileInfo;
+    fileInfo->unsafeUsage = std::move(unsafeUsage);
+    return fileInfo;
+}
+
 bool CheckUninitVar::analyseWholeProgram(const CTU::FileInfo *ctu, const std::list<Check::FileInfo*> &fileInfo, const Settings& settings, ErrorLogger &errorLogger)
 {
     if (!ctu)
@@ -1732,7 +1750,7 @@ bool CheckUninitVar::analyseWholeProgram(const CTU::FileInfo *ctu, const std::li
     bool foundErrors = false;
     (void)settings; // This argument is unused
 
-    const std::map<std::string, std::list<const CTU::FileInfo::CallBase *>> callsMap = ctu->getCallsMap();
+    const CTU::FileInfo::CallGraph callGraph(*ctu);
 
     for (const Check::FileInfo* fi1 : fileInfo) {
         const auto *fi = dynamic_cast<const MyFileInfo*>(fi1);
@@ -1744,7 +1762,7 @@ bool CheckUninitVar::analyseWholeProgram(const CTU::FileInfo *ctu, const std::li
             const std::list<ErrorMessage::FileLocation> &locationList =
                 CTU::FileInfo::getErrorPath(CTU::FileInfo::InvalidValueType::uninit,
                                             unsafeUsage,
-                                            callsMap,
+                                            callGraph,
                                             "Using argument ARG",
                                             &functionCall,
                                             false);
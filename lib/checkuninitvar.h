@@ -35,6 +35,7 @@
 #include <set>
 #include <string>
 
+class BinaryReader;
 class Scope;
 class Token;
 class Variable;
@@ -111,6 +112,8 @@ private:
 
     Check::FileInfo * loadFileInfoFromXml(const tinyxml2::XMLElement *xmlElement) const override;
 
+    Check::FileInfo * loadFileInfoFromBinary(BinaryReader &in) const override;
+
     /** @brief Analyse all file infos for all TU */
     bool analyseWholeProgram(const CTU::FileInfo *ctu, const std::list<Check::FileInfo*> &fileInfo, const Settings& settings, ErrorLogger &errorLogger) override;
 
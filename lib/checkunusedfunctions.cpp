@@ -33,7 +33,6 @@
 
 #include <algorithm>
 #include <cctype>
-#include <cstring>
 #include <fstream>
 #include <map>
 #include <sstream>
@@ -41,8 +40,6 @@
 #include <utility>
 #include <vector>
 
-#include "xml.h"
-
 //---------------------------------------------------------------------------
 
 static const CWE CWE561(561U);   // Dead Code
@@ -406,56 +403,17 @@ namespace {
     };
 }
 
-void CheckUnusedFunctions::analyseWholeProgram(const Settings &settings, ErrorLogger &errorLogger, const std::string &buildDir)
+void CheckUnusedFunctions::analyseWholeProgram(const Settings &settings, ErrorLogger &errorLogger, const std::list<AnalyzerInformation::FileInfoData> &fileInfoData)
 {
     std::map<std::string, Location> decls;
     std::set<std::string> calls;
 
-    const std::string filesTxt(buildDir + "/files.txt");
-    std::ifstream fin(filesTxt.c_str());
-    std::string filesTxtLine;
-    while (std::getline(fin, filesTxtLine)) {
-        const std::string::size_type firstColon = filesTxtLine.find(':');
-        if (firstColon == std::string::npos)
-            continue;
-        const std::string::size_type secondColon = filesTxtLine.find(':', firstColon+1);
-        if (secondColon == std::string::npos)
-            continue;
-        const std::string xmlfile = buildDir + '/' + filesTxtLine.substr(0,firstColon);
-        const std::string sourcefile = filesTxtLine.substr(secondColon+1);
-
-        tinyxml2::XMLDocument doc;
-        const tinyxml2::XMLError error = doc.LoadFile(xmlfile.c_str());
-        if (error != tinyxml2::XML_SUCCESS)
-            continue;
-
-        const tinyxml2::XMLElement * const rootNode = doc.FirstChildElement();
-        if (rootNode == nullptr)
-            continue;
-
-        for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
-            if (std::strcmp(e->Name(), "FileInfo") != 0)
-                continue;
-            const char *checkattr = e->Attribute("check");
-            if (checkattr == nullptr || std::strcmp(checkattr,"CheckUnusedFunctions") != 0)
-                continue;
-            for (const tinyxml2::XMLElement *e2 = e->FirstChildElement(); e2; e2 = e2->NextSiblingElement()) {
-                const char* functionName = e2->Attribute("functionName");
-                if (functionName == nullptr)
-                    continue;
-                if (std::strcmp(e2->Name(),"functioncall") == 0) {
-                    calls.insert(functionName);
-                    continue;
-                }
-                if (std::strcmp(e2->Name(),"functiondecl") == 0) {
-                    const char* lineNumber = e2->Attribute("lineNumber");
-                    if (lineNumber) {
-                        // cppcheck-suppress templateInstantiation - TODO: fix this - see #11631
-                        decls[functionName] = Location(sourcefile, strToInt<int>(lineNumber));
-                    }
-                }
-            }
+    for (const AnalyzerInformation::FileInfoData &data : fileInfoData) {
+        for (const std::pair<std::string, int> &functionDecl : data.functionDecls) {
+            // cppcheck-suppress templateInstantiation - TODO: fix this - see #11631
+            decls[functionDecl.first] = Location(data.sourcefile, functionDecl.second);
         }
+        calls.insert(data.functionCalls.cbegin(), data.functionCalls.cend());
     }
 
     for (std::map<std::string, Location>::const_iterator decl = decls.cbegin(); decl != decls.cend(); ++decl) {
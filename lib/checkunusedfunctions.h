@@ -22,6 +22,7 @@
 #define checkunusedfunctionsH
 //---------------------------------------------------------------------------
 
+#include "analyzerinfo.h"
 #include "config.h"
 
 #include <list>
@@ -54,7 +55,7 @@ public:
 
     std::string analyzerInfo() const;
 
-    static void analyseWholeProgram(const Settings &settings, ErrorLogger& errorLogger, const std::string &buildDir);
+    static void analyseWholeProgram(const Settings &settings, ErrorLogger& errorLogger, const std::list<AnalyzerInformation::FileInfoData> &fileInfoData);
 
     static void getErrorMessages(ErrorLogger &errorLogger) {
         unusedFunctionError(errorLogger, emptyString, 0, 0, "funcName");
@@ -19,6 +19,7 @@
 #include "cppcheck.h"
 
 #include "addoninfo.h"
+#include "binarydump.h"
 #include "check.h"
 #include "checkunusedfunctions.h"
 #include "clangimport.h"
@@ -26,12 +27,14 @@
 #include "ctu.h"
 #include "errortypes.h"
 #include "filesettings.h"
+#include "filestatistics.h"
 #include "library.h"
 #include "path.h"
 #include "platform.h"
 #include "preprocessor.h"
 #include "standards.h"
 #include "suppressions.h"
+#include "symboldatabase.h"
 #include "timer.h"
 #include "token.h"
 #include "tokenize.h"
@@ -41,16 +44,23 @@
 #include "version.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstdio>
 #include <cstdint>
 #include <cstring>
 #include <cctype>
+#include <chrono>
+#include <condition_variable>
 #include <cstdlib>
 #include <ctime>
 #include <exception> // IWYU pragma: keep
 #include <fstream>
+#include <functional>
+#include <future>
 #include <iostream> // <- TEMPORARY
+#include <memory>
+#include <mutex>
 #include <new>
 #include <set>
 #include <sstream>
@@ -82,6 +92,40 @@ static constexpr char FILELIST[] = "cppcheck-addon-ctu-file-list";
 
 static TimerResults s_timerResults;
 
+/** The timers of the files and configurations are only used for the trace */
+static SHOWTIME_MODES traceOnly(SHOWTIME_MODES showtime)
+{
+    return showtime == SHOWTIME_MODES::SHOWTIME_TRACE ? SHOWTIME_MODES::SHOWTIME_TRACE : SHOWTIME_MODES::SHOWTIME_NONE;
+}
+
+static HeaderTokenCache s_headerTokenCache;
+
+static std::mutex s_fileStatisticsSync;
+static std::vector<FileStatistics> s_fileStatistics;
+
+static std::unique_ptr<FileStatistics> createFileStatistics(const Tokenizer &tokenizer, const std::string &file, const std::string &cfg)
+{
+    std::unique_ptr<FileStatistics> statistics(new FileStatistics);
+    statistics->file = file;
+    statistics->configuration = cfg;
+    for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
+        ++statistics->tokens;
+        statistics->values += tok->values().size();
+    }
+    const SymbolDatabase *symbolDatabase = tokenizer.getSymbolDatabase();
+    if (symbolDatabase) {
+        statistics->scopes = symbolDatabase->scopeList.size();
+        for (const Scope &scope : symbolDatabase->scopeList)
+            statistics->functions += scope.functionList.size();
+    }
+    return statistics;
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
 // CWE ids used
 static const CWE CWE398(398U);  // Indicator of Poor Code Quality
 
@@ -154,6 +198,25 @@ static std::string getCtuInfoFileName(const std::string &dumpFile)
     return dumpFile.substr(0, dumpFile.size()-4) + "ctu-info";
 }
 
+/** Encode a fragment of the XML dump in the format of the dump file */
+static std::string encodeDump(const Settings& settings, std::string xml)
+{
+    if (settings.dumpFormat == Settings::DumpFormat::Binary)
+        return BinaryDump::encode(xml);
+    return xml;
+}
+
+/** The sections of the dump file that are used by the addons, --dump writes all of them */
+static std::uint8_t getDumpSections(const Settings& settings)
+{
+    if (settings.dump)
+        return AddonInfo::DumpAll;
+    std::uint8_t sections = 0;
+    for (const AddonInfo& addonInfo : settings.addonInfos)
+        sections |= addonInfo.dumpSections;
+    return sections;
+}
+
 static void createDumpFile(const Settings& settings,
                            const FileWithDetails& file,
                            std::ofstream& fdump,
@@ -163,9 +226,12 @@ static void createDumpFile(const Settings& settings,
         return;
     dumpFile = getDumpFileName(settings, file.spath());
 
-    fdump.open(dumpFile);
+    const bool binary = settings.dumpFormat == Settings::DumpFormat::Binary;
+    fdump.open(dumpFile, binary ? (std::ios::out | std::ios::binary) : std::ios::out);
     if (!fdump.is_open())
         return;
+    if (binary)
+        fdump << BinaryDump::magic();
 
     {
         std::ofstream fout(getCtuInfoFileName(dumpFile));
@@ -193,17 +259,19 @@ static void createDumpFile(const Settings& settings,
     }
     }
 
-    fdump << "<?xml version=\"1.0\"?>\n";
-    fdump << "<dumps" << language << ">\n";
-    fdump << "  <platform"
-          << " name=\"" << settings.platform.toString() << '\"'
-          << " char_bit=\"" << settings.platform.char_bit << '\"'
-          << " short_bit=\"" << settings.platform.short_bit << '\"'
-          << " int_bit=\"" << settings.platform.int_bit << '\"'
-          << " long_bit=\"" << settings.platform.long_bit << '\"'
-          << " long_long_bit=\"" << settings.platform.long_long_bit << '\"'
-          << " pointer_bit=\"" << (settings.platform.sizeof_pointer * settings.platform.char_bit) << '\"'
-          << "/>" << '\n';
+    std::ostringstream header;
+    header << "<?xml version=\"1.0\"?>\n";
+    header << "<dumps" << language << ">\n";
+    header << "  <platform"
+           << " name=\"" << settings.platform.toString() << '\"'
+           << " char_bit=\"" << settings.platform.char_bit << '\"'
+           << " short_bit=\"" << settings.platform.short_bit << '\"'
+           << " int_bit=\"" << settings.platform.int_bit << '\"'
+           << " long_bit=\"" << settings.platform.long_bit << '\"'
+           << " long_long_bit=\"" << settings.platform.long_long_bit << '\"'
+           << " pointer_bit=\"" << (settings.platform.sizeof_pointer * settings.platform.char_bit) << '\"'
+           << "/>" << '\n';
+    fdump << encodeDump(settings, header.str());
 }
 
 static std::string detectPython(const CppCheck::ExecuteCmdFn &executeCommand)
@@ -513,7 +581,7 @@ unsigned int CppCheck::checkClang(const FileWithDetails &file)
                              &s_timerResults);
         if (mSettings.debugnormal)
             tokenizer.printDebugOutput(1);
-        checkNormalTokens(tokenizer);
+        checkNormalTokens(tokenizer, *this, mFileInfo);
 
         // create dumpfile
         std::ofstream fdump;
@@ -521,17 +589,19 @@ unsigned int CppCheck::checkClang(const FileWithDetails &file)
         createDumpFile(mSettings, file, fdump, dumpFile);
         if (fdump.is_open()) {
             // TODO: use tinyxml2 to create XML
-            fdump << "<dump cfg=\"\">\n";
+            std::ostringstream dump;
+            dump << "<dump cfg=\"\">\n";
             for (const ErrorMessage& errmsg: compilerWarnings)
-                fdump << "  <clang-warning file=\"" << toxml(errmsg.callStack.front().getfile()) << "\" line=\"" << errmsg.callStack.front().line << "\" column=\"" << errmsg.callStack.front().column << "\" message=\"" << toxml(errmsg.shortMessage()) << "\"/>\n";
-            fdump << "  <standards>\n";
-            fdump << "    <c version=\"" << mSettings.standards.getC() << "\"/>\n";
-            fdump << "    <cpp version=\"" << mSettings.standards.getCPP() << "\"/>\n";
-            fdump << "  </standards>\n";
-            fdump << getLibraryDumpData();
-            tokenizer.dump(fdump);
-            fdump << "</dump>\n";
-            fdump << "</dumps>\n";
+                dump << "  <clang-warning file=\"" << toxml(errmsg.callStack.front().getfile()) << "\" line=\"" << errmsg.callStack.front().line << "\" column=\"" << errmsg.callStack.front().column << "\" message=\"" << toxml(errmsg.shortMessage()) << "\"/>\n";
+            dump << "  <standards>\n";
+            dump << "    <c version=\"" << mSettings.standards.getC() << "\"/>\n";
+            dump << "    <cpp version=\"" << mSettings.standards.getCPP() << "\"/>\n";
+            dump << "  </standards>\n";
+            dump << getLibraryDumpData();
+            tokenizer.dump(dump, getDumpSections(mSettings));
+            dump << "</dump>\n";
+            dump << "</dumps>\n";
+            fdump << encodeDump(mSettings, dump.str());
             fdump.close();
         }
 
@@ -608,6 +678,52 @@ unsigned int CppCheck::check(const FileSettings &fs)
     return returnValue;
 }
 
+// settings which affect the results stored in the build dir
+static void writeToolInfo(std::ostream &toolinfo, const Settings &settings, bool inlineSuppressions = true)
+{
+    toolinfo << CPPCHECK_VERSION_STRING;
+    toolinfo << (settings.severity.isEnabled(Severity::warning) ? 'w' : ' ');
+    toolinfo << (settings.severity.isEnabled(Severity::style) ? 's' : ' ');
+    toolinfo << (settings.severity.isEnabled(Severity::performance) ? 'p' : ' ');
+    toolinfo << (settings.severity.isEnabled(Severity::portability) ? 'p' : ' ');
+    toolinfo << (settings.severity.isEnabled(Severity::information) ? 'i' : ' ');
+    toolinfo << settings.userDefines;
+    if (inlineSuppressions) {
+        settings.supprs.nomsg.dump(toolinfo);
+    } else {
+        for (const SuppressionList::Suppression &s : settings.supprs.nomsg.getSuppressions()) {
+            if (!s.isInline)
+                toolinfo << s.getText() << ';';
+        }
+    }
+}
+
+// the settings which affect the result of a file whose dependencies are unchanged
+static std::size_t getDependenciesHash(const Settings &settings)
+{
+    // inline suppressions from previously checked files are not relevant - the ones in this file are covered by its timestamp
+    std::ostringstream toolinfo;
+    writeToolInfo(toolinfo, settings, false);
+    for (const std::string &I : settings.includePaths)
+        toolinfo << "-I" << I << ';';
+    for (const std::string &U : settings.userUndefs)
+        toolinfo << "-U" << U << ';';
+    for (const std::string &inc : settings.userIncludes)
+        toolinfo << "--include=" << inc << ';';
+    for (const std::string &lib : settings.libraries)
+        toolinfo << "--library=" << lib << ';';
+    const Platform &platform = settings.platform;
+    toolinfo << "--platform=" << platform.toString() << ':' << platform.char_bit << ',' << platform.short_bit << ','
+             << platform.int_bit << ',' << platform.long_bit << ',' << platform.long_long_bit << ','
+             << platform.sizeof_bool << ',' << platform.sizeof_short << ',' << platform.sizeof_int << ','
+             << platform.sizeof_long << ',' << platform.sizeof_long_long << ',' << platform.sizeof_float << ','
+             << platform.sizeof_double << ',' << platform.sizeof_long_double << ',' << platform.sizeof_wchar_t << ','
+             << platform.sizeof_size_t << ',' << platform.sizeof_pointer << ',' << platform.defaultSign << ';';
+    toolinfo << "--std=" << settings.standards.getC() << ";--std=" << settings.standards.getCPP() << ';';
+    toolinfo << "--check-level=" << (settings.checkLevel == Settings::CheckLevel::normal ? "normal" : "exhaustive") << ';';
+    return std::hash<std::string>{}(toolinfo.str());
+}
+
 static simplecpp::TokenList createTokenList(const std::string& filename, std::vector<std::string>& files, simplecpp::OutputList* outputList, std::istream* fileStream)
 {
     if (fileStream)
@@ -616,6 +732,155 @@ static simplecpp::TokenList createTokenList(const std::string& filename, std::ve
     return {filename, files, outputList};
 }
 
+namespace {
+    /** Forwards the output to an ErrorLogger that can be exchanged */
+    class ErrorLoggerForwarder : public ErrorLogger
+    {
+    public:
+        explicit ErrorLoggerForwarder(ErrorLogger &errorLogger)
+            : mErrorLogger(&errorLogger)
+        {}
+
+        void setErrorLogger(ErrorLogger &errorLogger)
+        {
+            mErrorLogger = &errorLogger;
+        }
+
+        void reportOut(const std::string &outmsg, Color c) override
+        {
+            mErrorLogger->reportOut(outmsg, c);
+        }
+
+        void reportErr(const ErrorMessage &msg) override
+        {
+            mErrorLogger->reportErr(msg);
+        }
+
+        void reportProgress(const std::string &filename, const char stage[], const std::size_t value) override
+        {
+            mErrorLogger->reportProgress(filename, stage, value);
+        }
+
+    private:
+        ErrorLogger *mErrorLogger;
+    };
+
+    /**
+     * Records the output of a single configuration so it can be reported
+     * in the order of the configurations. The progress is reported immediately.
+     */
+    class ConfigurationLogger : public ErrorLogger
+    {
+    public:
+        ConfigurationLogger(ErrorLogger &errorLogger, std::mutex &progressSync)
+            : mErrorLogger(errorLogger)
+            , mProgressSync(progressSync)
+        {}
+
+        void reportOut(const std::string &outmsg, Color c) override
+        {
+            mOutput.emplace_back();
+            mOutput.back().outmsg = outmsg;
+            mOutput.back().color = c;
+        }
+
+        void reportErr(const ErrorMessage &msg) override
+        {
+            mOutput.emplace_back();
+            mOutput.back().errmsg.reset(new ErrorMessage(msg));
+        }
+
+        void reportProgress(const std::string &filename, const char stage[], const std::size_t value) override
+        {
+            std::lock_guard<std::mutex> lg(mProgressSync);
+            mErrorLogger.reportProgress(filename, stage, value);
+        }
+
+        /** @brief Report the recorded output in the order it was recorded */
+        void replay(ErrorLogger &errorLogger)
+        {
+            for (const Output &output : mOutput) {
+                if (output.errmsg)
+                    errorLogger.reportErr(*output.errmsg);
+                else
+                    errorLogger.reportOut(output.outmsg, output.color);
+            }
+            mOutput.clear();
+        }
+
+    private:
+        struct Output {
+            std::string outmsg;
+            Color color = Color::Reset;
+            std::unique_ptr<ErrorMessage> errmsg;
+        };
+
+        ErrorLogger &mErrorLogger;
+        std::mutex &mProgressSync;
+        std::vector<Output> mOutput;
+    };
+
+    /** Lets the configurations pass a section one after another in the order of their index */
+    class OrderedSection
+    {
+    public:
+        /** Turn of a single configuration. The section is passed when it is destroyed at the latest. */
+        class Turn
+        {
+        public:
+            Turn(OrderedSection &section, std::size_t index)
+                : mSection(section)
+                , mIndex(index)
+            {}
+
+            Turn(const Turn &) = delete;
+            Turn& operator=(const Turn &) = delete;
+
+            ~Turn()
+            {
+                leave();
+            }
+
+            /** @brief Wait until all previous configurations have passed the section */
+            void enter()
+            {
+                if (mEntered)
+                    return;
+                std::unique_lock<std::mutex> lock(mSection.mSync);
+                mSection.mCondition.wait(lock, [this]() {
+                    return mSection.mNext == mIndex;
+                });
+                mEntered = true;
+            }
+
+            /** @brief Let the next configuration enter the section */
+            void leave()
+            {
+                if (mLeft)
+                    return;
+                enter();
+                {
+                    std::lock_guard<std::mutex> lg(mSection.mSync);
+                    ++mSection.mNext;
+                }
+                mSection.mCondition.notify_all();
+                mLeft = true;
+            }
+
+        private:
+            OrderedSection &mSection;
+            const std::size_t mIndex;
+            bool mEntered{};
+            bool mLeft{};
+        };
+
+    private:
+        std::mutex mSync;
+        std::condition_variable mCondition;
+        std::size_t mNext{};
+    };
+}
+
 unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string &cfgname, std::istream* fileStream)
 {
     // TODO: move to constructor when CppCheck no longer owns the settings
@@ -623,11 +888,16 @@ unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string
         mUnusedFunctionsCheck.reset(new CheckUnusedFunctions());
 
     mExitCode = 0;
+    mReusedResults = false;
 
     if (Settings::terminated())
         return mExitCode;
 
+    // the source file and the files it included
+    std::vector<std::string> files;
+
     const Timer fileTotalTimer(mSettings.showtime == SHOWTIME_MODES::SHOWTIME_FILE_TOTAL, file.spath());
+    const Timer fileTraceTimer(file.spath(), traceOnly(mSettings.showtime), &s_timerResults);
 
     if (!mSettings.quiet) {
         std::string fixedpath = Path::toNativeSeparators(file.spath());
@@ -675,8 +945,33 @@ unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string
             return EXIT_SUCCESS;
         }
 
+        // Reuse the stored results without preprocessing the file if it and all its includes are unchanged
+        std::size_t dependenciesHash = 0;
+        if (!mSettings.buildDir.empty() && !fileStream) {
+            dependenciesHash = getDependenciesHash(mSettings);
+
+            std::list<ErrorMessage> errors;
+            std::list<SuppressionList::Suppression> suppressions;
+            std::vector<RemarkComment> remarkComments;
+            std::map<Location, std::set<std::string>> locationMacros;
+            if (AnalyzerInformation::isUnchanged(mSettings.buildDir, file.spath(), cfgname, dependenciesHash, errors, suppressions, remarkComments, locationMacros)) {
+                // the inline suppressions are restored with their state after the analysis so the unmatched ones are reported the same way
+                for (SuppressionList::Suppression &suppression : suppressions)
+                    mSettings.supprs.nomsg.addSuppression(std::move(suppression));
+                mRemarkComments = std::move(remarkComments);
+                mLocationMacros = std::move(locationMacros);
+                while (!errors.empty()) {
+                    reportErr(errors.front());
+                    errors.pop_front();
+                }
+                mReusedResults = true;
+                reportUnmatchedSuppressions(file);
+                mErrorList.clear();
+                return mExitCode;  // known results => no need to reanalyze file
+            }
+        }
+
         simplecpp::OutputList outputList;
-        std::vector<std::string> files;
         simplecpp::TokenList tokens1 = createTokenList(file.spath(), files, &outputList, fileStream);
 
         // If there is a syntax error, report it and stop
@@ -701,7 +996,11 @@ unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string
             return mExitCode;
         }
 
-        Preprocessor preprocessor(mSettings, *this);
+        // while the configurations are preprocessed the output goes to the logger of the configuration
+        ErrorLoggerForwarder preprocessorLogger(*this);
+        Preprocessor preprocessor(mSettings, preprocessorLogger);
+        if (mSettings.cacheHeaders)
+            preprocessor.setHeaderCache(&s_headerTokenCache);
 
         if (!preprocessor.loadFiles(tokens1, files))
             return mExitCode;
@@ -718,8 +1017,9 @@ unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string
             mPlistFile << ErrorLogger::plistHeader(version(), files);
         }
 
+        const std::uint8_t dumpSections = getDumpSections(mSettings);
         std::string dumpProlog;
-        if (mSettings.dump || !mSettings.addons.empty()) {
+        if ((mSettings.dump || !mSettings.addons.empty()) && (dumpSections & AddonInfo::DumpRawTokens)) {
             dumpProlog += getDumpFileContentsRawTokens(files, tokens1);
         }
 
@@ -737,23 +1037,19 @@ unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string
         if (!mSettings.buildDir.empty()) {
             // Get toolinfo
             std::ostringstream toolinfo;
-            toolinfo << CPPCHECK_VERSION_STRING;
-            toolinfo << (mSettings.severity.isEnabled(Severity::warning) ? 'w' : ' ');
-            toolinfo << (mSettings.severity.isEnabled(Severity::style) ? 's' : ' ');
-            toolinfo << (mSettings.severity.isEnabled(Severity::performance) ? 'p' : ' ');
-            toolinfo << (mSettings.severity.isEnabled(Severity::portability) ? 'p' : ' ');
-            toolinfo << (mSettings.severity.isEnabled(Severity::information) ? 'i' : ' ');
-            toolinfo << mSettings.userDefines;
-            mSettings.supprs.nomsg.dump(toolinfo);
+            writeToolInfo(toolinfo, mSettings);
 
             // Calculate hash so it can be compared with old hash / future hashes
             const std::size_t hash = preprocessor.calculateHash(tokens1, toolinfo.str());
+            if (!fileStream)
+                mAnalyzerInformation.setDependencies(dependenciesHash, files, mSettings.includePaths);
             std::list<ErrorMessage> errors;
             if (!mAnalyzerInformation.analyzeFile(mSettings.buildDir, file.spath(), cfgname, hash, errors)) {
                 while (!errors.empty()) {
                     reportErr(errors.front());
                     errors.pop_front();
                 }
+                mReusedResults = true;
                 return mExitCode;  // known results => no need to reanalyze file
             }
         }
@@ -765,7 +1061,7 @@ unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string
         std::string dumpFile;
         createDumpFile(mSettings, file, fdump, dumpFile);
         if (fdump.is_open()) {
-            fdump << dumpProlog;
+            fdump << encodeDump(mSettings, std::move(dumpProlog));
             if (!mSettings.dump)
                 filesDeleter.addFile(dumpFile);
         }
@@ -804,7 +1100,7 @@ unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string
             std::istringstream istr2(code);
             // TODO: asserts when file has unknown extension
             tokenlist.createTokens(istr2, Path::identify(*files.begin(), false)); // TODO: check result?
-            executeRules("define", tokenlist);
+            executeRules("define", tokenlist, *this);
         }
 #endif
 
@@ -816,156 +1112,292 @@ unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string
             }
         }
 
+        // The configurations are checked by --config-jobs threads. They are preprocessed and compared
+        // with the previous configurations in their order and their output is reported in that order
+        // so the results are the same as when they are checked one after another.
+        struct ConfigurationResult {
+            ConfigurationResult(ErrorLogger &errorLogger, std::mutex &progressSync)
+                : logger(errorLogger, progressSync)
+            {}
+            ~ConfigurationResult() {
+                for (const Check::FileInfo *fi : fileInfo)
+                    delete fi;
+            }
+            ConfigurationLogger logger;
+            std::string cfg;
+            std::map<Location, std::set<std::string>> locationMacros;
+            std::string dump;
+            std::list<Check::FileInfo*> fileInfo;
+            std::unique_ptr<FileStatistics> statistics;
+            bool purged{};
+            bool terminated{};
+            std::exception_ptr exception;
+        };
+
+        const std::vector<std::string> configs(configurations.cbegin(), configurations.cend());
+        std::mutex progressSync;
+        std::vector<std::unique_ptr<ConfigurationResult>> results;
+        results.reserve(configs.size());
+        for (std::size_t i = 0; i < configs.size(); ++i)
+            results.emplace_back(new ConfigurationResult(*this, progressSync));
+
+        OrderedSection preprocessSection;
+        OrderedSection hashSection;
+        std::atomic<std::size_t> nextConfiguration{0};
+        std::atomic<bool> stop{false};
         std::set<unsigned long long> hashes;
         int checkCount = 0;
         bool hasValidConfig = false;
         std::list<std::string> configurationError;
-        for (const std::string &currCfg : configurations) {
-            // bail out if terminated
-            if (Settings::terminated())
-                break;
 
-            // Check only a few configurations (default 12), after that bail out, unless --force
-            // was used.
-            if (!mSettings.force && ++checkCount > mSettings.maxConfigs)
-                break;
-
-            if (!mSettings.userDefines.empty()) {
-                mCurrentConfig = mSettings.userDefines;
-                const std::vector<std::string> v1(split(mSettings.userDefines, ";"));
-                for (const std::string &cfg: split(currCfg, ";")) {
-                    if (std::find(v1.cbegin(), v1.cend(), cfg) == v1.cend()) {
-                        mCurrentConfig += ";" + cfg;
-                    }
-                }
-            } else {
-                mCurrentConfig = currCfg;
-            }
+        const bool writeDump = (mSettings.dump || !mSettings.addons.empty()) && fdump.is_open();
 
-            if (mSettings.preprocessOnly) {
-                Timer t("Preprocessor::getcode", mSettings.showtime, &s_timerResults);
-                std::string codeWithoutCfg = preprocessor.getcode(tokens1, mCurrentConfig, files, true);
-                t.stop();
-
-                if (startsWith(codeWithoutCfg,"#file"))
-                    codeWithoutCfg.insert(0U, "//");
-                std::string::size_type pos = 0;
-                while ((pos = codeWithoutCfg.find("\n#file",pos)) != std::string::npos)
-                    codeWithoutCfg.insert(pos+1U, "//");
-                pos = 0;
-                while ((pos = codeWithoutCfg.find("\n#endfile",pos)) != std::string::npos)
-                    codeWithoutCfg.insert(pos+1U, "//");
-                pos = 0;
-                while ((pos = codeWithoutCfg.find(Preprocessor::macroChar,pos)) != std::string::npos)
-                    codeWithoutCfg[pos] = ' ';
-                reportOut(codeWithoutCfg);
-                continue;
-            }
+        const auto checkConfiguration = [&](std::size_t i) {
+            const std::string &currCfg = configs[i];
+            ConfigurationResult &result = *results[i];
+            const Timer configTraceTimer(currCfg.empty() ? "Configuration" : ("Configuration: " + currCfg), traceOnly(mSettings.showtime), &s_timerResults);
+            OrderedSection::Turn hashTurn(hashSection, i);
+            const std::size_t peakMemoryBefore = mSettings.fileStatistics.empty() ? 0 : FileStatistics::peakMemory();
+            const auto setPeakMemoryDelta = [&]() {
+                if (result.statistics)
+                    result.statistics->peakMemoryDelta = std::max(FileStatistics::peakMemory(), peakMemoryBefore) - peakMemoryBefore;
+            };
 
-            Tokenizer tokenizer(mSettings, *this);
+            Tokenizer tokenizer(mSettings, result.logger);
             if (mSettings.showtime != SHOWTIME_MODES::SHOWTIME_NONE)
                 tokenizer.setTimerResults(&s_timerResults);
             tokenizer.setDirectives(directives); // TODO: how to avoid repeated copies?
 
             try {
-                // Create tokens, skip rest of iteration if failed
+                bool printConfiguration = false;
+                std::string preprocessorDump;
                 {
-                    Timer timer("Tokenizer::createTokens", mSettings.showtime, &s_timerResults);
-                    simplecpp::TokenList tokensP = preprocessor.preprocess(tokens1, mCurrentConfig, files, true);
-                    tokenizer.list.createTokens(std::move(tokensP));
+                    OrderedSection::Turn preprocessTurn(preprocessSection, i);
+                    preprocessTurn.enter();
+
+                    // bail out if terminated
+                    if (stop || Settings::terminated()) {
+                        stop = true;
+                        return;
+                    }
+
+                    // Check only a few configurations (default 12), after that bail out, unless --force
+                    // was used.
+                    if (!mSettings.force && ++checkCount > mSettings.maxConfigs) {
+                        stop = true;
+                        return;
+                    }
+
+                    if (!mSettings.userDefines.empty()) {
+                        result.cfg = mSettings.userDefines;
+                        const std::vector<std::string> v1(split(mSettings.userDefines, ";"));
+                        for (const std::string &cfg: split(currCfg, ";")) {
+                            if (std::find(v1.cbegin(), v1.cend(), cfg) == v1.cend()) {
+                                result.cfg += ";" + cfg;
+                            }
+                        }
+                    } else {
+                        result.cfg = currCfg;
+                    }
+
+                    preprocessorLogger.setErrorLogger(result.logger);
+
+                    if (mSettings.preprocessOnly) {
+                        Timer t("Preprocessor::getcode", mSettings.showtime, &s_timerResults);
+                        std::string codeWithoutCfg = preprocessor.getcode(tokens1, result.cfg, files, true);
+                        t.stop();
+
+                        if (startsWith(codeWithoutCfg,"#file"))
+                            codeWithoutCfg.insert(0U, "//");
+                        std::string::size_type pos = 0;
+                        while ((pos = codeWithoutCfg.find("\n#file",pos)) != std::string::npos)
+                            codeWithoutCfg.insert(pos+1U, "//");
+                        pos = 0;
+                        while ((pos = codeWithoutCfg.find("\n#endfile",pos)) != std::string::npos)
+                            codeWithoutCfg.insert(pos+1U, "//");
+                        pos = 0;
+                        while ((pos = codeWithoutCfg.find(Preprocessor::macroChar,pos)) != std::string::npos)
+                            codeWithoutCfg[pos] = ' ';
+                        result.logger.reportOut(codeWithoutCfg, Color::Reset);
+                        return;
+                    }
+
+                    // Create tokens, skip rest of iteration if failed
+                    try {
+                        Timer timer("Tokenizer::createTokens", mSettings.showtime, &s_timerResults);
+                        simplecpp::TokenList tokensP = preprocessor.preprocess(tokens1, result.cfg, files, true);
+                        tokenizer.list.createTokens(std::move(tokensP));
+                    } catch (const simplecpp::Output &o) {
+                        // #error etc during preprocessing
+                        configurationError.push_back((result.cfg.empty() ? "\'\'" : result.cfg) + " : [" + o.location.file() + ':' + std::to_string(o.location.line) + "] " + o.msg);
+                        --checkCount; // don't count invalid configurations
+
+                        if (!hasValidConfig && currCfg == *configurations.rbegin()) {
+                            // If there is no valid configuration then report error..
+                            std::string locfile = Path::fromNativeSeparators(o.location.file());
+                            if (mSettings.relativePaths)
+                                locfile = Path::getRelativePath(locfile, mSettings.basePaths);
+
+                            ErrorMessage::FileLocation loc1(locfile, o.location.line, o.location.col);
+
+                            ErrorMessage errmsg({std::move(loc1)},
+                                                file.spath(),
+                                                Severity::error,
+                                                o.msg,
+                                                "preprocessorErrorDirective",
+                                                Certainty::normal);
+                            result.logger.reportErr(errmsg);
+                        }
+                        return;
+                    }
+                    hasValidConfig = true;
+                    printConfiguration = !result.cfg.empty() || checkCount > 1;
+
+                    // the macro usage of the configuration is only available until the next one is preprocessed
+                    if (writeDump && (dumpSections & AddonInfo::DumpDirectives)) {
+                        std::ostringstream oss;
+                        preprocessor.dump(oss);
+                        preprocessorDump = oss.str();
+                    }
                 }
-                hasValidConfig = true;
 
                 // locations macros
-                mLocationMacros.clear();
                 for (const Token* tok = tokenizer.tokens(); tok; tok = tok->next()) {
                     if (!tok->getMacroName().empty())
-                        mLocationMacros[Location(files[tok->fileIndex()], tok->linenr())].emplace(tok->getMacroName());
+                        result.locationMacros[Location(tokenizer.list.getFiles()[tok->fileIndex()], tok->linenr())].emplace(tok->getMacroName());
                 }
 
                 // If only errors are printed, print filename after the check
-                if (!mSettings.quiet && (!mCurrentConfig.empty() || checkCount > 1)) {
+                if (!mSettings.quiet && printConfiguration) {
                     std::string fixedpath = Path::toNativeSeparators(file.spath());
-                    mErrorLogger.reportOut("Checking " + fixedpath + ": " + mCurrentConfig + "...", Color::FgGreen);
+                    result.logger.reportOut("Checking " + fixedpath + ": " + result.cfg + "...", Color::FgGreen);
                 }
 
                 if (!tokenizer.tokens())
-                    continue;
+                    return;
 
                 // skip rest of iteration if just checking configuration
                 if (mSettings.checkConfiguration)
-                    continue;
+                    return;
 
 #ifdef HAVE_RULES
                 // Execute rules for "raw" code
-                executeRules("raw", tokenizer.list);
+                executeRules("raw", tokenizer.list, result.logger);
 #endif
 
                 // Simplify tokens into normal form, skip rest of iteration if failed
-                if (!tokenizer.simplifyTokens1(mCurrentConfig))
-                    continue;
+                const auto simplifyStart = std::chrono::steady_clock::now();
+                if (!tokenizer.simplifyTokens1(result.cfg))
+                    return;
+                if (!mSettings.fileStatistics.empty()) {
+                    result.statistics = createFileStatistics(tokenizer, file.spath(), result.cfg);
+                    result.statistics->simplifyTokensSeconds = secondsSince(simplifyStart);
+                }
 
                 // dump xml if --dump
-                if ((mSettings.dump || !mSettings.addons.empty()) && fdump.is_open()) {
-                    fdump << "<dump cfg=\"" << ErrorLogger::toxml(mCurrentConfig) << "\">" << std::endl;
-                    fdump << "  <standards>" << std::endl;
-                    fdump << "    <c version=\"" << mSettings.standards.getC() << "\"/>" << std::endl;
-                    fdump << "    <cpp version=\"" << mSettings.standards.getCPP() << "\"/>" << std::endl;
-                    fdump << "  </standards>" << std::endl;
-                    fdump << getLibraryDumpData();
-                    preprocessor.dump(fdump);
-                    tokenizer.dump(fdump);
-                    fdump << "</dump>" << std::endl;
+                if (writeDump) {
+                    std::ostringstream fdumpCfg;
+                    fdumpCfg << "<dump cfg=\"" << ErrorLogger::toxml(result.cfg) << "\">" << std::endl;
+                    fdumpCfg << "  <standards>" << std::endl;
+                    fdumpCfg << "    <c version=\"" << mSettings.standards.getC() << "\"/>" << std::endl;
+                    fdumpCfg << "    <cpp version=\"" << mSettings.standards.getCPP() << "\"/>" << std::endl;
+                    fdumpCfg << "  </standards>" << std::endl;
+                    fdumpCfg << getLibraryDumpData();
+                    fdumpCfg << preprocessorDump;
+                    tokenizer.dump(fdumpCfg, dumpSections);
+                    fdumpCfg << "</dump>" << std::endl;
+                    result.dump = encodeDump(mSettings, fdumpCfg.str());
                 }
 
-                // Need to call this even if the hash will skip this configuration
-                mSettings.supprs.nomsg.markUnmatchedInlineSuppressionsAsChecked(tokenizer);
-
-                // Skip if we already met the same simplified token list
-                if (mSettings.force || mSettings.maxConfigs > 1) {
-                    const std::size_t hash = tokenizer.list.calculateHash();
-                    if (hashes.find(hash) != hashes.end()) {
-                        if (mSettings.debugwarnings)
-                            purgedConfigurationMessage(file.spath(), mCurrentConfig);
-                        continue;
+                {
+                    hashTurn.enter();
+
+                    // Need to call this even if the hash will skip this configuration
+                    mSettings.supprs.nomsg.markUnmatchedInlineSuppressionsAsChecked(tokenizer);
+
+                    // Skip if we already met the same simplified token list
+                    if (mSettings.force || mSettings.maxConfigs > 1) {
+                        const std::size_t hash = tokenizer.list.calculateHash();
+                        if (hashes.find(hash) != hashes.end()) {
+                            result.purged = true;
+                            setPeakMemoryDelta();
+                            return;
+                        }
+                        hashes.insert(hash);
                     }
-                    hashes.insert(hash);
-                }
 
-                // Check normal tokens
-                checkNormalTokens(tokenizer);
-            } catch (const simplecpp::Output &o) {
-                // #error etc during preprocessing
-                configurationError.push_back((mCurrentConfig.empty() ? "\'\'" : mCurrentConfig) + " : [" + o.location.file() + ':' + std::to_string(o.location.line) + "] " + o.msg);
-                --checkCount; // don't count invalid configurations
-
-                if (!hasValidConfig && currCfg == *configurations.rbegin()) {
-                    // If there is no valid configuration then report error..
-                    std::string locfile = Path::fromNativeSeparators(o.location.file());
-                    if (mSettings.relativePaths)
-                        locfile = Path::getRelativePath(locfile, mSettings.basePaths);
-
-                    ErrorMessage::FileLocation loc1(locfile, o.location.line, o.location.col);
-
-                    ErrorMessage errmsg({std::move(loc1)},
-                                        file.spath(),
-                                        Severity::error,
-                                        o.msg,
-                                        "preprocessorErrorDirective",
-                                        Certainty::normal);
-                    reportErr(errmsg);
+                    hashTurn.leave();
                 }
-                continue;
 
+                // Check normal tokens
+                const auto checksStart = std::chrono::steady_clock::now();
+                checkNormalTokens(tokenizer, result.logger, result.fileInfo);
+                if (result.statistics)
+                    result.statistics->checksSeconds = secondsSince(checksStart);
+                setPeakMemoryDelta();
             } catch (const TerminateException &) {
                 // Analysis is terminated
-                return mExitCode;
-
+                result.terminated = true;
+                stop = true;
             } catch (const InternalError &e) {
                 ErrorMessage errmsg = ErrorMessage::fromInternalError(e, &tokenizer.list, file.spath());
-                reportErr(errmsg);
+                result.logger.reportErr(errmsg);
+            }
+        };
+
+        const auto checkConfigurations = [&]() {
+            for (std::size_t i = nextConfiguration++; i < configs.size(); i = nextConfiguration++) {
+                try {
+                    checkConfiguration(i);
+                } catch (...) {
+                    // the following configurations would not have been checked one after another either
+                    results[i]->exception = std::current_exception();
+                    stop = true;
+                }
+            }
+        };
+
+        // report the output of a configuration, returns false if the analysis has been terminated
+        const auto reportConfiguration = [&](ConfigurationResult &result) {
+            mCurrentConfig = result.cfg;
+            mLocationMacros = std::move(result.locationMacros);
+            result.logger.replay(*this);
+            if (result.purged && mSettings.debugwarnings)
+                purgedConfigurationMessage(file.spath(), mCurrentConfig);
+            if (fdump.is_open())
+                fdump << result.dump;
+            mFileInfo.splice(mFileInfo.end(), result.fileInfo);
+            if (result.statistics) {
+                std::lock_guard<std::mutex> guard(s_fileStatisticsSync);
+                s_fileStatistics.push_back(std::move(*result.statistics));
+            }
+            if (result.exception)
+                std::rethrow_exception(result.exception);
+            return !result.terminated;
+        };
+
+        const std::size_t threads = std::min<std::size_t>(mSettings.configJobs, configs.size());
+        if (threads <= 1) {
+            for (std::size_t i = 0; i < configs.size(); ++i) {
+                checkConfiguration(i);
+                if (!reportConfiguration(*results[i]))
+                    return mExitCode;
+            }
+        } else {
+            std::vector<std::future<void>> futures;
+            futures.reserve(threads);
+            for (std::size_t t = 1; t < threads; ++t)
+                futures.emplace_back(std::async(std::launch::async, checkConfigurations));
+            checkConfigurations();
+            for (std::future<void> &f : futures)
+                f.get();
+
+            for (const std::unique_ptr<ConfigurationResult> &result : results) {
+                if (!reportConfiguration(*result))
+                    return mExitCode;
             }
         }
+        preprocessorLogger.setErrorLogger(*this);
 
         if (!hasValidConfig && configurations.size() > 1 && mSettings.severity.isEnabled(Severity::information)) {
             std::string msg;
@@ -987,7 +1419,7 @@ unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string
 
         // dumped all configs, close root </dumps> element now
         if (fdump.is_open()) {
-            fdump << "</dumps>" << std::endl;
+            fdump << encodeDump(mSettings, "</dumps>\n");
             fdump.close();
         }
 
@@ -1006,23 +1438,37 @@ unsigned int CppCheck::checkFile(const FileWithDetails& file, const std::string
     }
 
     if (!mSettings.buildDir.empty()) {
+        std::set<std::string> fileNames;
+        for (const std::string &f : files)
+            fileNames.insert(Preprocessor::getRelativeFilename(f, mSettings));
+        std::list<SuppressionList::Suppression> suppressions;
+        for (const SuppressionList::Suppression &s : mSettings.supprs.nomsg.getSuppressions()) {
+            if (s.isInline && fileNames.count(s.fileName) > 0)
+                suppressions.push_back(s);
+        }
+        mAnalyzerInformation.setSuppressionsAndRemarks(suppressions, mRemarkComments);
         mAnalyzerInformation.close();
     }
 
-    // In jointSuppressionReport mode, unmatched suppressions are
-    // collected after all files are processed
-    if (!mSettings.useSingleJob() && (mSettings.severity.isEnabled(Severity::information) || mSettings.checkConfiguration)) {
-        SuppressionList::reportUnmatchedSuppressions(mSettings.supprs.nomsg.getUnmatchedLocalSuppressions(file, (bool)mUnusedFunctionsCheck), *this);
-    }
+    reportUnmatchedSuppressions(file);
 
     mErrorList.clear();
 
     if (mSettings.showtime == SHOWTIME_MODES::SHOWTIME_FILE || mSettings.showtime == SHOWTIME_MODES::SHOWTIME_TOP5_FILE)
-        printTimerResults(mSettings.showtime);
+        printTimerResults(mSettings.showtime, mErrorLogger);
 
     return mExitCode;
 }
 
+void CppCheck::reportUnmatchedSuppressions(const FileWithDetails &file)
+{
+    // In jointSuppressionReport mode, unmatched suppressions are
+    // collected after all files are processed
+    if (!mSettings.useSingleJob() && (mSettings.severity.isEnabled(Severity::information) || mSettings.checkConfiguration)) {
+        SuppressionList::reportUnmatchedSuppressions(mSettings.supprs.nomsg.getUnmatchedLocalSuppressions(file, (bool)mUnusedFunctionsCheck), *this);
+    }
+}
+
 // TODO: replace with ErrorMessage::fromInternalError()
 void CppCheck::internalError(const std::string &filename, const std::string &msg)
 {
@@ -1040,11 +1486,191 @@ void CppCheck::internalError(const std::string &filename, const std::string &msg
     mErrorLogger.reportErr(errmsg);
 }
 
+void CppCheck::checksMaxTimeExceeded(const Tokenizer &tokenizer, ErrorLogger &errorLogger) const
+{
+    if (!mSettings.debugwarnings)
+        return;
+    ErrorMessage::FileLocation loc(tokenizer.list.getFiles()[0], 0, 0);
+    ErrorMessage errmsg({std::move(loc)},
+                        emptyString,
+                        Severity::debug,
+                        "Checks maximum time exceeded",
+                        "checksMaxTime",
+                        Certainty::normal);
+    errorLogger.reportErr(errmsg);
+}
+
+namespace {
+    /**
+     * Collects the findings of a single check which runs in a worker thread.
+     * The findings are reported after all checks are done so the output does
+     * not depend on the scheduling of the threads.
+     */
+    class CheckResultCollector : public ErrorLogger
+    {
+    public:
+        CheckResultCollector(ErrorLogger &errorLogger, std::mutex &outSync)
+            : mErrorLogger(errorLogger)
+            , mOutSync(outSync)
+        {}
+
+        void reportOut(const std::string &outmsg, Color c) override
+        {
+            std::lock_guard<std::mutex> lg(mOutSync);
+            mErrorLogger.reportOut(outmsg, c);
+        }
+
+        void reportErr(const ErrorMessage &msg) override
+        {
+            errors.push_back(msg);
+        }
+
+        std::vector<ErrorMessage> errors;
+
+    private:
+        ErrorLogger &mErrorLogger;
+        std::mutex &mOutSync;
+    };
+}
+
+bool CppCheck::runChecksParallel(const Tokenizer &tokenizer, ErrorLogger &errorLogger, std::time_t maxTime)
+{
+    struct CheckResult {
+        std::vector<ErrorMessage> errors;
+        std::exception_ptr exception;
+        bool done{};
+    };
+
+    // cppcheck-suppress shadowFunction - TODO: fix this
+    const std::vector<Check *> checks(Check::instances().cbegin(), Check::instances().cend());
+    std::vector<CheckResult> results(checks.size());
+    std::atomic<std::size_t> nextCheck{0};
+    std::atomic<bool> stop{false};
+    std::atomic<bool> timeout{false};
+    std::mutex outSync;
+
+    // each worker picks the next check which has not been started yet
+    const auto worker = [&]() {
+        for (std::size_t i = nextCheck++; i < checks.size(); i = nextCheck++) {
+            if (stop || Settings::terminated())
+                return;
+
+            if (maxTime > 0 && std::time(nullptr) > maxTime) {
+                timeout = true;
+                stop = true;
+                return;
+            }
+
+            CheckResultCollector collector(errorLogger, outSync);
+            try {
+                Timer timerRunChecks(checks[i]->name() + "::runChecks", mSettings.showtime, &s_timerResults);
+                checks[i]->runChecks(tokenizer, &collector);
+            } catch (...) {
+                // later checks would not have been run in sequential mode either
+                results[i].exception = std::current_exception();
+                stop = true;
+            }
+            results[i].errors = std::move(collector.errors);
+            results[i].done = true;
+        }
+    };
+
+    const std::size_t threads = std::min<std::size_t>(mSettings.checksJobs, checks.size());
+    std::vector<std::future<void>> futures;
+    futures.reserve(threads);
+    for (std::size_t t = 1; t < threads; ++t)
+        futures.emplace_back(std::async(std::launch::async, worker));
+    worker();
+    for (std::future<void> &f : futures)
+        f.get();
+
+    // report in the order of the checks until the first one which was not completed
+    for (const CheckResult &result : results) {
+        if (!result.done)
+            break;
+        for (const ErrorMessage &errmsg : result.errors)
+            errorLogger.reportErr(errmsg);
+        if (result.exception)
+            std::rethrow_exception(result.exception);
+    }
+
+    if (Settings::terminated())
+        return false;
+
+    if (timeout) {
+        checksMaxTimeExceeded(tokenizer, errorLogger);
+        return false;
+    }
+
+    return true;
+}
+
+namespace {
+    /** A whole program analysis, it returns true if an error is reported */
+    using WholeProgramTask = std::function<bool(ErrorLogger &errorLogger)>;
+}
+
+static void runWorkers(unsigned int threads, const std::function<void()> &worker)
+{
+    std::vector<std::future<void>> futures;
+    futures.reserve(threads);
+    for (unsigned int t = 1; t < threads; ++t)
+        futures.emplace_back(std::async(std::launch::async, worker));
+    worker();
+    for (std::future<void> &f : futures)
+        f.get();
+}
+
+/**
+ * Run the whole program analyses using @p threads threads. The findings
+ * are reported in the order of the tasks after all of them are done.
+ */
+static bool runWholeProgramTasks(const std::vector<WholeProgramTask> &tasks, unsigned int threads, ErrorLogger &errorLogger)
+{
+    bool foundErrors = false;
+    if (threads <= 1 || tasks.size() <= 1) {
+        for (const WholeProgramTask &task : tasks)
+            foundErrors |= task(errorLogger);
+        return foundErrors;
+    }
+
+    struct TaskResult {
+        std::vector<ErrorMessage> errors;
+        std::exception_ptr exception;
+        bool foundErrors{};
+    };
+
+    std::vector<TaskResult> results(tasks.size());
+    std::atomic<std::size_t> nextTask{0};
+    std::mutex outSync;
+
+    runWorkers(static_cast<unsigned int>(std::min<std::size_t>(threads, tasks.size())), [&]() {
+        for (std::size_t i = nextTask++; i < tasks.size(); i = nextTask++) {
+            CheckResultCollector collector(errorLogger, outSync);
+            try {
+                results[i].foundErrors = tasks[i](collector);
+            } catch (...) {
+                results[i].exception = std::current_exception();
+            }
+            results[i].errors = std::move(collector.errors);
+        }
+    });
+
+    for (const TaskResult &result : results) {
+        for (const ErrorMessage &errmsg : result.errors)
+            errorLogger.reportErr(errmsg);
+        if (result.exception)
+            std::rethrow_exception(result.exception);
+        foundErrors |= result.foundErrors;
+    }
+    return foundErrors;
+}
+
 //---------------------------------------------------------------------------
 // CppCheck - A function that checks a normal token list
 //---------------------------------------------------------------------------
 
-void CppCheck::checkNormalTokens(const Tokenizer &tokenizer)
+void CppCheck::checkNormalTokens(const Tokenizer &tokenizer, ErrorLogger &errorLogger, std::list<Check::FileInfo*> &fileInfo)
 {
     CheckUnusedFunctions unusedFunctionsChecker;
 
@@ -1056,27 +1682,23 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer)
         const std::time_t maxTime = mSettings.checksMaxTime > 0 ? std::time(nullptr) + mSettings.checksMaxTime : 0;
 
         // call all "runChecks" in all registered Check classes
-        // cppcheck-suppress shadowFunction - TODO: fix this
-        for (Check *check : Check::instances()) {
-            if (Settings::terminated())
+        if (mSettings.checksJobs > 1) {
+            if (!runChecksParallel(tokenizer, errorLogger, maxTime))
                 return;
+        } else {
+            // cppcheck-suppress shadowFunction - TODO: fix this
+            for (Check *check : Check::instances()) {
+                if (Settings::terminated())
+                    return;
 
-            if (maxTime > 0 && std::time(nullptr) > maxTime) {
-                if (mSettings.debugwarnings) {
-                    ErrorMessage::FileLocation loc(tokenizer.list.getFiles()[0], 0, 0);
-                    ErrorMessage errmsg({std::move(loc)},
-                                        emptyString,
-                                        Severity::debug,
-                                        "Checks maximum time exceeded",
-                                        "checksMaxTime",
-                                        Certainty::normal);
-                    reportErr(errmsg);
+                if (maxTime > 0 && std::time(nullptr) > maxTime) {
+                    checksMaxTimeExceeded(tokenizer, errorLogger);
+                    return;
                 }
-                return;
-            }
 
-            Timer timerRunChecks(check->name() + "::runChecks", mSettings.showtime, &s_timerResults);
-            check->runChecks(tokenizer, this);
+                Timer timerRunChecks(check->name() + "::runChecks", mSettings.showtime, &s_timerResults);
+                check->runChecks(tokenizer, &errorLogger);
+            }
         }
     }
 
@@ -1084,6 +1706,7 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer)
         unusedFunctionsChecker.parseTokens(tokenizer, mSettings);
     }
     if (mUnusedFunctionsCheck && mSettings.useSingleJob() && mSettings.buildDir.empty()) {
+        std::lock_guard<std::mutex> lg(mAnalysisSync);
         mUnusedFunctionsCheck->parseTokens(tokenizer, mSettings);
     }
 
@@ -1096,10 +1719,12 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer)
         // Analyse the tokens..
 
         if (CTU::FileInfo * const fi1 = CTU::getFileInfo(tokenizer)) {
-            if (!mSettings.buildDir.empty())
+            if (!mSettings.buildDir.empty()) {
+                std::lock_guard<std::mutex> lg(mAnalysisSync);
                 mAnalyzerInformation.setFileInfo("ctu", fi1->toString());
+            }
             if (mSettings.useSingleJob())
-                mFileInfo.push_back(fi1);
+                fileInfo.push_back(fi1);
             else
                 delete fi1;
         }
@@ -1108,10 +1733,12 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer)
             // cppcheck-suppress shadowFunction - TODO: fix this
             for (const Check *check : Check::instances()) {
                 if (Check::FileInfo * const fi = check->getFileInfo(tokenizer, mSettings)) {
-                    if (!mSettings.buildDir.empty())
+                    if (!mSettings.buildDir.empty()) {
+                        std::lock_guard<std::mutex> lg(mAnalysisSync);
                         mAnalyzerInformation.setFileInfo(check->name(), fi->toString());
+                    }
                     if (mSettings.useSingleJob())
-                        mFileInfo.push_back(fi);
+                        fileInfo.push_back(fi);
                     else
                         delete fi;
                 }
@@ -1120,11 +1747,12 @@ void CppCheck::checkNormalTokens(const Tokenizer &tokenizer)
     }
 
     if (mSettings.checks.isEnabled(Checks::unusedFunction) && !mSettings.buildDir.empty()) {
+        std::lock_guard<std::mutex> lg(mAnalysisSync);
         mAnalyzerInformation.setFileInfo("CheckUnusedFunctions", unusedFunctionsChecker.analyzerInfo());
     }
 
 #ifdef HAVE_RULES
-    executeRules("normal", tokenizer.list);
+    executeRules("normal", tokenizer.list, errorLogger);
 #endif
 }
 
@@ -1267,7 +1895,7 @@ static const char * pcreErrorCodeToString(const int pcreExecRet)
     return "";
 }
 
-void CppCheck::executeRules(const std::string &tokenlist, const TokenList &list)
+void CppCheck::executeRules(const std::string &tokenlist, const TokenList &list, ErrorLogger &errorLogger)
 {
     // There is no rule to execute
     if (!hasRule(tokenlist))
@@ -1285,7 +1913,7 @@ void CppCheck::executeRules(const std::string &tokenlist, const TokenList &list)
             continue;
 
         if (!mSettings.quiet) {
-            reportOut("Processing rule: " + rule.pattern, Color::FgGreen);
+            errorLogger.reportOut("Processing rule: " + rule.pattern, Color::FgGreen);
         }
 
         const char *pcreCompileErrorStr = nullptr;
@@ -1301,7 +1929,7 @@ void CppCheck::executeRules(const std::string &tokenlist, const TokenList &list)
                                           "pcre_compile",
                                           Certainty::normal);
 
-                reportErr(errmsg);
+                errorLogger.reportErr(errmsg);
             }
             continue;
         }
@@ -1322,7 +1950,7 @@ void CppCheck::executeRules(const std::string &tokenlist, const TokenList &list)
                                       "pcre_study",
                                       Certainty::normal);
 
-            reportErr(errmsg);
+            errorLogger.reportErr(errmsg);
             // pcre_compile() worked, but pcre_study() returned an error. Free the resources allocated by pcre_compile().
             pcre_free(re);
             continue;
@@ -1345,7 +1973,7 @@ void CppCheck::executeRules(const std::string &tokenlist, const TokenList &list)
                                               "pcre_exec",
                                               Certainty::normal);
 
-                    reportErr(errmsg);
+                    errorLogger.reportErr(errmsg);
                 }
                 break;
             }
@@ -1382,7 +2010,7 @@ void CppCheck::executeRules(const std::string &tokenlist, const TokenList &list)
                                       Certainty::normal);
 
             // Report error
-            reportErr(errmsg);
+            errorLogger.reportErr(errmsg);
         }
 
         pcre_free(re);
@@ -1631,7 +2259,7 @@ void CppCheck::reportErr(const ErrorMessage &msg)
         return;
 
     if (!mSettings.buildDir.empty())
-        mAnalyzerInformation.reportErr(msg);
+        mAnalyzerInformation.reportErr(msg, macroNames);
 
     if (!mSettings.supprs.nofail.isSuppressed(errorMessage) && !mSettings.supprs.nomsg.isSuppressed(errorMessage)) {
         mExitCode = 1;
@@ -1792,12 +2420,19 @@ bool CppCheck::analyseWholeProgram()
         }
     }
 
+    std::vector<WholeProgramTask> tasks;
     // cppcheck-suppress shadowFunction - TODO: fix this
-    for (Check *check : Check::instances())
-        errors |= check->analyseWholeProgram(&ctu, mFileInfo, mSettings, *this);  // TODO: ctu
-
-    if (mUnusedFunctionsCheck)
-        errors |= mUnusedFunctionsCheck->check(mSettings, *this);
+    for (Check *check : Check::instances()) {
+        tasks.emplace_back([&, check](ErrorLogger &errorLogger) {
+            return check->analyseWholeProgram(&ctu, mFileInfo, mSettings, errorLogger);  // TODO: ctu
+        });
+    }
+    if (mUnusedFunctionsCheck) {
+        tasks.emplace_back([this](ErrorLogger &errorLogger) {
+            return mUnusedFunctionsCheck->check(mSettings, errorLogger);
+        });
+    }
+    errors = runWholeProgramTasks(tasks, mSettings.checksJobs, *this);
 
     return errors && (mExitCode > 0);
 }
@@ -1809,65 +2444,41 @@ unsigned int CppCheck::analyseWholeProgram(const std::string &buildDir, const st
         removeCtuInfoFiles(files, fileSettings);
         return mExitCode;
     }
-    if (mSettings.checks.isEnabled(Checks::unusedFunction))
-        CheckUnusedFunctions::analyseWholeProgram(mSettings, *this, buildDir);
-    std::list<Check::FileInfo*> fileInfoList;
-    CTU::FileInfo ctuFileInfo;
-
     // Load all analyzer info data..
-    const std::string filesTxt(buildDir + "/files.txt");
-    std::ifstream fin(filesTxt);
-    std::string filesTxtLine;
-    while (std::getline(fin, filesTxtLine)) {
-        const std::string::size_type firstColon = filesTxtLine.find(':');
-        if (firstColon == std::string::npos)
-            continue;
-        const std::string::size_type lastColon = filesTxtLine.rfind(':');
-        if (firstColon == lastColon)
-            continue;
-        const std::string xmlfile = buildDir + '/' + filesTxtLine.substr(0,firstColon);
-        //const std::string sourcefile = filesTxtLine.substr(lastColon+1);
+    std::list<AnalyzerInformation::FileInfoData> fileInfoData = AnalyzerInformation::loadFileInfo(buildDir, mSettings.jobs);
 
-        tinyxml2::XMLDocument doc;
-        const tinyxml2::XMLError error = doc.LoadFile(xmlfile.c_str());
-        if (error != tinyxml2::XML_SUCCESS)
-            continue;
-
-        const tinyxml2::XMLElement * const rootNode = doc.FirstChildElement();
-        if (rootNode == nullptr)
-            continue;
-
-        for (const tinyxml2::XMLElement *e = rootNode->FirstChildElement(); e; e = e->NextSiblingElement()) {
-            if (std::strcmp(e->Name(), "FileInfo") != 0)
-                continue;
-            const char *checkClassAttr = e->Attribute("check");
-            if (!checkClassAttr)
-                continue;
-            if (std::strcmp(checkClassAttr, "ctu") == 0) {
-                ctuFileInfo.loadFromXml(e);
-                continue;
-            }
-            // cppcheck-suppress shadowFunction - TODO: fix this
-            for (const Check *check : Check::instances()) {
-                if (checkClassAttr == check->name())
-                    fileInfoList.push_back(check->loadFileInfoFromXml(e));
-            }
-        }
+    std::list<Check::FileInfo*> fileInfoList;
+    CTU::FileInfo ctuFileInfo;
+    for (AnalyzerInformation::FileInfoData &data : fileInfoData) {
+        ctuFileInfo.functionCalls.splice(ctuFileInfo.functionCalls.end(), data.ctu->functionCalls);
+        ctuFileInfo.nestedCalls.splice(ctuFileInfo.nestedCalls.end(), data.ctu->nestedCalls);
+        for (const std::pair<std::string, std::shared_ptr<Check::FileInfo>> &fileInfo : data.fileInfo)
+            fileInfoList.push_back(fileInfo.second.get());
     }
 
     // Set CTU max depth
     CTU::maxCtuDepth = mSettings.maxCtuDepth;
 
-    // Analyse the tokens
+    // Analyse the tokens, the whole program analyses of the checks run in parallel
+    std::vector<WholeProgramTask> tasks;
+    if (mSettings.checks.isEnabled(Checks::unusedFunction)) {
+        tasks.emplace_back([&](ErrorLogger &errorLogger) {
+            CheckUnusedFunctions::analyseWholeProgram(mSettings, errorLogger, fileInfoData);
+            return false;
+        });
+    }
     // cppcheck-suppress shadowFunction - TODO: fix this
-    for (Check *check : Check::instances())
-        check->analyseWholeProgram(&ctuFileInfo, fileInfoList, mSettings, *this);
-
-    if (mUnusedFunctionsCheck)
-        mUnusedFunctionsCheck->check(mSettings, *this);
-
-    for (Check::FileInfo *fi : fileInfoList)
-        delete fi;
+    for (Check *check : Check::instances()) {
+        tasks.emplace_back([&, check](ErrorLogger &errorLogger) {
+            return check->analyseWholeProgram(&ctuFileInfo, fileInfoList, mSettings, errorLogger);
+        });
+    }
+    if (mUnusedFunctionsCheck) {
+        tasks.emplace_back([this](ErrorLogger &errorLogger) {
+            return mUnusedFunctionsCheck->check(mSettings, errorLogger);
+        });
+    }
+    runWholeProgramTasks(tasks, mSettings.jobs, *this);
 
     return mExitCode;
 }
@@ -1892,11 +2503,36 @@ void CppCheck::removeCtuInfoFiles(const std::list<FileWithDetails> &files, const
 void CppCheck::resetTimerResults()
 {
     s_timerResults.reset();
+    s_headerTokenCache.clear();
+    SymbolDatabase::resetFunctionLookups();
+}
+
+std::string CppCheck::getTraceEvents()
+{
+    return s_timerResults.getTraceEvents();
+}
+
+std::vector<FileStatistics> CppCheck::getFileStatistics()
+{
+    std::lock_guard<std::mutex> guard(s_fileStatisticsSync);
+    return s_fileStatistics;
 }
 
-void CppCheck::printTimerResults(SHOWTIME_MODES mode)
+void CppCheck::printTimerResults(SHOWTIME_MODES mode, ErrorLogger &errorLogger)
 {
     s_timerResults.showResults(mode);
+
+    if (mode == SHOWTIME_MODES::SHOWTIME_NONE || mode == SHOWTIME_MODES::SHOWTIME_FILE_TOTAL)
+        return;
+    const std::size_t hits = s_headerTokenCache.hits();
+    const std::size_t misses = s_headerTokenCache.misses();
+    if (hits + misses > 0)
+        errorLogger.reportOut("Header cache: " + std::to_string(hits) + " hit(s), " + std::to_string(misses) + " miss(es)");
+    if (mode == SHOWTIME_MODES::SHOWTIME_TOP5_FILE || mode == SHOWTIME_MODES::SHOWTIME_TOP5_SUMMARY)
+        return;
+    const std::size_t lookups = SymbolDatabase::functionLookups();
+    if (lookups > 0)
+        errorLogger.reportOut("Function lookups: " + std::to_string(lookups) + ", " + std::to_string(SymbolDatabase::functionLookupsRejected()) + " rejected by name");
 }
 
 bool CppCheck::isPremiumCodingStandardId(const std::string& id) const {
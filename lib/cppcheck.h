@@ -30,11 +30,13 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <ctime>
 #include <fstream>
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_set>
@@ -44,6 +46,7 @@
 class TokenList;
 enum class SHOWTIME_MODES : std::uint8_t;
 struct FileSettings;
+struct FileStatistics;
 class CheckUnusedFunctions;
 class Tokenizer;
 class FileWithDetails;
@@ -142,6 +145,11 @@ public:
      */
     bool analyseWholeProgram();
 
+    /** @return true if the results of the last checked file were reused from the build dir without analysing it */
+    bool reusedResults() const {
+        return mReusedResults;
+    }
+
     /** Analyze all files using clang-tidy */
     void analyseClangTidy(const FileSettings &fileSettings);
 
@@ -152,7 +160,13 @@ public:
     void removeCtuInfoFiles(const std::list<FileWithDetails>& files, const std::list<FileSettings>& fileSettings); // cppcheck-suppress functionConst // has side effects
 
     static void resetTimerResults();
-    static void printTimerResults(SHOWTIME_MODES mode);
+    static void printTimerResults(SHOWTIME_MODES mode, ErrorLogger &errorLogger);
+
+    /** Trace events of this process for --showtime=trace, see TimerResults::getTraceEvents() */
+    static std::string getTraceEvents();
+
+    /** Statistics of the configurations checked by this process for --file-statistics */
+    static std::vector<FileStatistics> getFileStatistics();
 
     bool isPremiumCodingStandardId(const std::string& id) const;
 
@@ -171,6 +185,9 @@ private:
     bool hasRule(const std::string &tokenlist) const;
 #endif
 
+    /** Report the unmatched inline suppressions of the file unless they are reported after all files are checked */
+    void reportUnmatchedSuppressions(const FileWithDetails &file);
+
     /** @brief There has been an internal error => Report information message */
     void internalError(const std::string &filename, const std::string &msg);
 
@@ -186,8 +203,22 @@ private:
     /**
      * @brief Check normal tokens
      * @param tokenizer tokenizer instance
+     * @param errorLogger the findings are reported here
+     * @param fileInfo file info for whole program analysis is added here
      */
-    void checkNormalTokens(const Tokenizer &tokenizer);
+    void checkNormalTokens(const Tokenizer &tokenizer, ErrorLogger &errorLogger, std::list<Check::FileInfo*> &fileInfo);
+
+    /**
+     * @brief Run all registered checks using --checks-jobs threads
+     * @param tokenizer tokenizer instance
+     * @param errorLogger the findings are reported here
+     * @param maxTime point in time when the checks are stopped, 0 for no limit
+     * @return false if not all checks have been run
+     */
+    bool runChecksParallel(const Tokenizer &tokenizer, ErrorLogger &errorLogger, std::time_t maxTime);
+
+    /** @brief Report that the --checks-max-time limit has been exceeded */
+    void checksMaxTimeExceeded(const Tokenizer &tokenizer, ErrorLogger &errorLogger) const;
 
     /**
      * Execute addons
@@ -205,8 +236,9 @@ private:
      * @brief Execute rules, if any
      * @param tokenlist token list to use (define / normal / raw)
      * @param list token list
+     * @param errorLogger the findings are reported here
      */
-    void executeRules(const std::string &tokenlist, const TokenList &list);
+    void executeRules(const std::string &tokenlist, const TokenList &list, ErrorLogger &errorLogger);
 #endif
 
     unsigned int checkClang(const FileWithDetails &file);
@@ -243,6 +275,9 @@ private:
 
     unsigned int mExitCode{};
 
+    /** the results of the last checked file were reused from the build dir */
+    bool mReusedResults{};
+
     bool mUseGlobalSuppressions;
 
     /** Are there too many configs? */
@@ -253,6 +288,9 @@ private:
 
     AnalyzerInformation mAnalyzerInformation;
 
+    /** Protects the analyzer information and the unused functions check when configurations are checked in parallel */
+    std::mutex mAnalysisSync;
+
     /** Callback for executing a shell command (exe, args, output) */
     ExecuteCmdFn mExecuteCommand;
 
@@ -21,6 +21,7 @@
 #include "ctu.h"
 
 #include "astutils.h"
+#include "binarystream.h"
 #include "errortypes.h"
 #include "settings.h"
 #include "symboldatabase.h"
@@ -244,13 +245,172 @@ void CTU::FileInfo::loadFromXml(const tinyxml2::XMLElement *xmlElement)
     }
 }
 
-std::map<std::string, std::list<const CTU::FileInfo::CallBase *>> CTU::FileInfo::getCallsMap() const
+CTU::FileInfo::CallGraph::CallGraph(const FileInfo &fileInfo)
 {
-    std::map<std::string, std::list<const CTU::FileInfo::CallBase *>> ret;
-    for (const CTU::FileInfo::NestedCall &nc : nestedCalls)
-        ret[nc.callId].push_back(&nc);
-    for (const CTU::FileInfo::FunctionCall &fc : functionCalls)
-        ret[fc.callId].push_back(&fc);
+    for (const NestedCall &nc : fileInfo.nestedCalls) {
+        mFunctions.emplace(nc.callId, static_cast<int>(mFunctions.size()));
+        mFunctions.emplace(nc.myId, static_cast<int>(mFunctions.size()));
+    }
+    for (const FunctionCall &fc : fileInfo.functionCalls)
+        mFunctions.emplace(fc.callId, static_cast<int>(mFunctions.size()));
+
+    // count the calls of each function and then put them in place
+    mOffsets.assign(mFunctions.size() + 1, 0);
+    for (const NestedCall &nc : fileInfo.nestedCalls)
+        ++mOffsets[getFunction(nc.callId) + 1];
+    for (const FunctionCall &fc : fileInfo.functionCalls)
+        ++mOffsets[getFunction(fc.callId) + 1];
+    for (std::size_t i = 1; i < mOffsets.size(); ++i)
+        mOffsets[i] += mOffsets[i - 1];
+
+    std::vector<std::size_t> next(mOffsets.cbegin(), mOffsets.cend() - 1);
+    mCalls.resize(mOffsets.back());
+    for (const NestedCall &nc : fileInfo.nestedCalls)
+        mCalls[next[getFunction(nc.callId)]++] = {&nc, nullptr, getFunction(nc.myId), nc.myArgNr};
+    for (const FunctionCall &fc : fileInfo.functionCalls)
+        mCalls[next[getFunction(fc.callId)]++] = {&fc, &fc, -1, 0};
+}
+
+int CTU::FileInfo::CallGraph::getFunction(const std::string &functionId) const
+{
+    const auto it = mFunctions.find(functionId);
+    return it == mFunctions.end() ? -1 : it->second;
+}
+
+static void locationToBinary(const CTU::FileInfo::Location &location, BinaryWriter &out)
+{
+    out.str(location.fileName);
+    out.integer(location.lineNumber);
+    out.integer(location.column);
+}
+
+static void locationFromBinary(CTU::FileInfo::Location &location, BinaryReader &in)
+{
+    location.fileName = in.str();
+    location.lineNumber = static_cast<int>(in.integer());
+    location.column = static_cast<int>(in.integer());
+}
+
+void CTU::FileInfo::toBinary(BinaryWriter &out) const
+{
+    out.number(functionCalls.size(), 4);
+    for (const FunctionCall &functionCall : functionCalls)
+        functionCall.toBinary(out);
+    out.number(nestedCalls.size(), 4);
+    for (const NestedCall &nestedCall : nestedCalls)
+        nestedCall.toBinary(out);
+}
+
+void CTU::FileInfo::CallBase::toBaseBinary(BinaryWriter &out) const
+{
+    out.str(callId);
+    out.integer(callArgNr);
+    out.str(callFunctionName);
+    locationToBinary(location, out);
+}
+
+void CTU::FileInfo::FunctionCall::toBinary(BinaryWriter &out) const
+{
+    toBaseBinary(out);
+    out.str(callArgumentExpression);
+    out.integer(callArgValue);
+    out.integer(static_cast<int>(callValueType));
+    out.number(warning ? 1 : 0, 1);
+    out.number(callValuePath.size(), 4);
+    for (const ErrorMessage::FileLocation &loc : callValuePath) {
+        out.str(loc.getfile(false));
+        out.str(loc.getinfo());
+        out.integer(loc.line);
+        out.integer(loc.column);
+    }
+}
+
+void CTU::FileInfo::NestedCall::toBinary(BinaryWriter &out) const
+{
+    toBaseBinary(out);
+    out.str(myId);
+    out.integer(myArgNr);
+}
+
+bool CTU::FileInfo::CallBase::loadBaseFromBinary(BinaryReader &in)
+{
+    callId = in.str();
+    callArgNr = static_cast<int>(in.integer());
+    callFunctionName = in.str();
+    locationFromBinary(location, in);
+    return in.good();
+}
+
+bool CTU::FileInfo::FunctionCall::loadFromBinary(BinaryReader &in)
+{
+    if (!loadBaseFromBinary(in))
+        return false;
+    callArgumentExpression = in.str();
+    callArgValue = in.integer();
+    callValueType = static_cast<ValueFlow::Value::ValueType>(in.integer());
+    warning = in.number(1) != 0;
+    const std::uint64_t pathSize = in.number(4);
+    for (std::uint64_t i = 0; i < pathSize && in.good(); ++i) {
+        std::string file = in.str();
+        std::string info = in.str();
+        const int line = static_cast<int>(in.integer());
+        const unsigned int column = static_cast<unsigned int>(in.integer());
+        callValuePath.emplace_back(file, std::move(info), line, column);
+    }
+    return in.good();
+}
+
+bool CTU::FileInfo::NestedCall::loadFromBinary(BinaryReader &in)
+{
+    if (!loadBaseFromBinary(in))
+        return false;
+    myId = in.str();
+    myArgNr = static_cast<int>(in.integer());
+    return in.good();
+}
+
+void CTU::FileInfo::loadFromBinary(BinaryReader &in)
+{
+    const std::uint64_t functionCallCount = in.number(4);
+    for (std::uint64_t i = 0; i < functionCallCount && in.good(); ++i) {
+        FunctionCall functionCall;
+        if (functionCall.loadFromBinary(in))
+            functionCalls.push_back(std::move(functionCall));
+    }
+    const std::uint64_t nestedCallCount = in.number(4);
+    for (std::uint64_t i = 0; i < nestedCallCount && in.good(); ++i) {
+        NestedCall nestedCall;
+        if (nestedCall.loadFromBinary(in))
+            nestedCalls.push_back(std::move(nestedCall));
+    }
+}
+
+void CTU::toBinary(const std::list<CTU::FileInfo::UnsafeUsage> &unsafeUsage, BinaryWriter &out)
+{
+    out.number(unsafeUsage.size(), 4);
+    for (const CTU::FileInfo::UnsafeUsage &u : unsafeUsage) {
+        out.str(u.myId);
+        out.integer(u.myArgNr);
+        out.str(u.myArgumentName);
+        locationToBinary(u.location, out);
+        out.integer(u.value);
+    }
+}
+
+std::list<CTU::FileInfo::UnsafeUsage> CTU::loadUnsafeUsageListFromBinary(BinaryReader &in)
+{
+    std::list<CTU::FileInfo::UnsafeUsage> ret;
+    const std::uint64_t count = in.number(4);
+    for (std::uint64_t i = 0; i < count && in.good(); ++i) {
+        FileInfo::UnsafeUsage unsafeUsage;
+        unsafeUsage.myId = in.str();
+        unsafeUsage.myArgNr = static_cast<int>(in.integer());
+        unsafeUsage.myArgumentName = in.str();
+        locationFromBinary(unsafeUsage.location, in);
+        unsafeUsage.value = in.integer();
+        if (in.good())
+            ret.push_back(std::move(unsafeUsage));
+    }
     return ret;
 }
 
@@ -494,66 +654,74 @@ std::list<CTU::FileInfo::UnsafeUsage> CTU::getUnsafeUsage(const Tokenizer &token
     return unsafeUsage;
 }
 
-static bool findPath(const std::string &callId,
-                     nonneg int callArgNr,
-                     MathLib::bigint unsafeValue,
-                     CTU::FileInfo::InvalidValueType invalidValue,
-                     const std::map<std::string, std::list<const CTU::FileInfo::CallBase *>> &callsMap,
-                     const CTU::FileInfo::CallBase *path[10],
-                     int index,
-                     bool warning)
+static bool isInvalidValue(const CTU::FileInfo::FunctionCall *functionCall, CTU::FileInfo::InvalidValueType invalidValue, MathLib::bigint unsafeValue, bool warning)
 {
-    if (index >= CTU::maxCtuDepth || index >= 10)
+    if (!warning && functionCall->warning)
         return false;
+    switch (invalidValue) {
+    case CTU::FileInfo::InvalidValueType::null:
+        return functionCall->callValueType == ValueFlow::Value::ValueType::INT && functionCall->callArgValue == 0;
+    case CTU::FileInfo::InvalidValueType::uninit:
+        return functionCall->callValueType == ValueFlow::Value::ValueType::UNINIT;
+    case CTU::FileInfo::InvalidValueType::bufferOverflow:
+        if (functionCall->callValueType != ValueFlow::Value::ValueType::BUFFER_SIZE)
+            return false;
+        return unsafeValue < 0 || (unsafeValue >= functionCall->callArgValue && functionCall->callArgValue >= 0);
+    }
+    return false;
+}
 
-    const std::map<std::string, std::list<const CTU::FileInfo::CallBase *>>::const_iterator it = callsMap.find(callId);
-    if (it == callsMap.end())
+bool CTU::FileInfo::CallGraph::findPath(const std::string &callId, nonneg int callArgNr, MathLib::bigint unsafeValue, InvalidValueType invalidValue, const CallBase *path[10], bool warning) const
+{
+    // the unsafe value only matters for buffer overflows
+    const Query query(invalidValue, warning, invalidValue == InvalidValueType::bufferOverflow ? unsafeValue : 0);
+    return findPath(getFunction(callId), callArgNr, query, path, 0);
+}
+
+bool CTU::FileInfo::CallGraph::findPath(int function, nonneg int callArgNr, const Query &query, const CallBase *path[10], int index) const
+{
+    const int depth = std::min(CTU::maxCtuDepth, 10);
+    if (index >= depth || function < 0)
         return false;
 
-    for (const CTU::FileInfo::CallBase *c : it->second) {
-        if (c->callArgNr != callArgNr)
+    // the first path that is found only depends on the function, the argument and the remaining depth
+    std::unordered_map<std::uint64_t, int> &paths = mPaths[query];
+    const std::uint64_t key = (static_cast<std::uint64_t>(function) << 36) | (static_cast<std::uint64_t>(callArgNr & 0xffffffff) << 4) | static_cast<std::uint64_t>(depth - index);
+    const auto it = paths.find(key);
+    if (it != paths.end()) {
+        if (it->second < 0)
+            return false;
+        const Call &c = mCalls[it->second];
+        if (!c.functionCall)
+            findPath(c.nestedFunction, c.nestedArgNr, query, path, index + 1);
+        path[index] = c.call;
+        return true;
+    }
+
+    int found = -1;
+    for (std::size_t i = mOffsets[function]; i < mOffsets[function + 1]; ++i) {
+        const Call &c = mCalls[i];
+        if (c.call->callArgNr != callArgNr)
             continue;
 
-        const auto *functionCall = dynamic_cast<const CTU::FileInfo::FunctionCall *>(c);
-        if (functionCall) {
-            if (!warning && functionCall->warning)
+        if (c.functionCall) {
+            if (!isInvalidValue(c.functionCall, std::get<0>(query), std::get<2>(query), std::get<1>(query)))
                 continue;
-            switch (invalidValue) {
-            case CTU::FileInfo::InvalidValueType::null:
-                if (functionCall->callValueType != ValueFlow::Value::ValueType::INT || functionCall->callArgValue != 0)
-                    continue;
-                break;
-            case CTU::FileInfo::InvalidValueType::uninit:
-                if (functionCall->callValueType != ValueFlow::Value::ValueType::UNINIT)
-                    continue;
-                break;
-            case CTU::FileInfo::InvalidValueType::bufferOverflow:
-                if (functionCall->callValueType != ValueFlow::Value::ValueType::BUFFER_SIZE)
-                    continue;
-                if (unsafeValue < 0 || (unsafeValue >= functionCall->callArgValue && functionCall->callArgValue >= 0))
-                    break;
-                continue;
-            }
-            path[index] = functionCall;
-            return true;
-        }
-
-        const auto *nestedCall = dynamic_cast<const CTU::FileInfo::NestedCall *>(c);
-        if (!nestedCall)
+        } else if (!findPath(c.nestedFunction, c.nestedArgNr, query, path, index + 1)) {
             continue;
-
-        if (findPath(nestedCall->myId, nestedCall->myArgNr, unsafeValue, invalidValue, callsMap, path, index + 1, warning)) {
-            path[index] = nestedCall;
-            return true;
         }
+        path[index] = c.call;
+        found = static_cast<int>(i);
+        break;
     }
 
-    return false;
+    paths[key] = found;
+    return found >= 0;
 }
 
 std::list<ErrorMessage::FileLocation> CTU::FileInfo::getErrorPath(InvalidValueType invalidValue,
                                                                   const CTU::FileInfo::UnsafeUsage &unsafeUsage,
-                                                                  const std::map<std::string, std::list<const CTU::FileInfo::CallBase *>> &callsMap,
+                                                                  const CallGraph &callGraph,
                                                                   const char info[],
                                                                   const FunctionCall ** const functionCallPtr,
                                                                   bool warning)
@@ -562,7 +730,7 @@ std::list<ErrorMessage::FileLocation> CTU::FileInfo::getErrorPath(InvalidValueTy
 
     const CTU::FileInfo::CallBase *path[10] = {nullptr};
 
-    if (!findPath(unsafeUsage.myId, unsafeUsage.myArgNr, unsafeUsage.value, invalidValue, callsMap, path, 0, warning))
+    if (!callGraph.findPath(unsafeUsage.myId, unsafeUsage.myArgNr, unsafeUsage.value, invalidValue, path, warning))
         return locationList;
 
     const std::string value1 = (invalidValue == InvalidValueType::null) ? "null" : "uninitialized";
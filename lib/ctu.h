@@ -28,13 +28,18 @@
 #include "mathlib.h"
 #include "vfvalue.h"
 
+#include <cstddef>
 #include <cstdint>
 #include <list>
 #include <map>
 #include <string>
+#include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+class BinaryReader;
+class BinaryWriter;
 class Function;
 class Settings;
 class Token;
@@ -55,6 +60,7 @@ namespace CTU {
         enum class InvalidValueType : std::uint8_t { null, uninit, bufferOverflow };
 
         std::string toString() const override;
+        void toBinary(BinaryWriter &out) const override;
 
         struct Location {
             Location() = default;
@@ -92,6 +98,8 @@ namespace CTU {
         protected:
             std::string toBaseXmlString() const;
             bool loadBaseFromXml(const tinyxml2::XMLElement *xmlElement);
+            void toBaseBinary(BinaryWriter &out) const;
+            bool loadBaseFromBinary(BinaryReader &in);
         };
 
         class FunctionCall : public CallBase {
@@ -104,6 +112,8 @@ namespace CTU {
 
             std::string toXmlString() const;
             bool loadFromXml(const tinyxml2::XMLElement *xmlElement);
+            void toBinary(BinaryWriter &out) const;
+            bool loadFromBinary(BinaryReader &in);
         };
 
         class NestedCall : public CallBase {
@@ -119,6 +129,8 @@ namespace CTU {
 
             std::string toXmlString() const;
             bool loadFromXml(const tinyxml2::XMLElement *xmlElement);
+            void toBinary(BinaryWriter &out) const;
+            bool loadFromBinary(BinaryReader &in);
 
             std::string myId;
             nonneg int myArgNr{};
@@ -128,11 +140,60 @@ namespace CTU {
         std::list<NestedCall> nestedCalls;
 
         void loadFromXml(const tinyxml2::XMLElement *xmlElement);
-        std::map<std::string, std::list<const CallBase *>> getCallsMap() const;
+        void loadFromBinary(BinaryReader &in);
+
+        /**
+         * @brief The calls of the functions of the whole program
+         *
+         * The function ids are interned and the calls of each function are
+         * stored in one array, the nested calls before the function calls.
+         * The results of the path searches are memoized for each function,
+         * argument and remaining depth so raising the maximum CTU depth does
+         * not search the same calls again and again. The memoized results
+         * are not shared between threads.
+         */
+        class CPPCHECKLIB CallGraph {
+        public:
+            explicit CallGraph(const FileInfo &fileInfo);
+
+            /**
+             * Find the calls that pass an invalid value to the argument of the function.
+             * @param callId the function id
+             * @param callArgNr the argument number
+             * @param unsafeValue the value that is unsafe for a buffer overflow
+             * @param invalidValue kind of the invalid value
+             * @param path output: the calls, path[0] calls the function
+             * @param warning also use the calls that are warnings
+             * @return true if a path is found
+             */
+            bool findPath(const std::string &callId, nonneg int callArgNr, MathLib::bigint unsafeValue, InvalidValueType invalidValue, const CallBase *path[10], bool warning) const;
+
+        private:
+            struct Call {
+                const CallBase *call;
+                /** nullptr for a nested call */
+                const FunctionCall *functionCall;
+                /** the calling function of a nested call */
+                int nestedFunction;
+                nonneg int nestedArgNr;
+            };
+
+            using Query = std::tuple<InvalidValueType, bool, MathLib::bigint>;
+
+            int getFunction(const std::string &functionId) const;
+            bool findPath(int function, nonneg int callArgNr, const Query &query, const CallBase *path[10], int index) const;
+
+            std::unordered_map<std::string, int> mFunctions;
+            /** the calls of function i are mCalls[mOffsets[i]] .. mCalls[mOffsets[i+1]-1] */
+            std::vector<std::size_t> mOffsets;
+            std::vector<Call> mCalls;
+            /** the index of the call that leads to the invalid value or -1 for each function, argument and remaining depth */
+            mutable std::map<Query, std::unordered_map<std::uint64_t, int>> mPaths;
+        };
 
         static std::list<ErrorMessage::FileLocation> getErrorPath(InvalidValueType invalidValue,
                                                                   const UnsafeUsage &unsafeUsage,
-                                                                  const std::map<std::string, std::list<const CallBase *>> &callsMap,
+                                                                  const CallGraph &callGraph,
                                                                   const char info[],
                                                                   const FunctionCall ** const functionCallPtr,
                                                                   bool warning);
@@ -142,6 +203,8 @@ namespace CTU {
 
     CPPCHECKLIB std::string toString(const std::list<FileInfo::UnsafeUsage> &unsafeUsage);
 
+    CPPCHECKLIB void toBinary(const std::list<FileInfo::UnsafeUsage> &unsafeUsage, BinaryWriter &out);
+
     CPPCHECKLIB std::string getFunctionId(const Tokenizer &tokenizer, const Function *function);
 
     /** @brief Parse current TU and extract file info */
@@ -150,6 +213,8 @@ namespace CTU {
     CPPCHECKLIB std::list<FileInfo::UnsafeUsage> getUnsafeUsage(const Tokenizer &tokenizer, const Settings &settings, bool (*isUnsafeUsage)(const Settings &settings, const Token *argtok, MathLib::bigint *value));
 
     CPPCHECKLIB std::list<FileInfo::UnsafeUsage> loadUnsafeUsageListFromXml(const tinyxml2::XMLElement *xmlElement);
+
+    CPPCHECKLIB std::list<FileInfo::UnsafeUsage> loadUnsafeUsageListFromBinary(BinaryReader &in);
 }
 
 /// @}
@@ -34,6 +34,7 @@
 #include <cstring>
 #include <fstream>
 #include <iomanip>
+#include <limits>
 #include <sstream>
 #include <string>
 #include <unordered_map>
@@ -303,44 +304,47 @@ std::string ErrorMessage::serialize() const
     return oss;
 }
 
+// read the length of a string written by serializeString()
+static bool deserializeLength(const std::string &data, std::string::size_type &pos, unsigned int &len)
+{
+    while (pos < data.size() && std::isspace(static_cast<unsigned char>(data[pos])))
+        ++pos;
+    const std::string::size_type start = pos;
+    unsigned long long value = 0;
+    while (pos < data.size() && std::isdigit(static_cast<unsigned char>(data[pos]))) {
+        value = value * 10 + (data[pos] - '0');
+        if (value > std::numeric_limits<unsigned int>::max())
+            return false;
+        ++pos;
+    }
+    len = static_cast<unsigned int>(value);
+    return pos != start;
+}
+
 void ErrorMessage::deserialize(const std::string &data)
 {
     // TODO: clear all fields
     certainty = Certainty::normal;
     callStack.clear();
 
-    std::istringstream iss(data);
+    // the data is parsed in place since this is done for each message of the child processes
+    std::string::size_type offset = 0;
     std::array<std::string, 9> results;
-    std::size_t elem = 0;
-    while (iss.good() && elem < 9) {
+    for (std::string &result : results) {
         unsigned int len = 0;
-        if (!(iss >> len))
+        if (!deserializeLength(data, offset, len))
             throw InternalError(nullptr, "Internal Error: Deserialization of error message failed - invalid length");
 
-        if (iss.get() != ' ')
+        if (offset >= data.size() || data[offset++] != ' ')
             throw InternalError(nullptr, "Internal Error: Deserialization of error message failed - invalid separator");
 
-        if (!iss.good())
+        if (len > data.size() - offset)
             throw InternalError(nullptr, "Internal Error: Deserialization of error message failed - premature end of data");
 
-        std::string temp;
-        if (len > 0) {
-            temp.resize(len);
-            iss.read(&temp[0], len);
-
-            if (!iss.good())
-                throw InternalError(nullptr, "Internal Error: Deserialization of error message failed - premature end of data");
-        }
-
-        results[elem++] = std::move(temp);
+        result.assign(data, offset, len);
+        offset += len;
     }
 
-    if (!iss.good())
-        throw InternalError(nullptr, "Internal Error: Deserialization of error message failed - premature end of data");
-
-    if (elem != 9)
-        throw InternalError(nullptr, "Internal Error: Deserialization of error message failed - insufficient elements");
-
     id = std::move(results[0]);
     severity = severityFromString(results[1]);
     cwe.id = 0;
@@ -363,31 +367,28 @@ void ErrorMessage::deserialize(const std::string &data)
     mVerboseMessage = std::move(results[8]);
 
     unsigned int stackSize = 0;
-    if (!(iss >> stackSize))
+    if (!deserializeLength(data, offset, stackSize))
         throw InternalError(nullptr, "Internal Error: Deserialization of error message failed - invalid stack size");
 
-    if (iss.get() != ' ')
+    if (offset >= data.size() || data[offset++] != ' ')
         throw InternalError(nullptr, "Internal Error: Deserialization of error message failed - invalid separator");
 
     if (stackSize == 0)
         return;
 
-    while (iss.good()) {
+    for (;;) {
         unsigned int len = 0;
-        if (!(iss >> len))
+        if (!deserializeLength(data, offset, len))
             throw InternalError(nullptr, "Internal Error: Deserialization of error message failed - invalid length (stack)");
 
-        if (iss.get() != ' ')
+        if (offset >= data.size() || data[offset++] != ' ')
             throw InternalError(nullptr, "Internal Error: Deserialization of error message failed - invalid separator (stack)");
 
-        std::string temp;
-        if (len > 0) {
-            temp.resize(len);
-            iss.read(&temp[0], len);
+        if (len > data.size() - offset)
+            throw InternalError(nullptr, "Internal Error: Deserialization of error message failed - premature end of data (stack)");
 
-            if (!iss.good())
-                throw InternalError(nullptr, "Internal Error: Deserialization of error message failed - premature end of data (stack)");
-        }
+        const std::string temp = data.substr(offset, len);
+        offset += len;
 
         std::vector<std::string> substrings;
         substrings.reserve(5);
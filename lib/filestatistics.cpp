@@ -0,0 +1,155 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2024 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "filestatistics.h"
+
+#include "errortypes.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include "json.h"
+
+#ifdef _WIN32
+#define PSAPI_VERSION 2 // GetProcessMemoryInfo() is in kernel32.dll
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+std::size_t FileStatistics::peakMemory()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return counters.PeakWorkingSetSize / 1024;
+    return 0;
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#if defined(__APPLE__)
+    // bytes
+    return static_cast<std::size_t>(usage.ru_maxrss) / 1024;
+#else
+    return static_cast<std::size_t>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+void FileStatistics::sort(std::vector<FileStatistics> &statistics)
+{
+    std::stable_sort(statistics.begin(), statistics.end(), [](const FileStatistics &s1, const FileStatistics &s2) {
+        if (s1.file != s2.file)
+            return s1.file < s2.file;
+        return s1.configuration < s2.configuration;
+    });
+}
+
+std::string FileStatistics::toJson(const std::vector<FileStatistics> &statistics)
+{
+    picojson::array files;
+    for (const FileStatistics &s : statistics) {
+        picojson::object obj;
+        obj["file"] = picojson::value(s.file);
+        obj["configuration"] = picojson::value(s.configuration);
+        obj["tokens"] = picojson::value(static_cast<int64_t>(s.tokens));
+        obj["scopes"] = picojson::value(static_cast<int64_t>(s.scopes));
+        obj["functions"] = picojson::value(static_cast<int64_t>(s.functions));
+        obj["values"] = picojson::value(static_cast<int64_t>(s.values));
+        obj["peakMemoryDelta"] = picojson::value(static_cast<int64_t>(s.peakMemoryDelta));
+        obj["simplifyTokensTime"] = picojson::value(s.simplifyTokensSeconds);
+        obj["checksTime"] = picojson::value(s.checksSeconds);
+        files.emplace_back(std::move(obj));
+    }
+    picojson::object root;
+    root["files"] = picojson::value(std::move(files));
+    return picojson::value(std::move(root)).serialize(true);
+}
+
+static std::size_t getSize(const picojson::object &obj, const std::string &name)
+{
+    const auto it = obj.find(name);
+    if (it == obj.end() || !it->second.is<int64_t>() || it->second.get<int64_t>() < 0)
+        throw InternalError(nullptr, "Failed to read the file statistics: invalid '" + name + "'");
+    return static_cast<std::size_t>(it->second.get<int64_t>());
+}
+
+static double getSeconds(const picojson::object &obj, const std::string &name)
+{
+    const auto it = obj.find(name);
+    if (it == obj.end() || !it->second.is<double>())
+        throw InternalError(nullptr, "Failed to read the file statistics: invalid '" + name + "'");
+    return it->second.get<double>();
+}
+
+static std::string getString(const picojson::object &obj, const std::string &name)
+{
+    const auto it = obj.find(name);
+    if (it == obj.end() || !it->second.is<std::string>())
+        throw InternalError(nullptr, "Failed to read the file statistics: invalid '" + name + "'");
+    return it->second.get<std::string>();
+}
+
+std::vector<FileStatistics> FileStatistics::fromJson(const std::string &json)
+{
+    picojson::value root;
+    const std::string err = picojson::parse(root, json);
+    if (!err.empty())
+        throw InternalError(nullptr, "Failed to read the file statistics: " + err);
+    if (!root.is<picojson::object>() || !root.contains("files") || !root.get("files").is<picojson::array>())
+        throw InternalError(nullptr, "Failed to read the file statistics: no files");
+
+    std::vector<FileStatistics> statistics;
+    for (const picojson::value &file : root.get("files").get<picojson::array>()) {
+        if (!file.is<picojson::object>())
+            throw InternalError(nullptr, "Failed to read the file statistics: invalid file");
+        const picojson::object &obj = file.get<picojson::object>();
+        FileStatistics s;
+        s.file = getString(obj, "file");
+        s.configuration = getString(obj, "configuration");
+        s.tokens = getSize(obj, "tokens");
+        s.scopes = getSize(obj, "scopes");
+        s.functions = getSize(obj, "functions");
+        s.values = getSize(obj, "values");
+        s.peakMemoryDelta = getSize(obj, "peakMemoryDelta");
+        s.simplifyTokensSeconds = getSeconds(obj, "simplifyTokensTime");
+        s.checksSeconds = getSeconds(obj, "checksTime");
+        statistics.push_back(std::move(s));
+    }
+    return statistics;
+}
+
+void FileStatistics::writeText(std::ostream &out, const std::vector<FileStatistics> &statistics)
+{
+    for (const FileStatistics &s : statistics) {
+        out << s.file;
+        if (!s.configuration.empty())
+            out << " (" << s.configuration << ')';
+        out << ": tokens=" << s.tokens
+            << " scopes=" << s.scopes
+            << " functions=" << s.functions
+            << " values=" << s.values
+            << " peak-memory-delta=" << s.peakMemoryDelta << "KiB"
+            << " simplifyTokens1=" << s.simplifyTokensSeconds << 's'
+            << " checks=" << s.checksSeconds << 's'
+            << '\n';
+    }
+}
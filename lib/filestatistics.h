@@ -0,0 +1,74 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2024 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef filestatisticsH
+#define filestatisticsH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Statistics of a checked configuration of a file (--file-statistics).
+ *
+ * The peak memory usage is the high water mark of the whole process. When
+ * several files or configurations are checked in parallel threads the
+ * growth can not be told apart and is counted for the one that was
+ * checked when it happened.
+ */
+struct CPPCHECKLIB FileStatistics {
+    std::string file;
+    std::string configuration;
+    std::size_t tokens{};
+    std::size_t scopes{};
+    std::size_t functions{};
+    /** number of ValueFlow values of all tokens */
+    std::size_t values{};
+    /** growth of the peak memory usage of the process in KiB */
+    std::size_t peakMemoryDelta{};
+    /** time in Tokenizer::simplifyTokens1() (including ValueFlow) */
+    double simplifyTokensSeconds{};
+    /** time in the checks */
+    double checksSeconds{};
+
+    /** @brief Peak memory usage (resident set size) of the process in KiB, 0 if it is not known */
+    static std::size_t peakMemory();
+
+    /** @brief Sort the statistics by file and configuration */
+    static void sort(std::vector<FileStatistics> &statistics);
+
+    static std::string toJson(const std::vector<FileStatistics> &statistics);
+
+    /** @throws InternalError if the JSON is malformed */
+    static std::vector<FileStatistics> fromJson(const std::string &json);
+
+    /** @brief Write a line for each checked configuration */
+    static void writeText(std::ostream &out, const std::vector<FileStatistics> &statistics);
+};
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // filestatisticsH
@@ -28,6 +28,7 @@
 #include "symboldatabase.h"
 #include "token.h"
 #include "tokenlist.h"
+#include "tokenmatch.h"
 #include "utils.h"
 #include "valueptr.h"
 #include "vfvalue.h"
@@ -45,6 +46,8 @@
 #include <vector>
 
 namespace {
+    constexpr char ifWhileFor[] = "if|while|for (";
+
     struct ForwardTraversal {
         enum class Progress : std::uint8_t { Continue, Break, Skip };
         enum class Terminate : std::uint8_t { None, Bail, Inconclusive };
@@ -656,7 +659,7 @@ namespace {
                     } else if (scope->type == Scope::eLambda) {
                         return Break();
                     }
-                } else if (tok->isControlFlowKeyword() && Token::Match(tok, "if|while|for (") &&
+                } else if (tok->isControlFlowKeyword() && Token::Match<ifWhileFor>(tok) &&
                            Token::simpleMatch(tok->linkAt(1), ") {")) {
                     if ((settings.vfOptions.maxForwardBranches > 0) && (++branchCount > settings.vfOptions.maxForwardBranches)) {
                         // TODO: should be logged on function-level instead of file-level
@@ -40,20 +40,20 @@ protected:
 
 std::vector<ValueFlow::Value> infer(const ValuePtr<InferModel>& model,
                                     const std::string& op,
-                                    std::list<ValueFlow::Value> lhsValues,
-                                    std::list<ValueFlow::Value> rhsValues);
+                                    ValueFlow::ValueList lhsValues,
+                                    ValueFlow::ValueList rhsValues);
 
 std::vector<ValueFlow::Value> infer(const ValuePtr<InferModel>& model,
                                     const std::string& op,
                                     MathLib::bigint lhs,
-                                    std::list<ValueFlow::Value> rhsValues);
+                                    ValueFlow::ValueList rhsValues);
 
 std::vector<ValueFlow::Value> infer(const ValuePtr<InferModel>& model,
                                     const std::string& op,
-                                    std::list<ValueFlow::Value> lhsValues,
+                                    ValueFlow::ValueList lhsValues,
                                     MathLib::bigint rhs);
 
-CPPCHECKLIB std::vector<MathLib::bigint> getMinValue(const ValuePtr<InferModel>& model, const std::list<ValueFlow::Value>& values);
-std::vector<MathLib::bigint> getMaxValue(const ValuePtr<InferModel>& model, const std::list<ValueFlow::Value>& values);
+CPPCHECKLIB std::vector<MathLib::bigint> getMinValue(const ValuePtr<InferModel>& model, const ValueFlow::ValueList& values);
+std::vector<MathLib::bigint> getMaxValue(const ValuePtr<InferModel>& model, const ValueFlow::ValueList& values);
 
 #endif
@@ -7,6 +7,8 @@ HEADERS += $${PWD}/addoninfo.h \
            $${PWD}/analyzer.h \
            $${PWD}/analyzerinfo.h \
            $${PWD}/astutils.h \
+           $${PWD}/binarydump.h \
+           $${PWD}/binarystream.h \
            $${PWD}/calculate.h \
            $${PWD}/check.h \
            $${PWD}/check64bit.h \
@@ -44,6 +46,7 @@ HEADERS += $${PWD}/addoninfo.h \
            $${PWD}/errorlogger.h \
            $${PWD}/errortypes.h \
            $${PWD}/filesettings.h \
+           $${PWD}/filestatistics.h \
            $${PWD}/findtoken.h \
            $${PWD}/forwardanalyzer.h \
            $${PWD}/fwdanalysis.h \
@@ -72,7 +75,9 @@ HEADERS += $${PWD}/addoninfo.h \
            $${PWD}/token.h \
            $${PWD}/tokenize.h \
            $${PWD}/tokenlist.h \
+           $${PWD}/tokenmatch.h \
            $${PWD}/tokenrange.h \
+           $${PWD}/tokenstrings.h \
            $${PWD}/utils.h \
            $${PWD}/valueflow.h \
            $${PWD}/valueptr.h \
@@ -109,6 +114,7 @@ SOURCES += $${PWD}/valueflow.cpp \
            $${PWD}/addoninfo.cpp \
            $${PWD}/analyzerinfo.cpp \
            $${PWD}/astutils.cpp \
+           $${PWD}/binarydump.cpp \
            $${PWD}/check.cpp \
            $${PWD}/check64bit.cpp \
            $${PWD}/checkassert.cpp \
@@ -143,6 +149,7 @@ SOURCES += $${PWD}/valueflow.cpp \
            $${PWD}/ctu.cpp \
            $${PWD}/errorlogger.cpp \
            $${PWD}/errortypes.cpp \
+           $${PWD}/filestatistics.cpp \
            $${PWD}/forwardanalyzer.cpp \
            $${PWD}/fwdanalysis.cpp \
            $${PWD}/importproject.cpp \
@@ -144,19 +144,20 @@ struct Library::LibraryData
 };
 
 Library::Library()
-    : mData(new LibraryData())
+    : mData(std::make_shared<LibraryData>())
 {}
 
 Library::~Library() = default;
 
-Library::Library(const Library& other)
-    : mData(new LibraryData(*other.mData))
-{}
+// the data is only modified when loading so copies share it until then
+Library::Library(const Library& other) = default;
+
+Library& Library::operator=(const Library& other) = default;
 
-Library& Library::operator=(const Library& other)
+void Library::detach()
 {
-    mData.reset(new LibraryData(*other.mData));
-    return *this;
+    if (mData.use_count() > 1)
+        mData = std::make_shared<LibraryData>(*mData);
 }
 
 static std::vector<std::string> getnames(const char *names)
@@ -308,6 +309,8 @@ Library::Container::Action Library::Container::actionFrom(const std::string& act
 
 Library::Error Library::load(const tinyxml2::XMLDocument &doc)
 {
+    detach();
+
     const tinyxml2::XMLElement * const rootnode = doc.FirstChildElement();
 
     if (rootnode == nullptr) {
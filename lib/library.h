@@ -464,8 +464,11 @@ private:
     // load a <function> xml node
     Error loadFunction(const tinyxml2::XMLElement * const node, const std::string &name, std::set<std::string> &unknown_elements);
 
+    /** @brief Make sure the data is not shared with a copy before modifying it */
+    void detach();
+
     struct LibraryData;
-    std::unique_ptr<LibraryData> mData;
+    std::shared_ptr<LibraryData> mData;
 
     const ArgumentChecks * getarg(const Token *ftok, int argnr) const;
 
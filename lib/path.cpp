@@ -410,6 +410,31 @@ bool Path::isDirectory(const std::string &path)
     return file_type(path) == S_IFDIR;
 }
 
+bool Path::getFileStamp(const std::string &path, std::uint64_t &size, std::uint64_t &mtime)
+{
+#ifdef _WIN32
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExA(path.c_str(), GetFileExInfoStandard, &data))
+        return false;
+    size = (static_cast<std::uint64_t>(data.nFileSizeHigh) << 32) | data.nFileSizeLow;
+    // 100 nanosecond ticks
+    mtime = (static_cast<std::uint64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+#else
+    struct stat file_stat;
+    if (stat(path.c_str(), &file_stat) != 0)
+        return false;
+    size = file_stat.st_size;
+#if defined(__linux__)
+    mtime = static_cast<std::uint64_t>(file_stat.st_mtim.tv_sec) * 1000000000ULL + file_stat.st_mtim.tv_nsec;
+#elif defined(__APPLE__)
+    mtime = static_cast<std::uint64_t>(file_stat.st_mtimespec.tv_sec) * 1000000000ULL + file_stat.st_mtimespec.tv_nsec;
+#else
+    mtime = file_stat.st_mtime;
+#endif
+#endif
+    return true;
+}
+
 std::string Path::join(const std::string& path1, const std::string& path2) {
     if (path1.empty() || path2.empty())
         return path1 + path2;
@@ -24,6 +24,7 @@
 #include "config.h"
 #include "standards.h"
 
+#include <cstdint>
 #include <set>
 #include <string>
 #include <vector>
@@ -190,6 +191,15 @@ public:
      */
     static bool isDirectory(const std::string &path);
 
+    /**
+     * @brief Get the size and the modification time of a file or directory
+     * @param path Path of the file or directory
+     * @param size size in bytes
+     * @param mtime modification time, with the resolution the platform provides
+     * @return false if the path does not exist
+     */
+    static bool getFileStamp(const std::string &path, std::uint64_t &size, std::uint64_t &mtime);
+
     /**
      * join 2 paths with '/' separators
      */
@@ -21,6 +21,7 @@
 #include "astutils.h"
 #include "symboldatabase.h"
 #include "token.h"
+#include "tokenmatch.h"
 #include "vfvalue.h"
 
 #include <algorithm>
@@ -81,6 +82,8 @@ PathAnalysis::Progress PathAnalysis::forwardRecursive(const Token* tok, Info inf
     return Progress::Continue;
 }
 
+static constexpr char ifWhileFor[] = "if|while|for (";
+
 PathAnalysis::Progress PathAnalysis::forwardRange(const Token* startToken, const Token* endToken, Info info, const std::function<PathAnalysis::Progress(const Info&)>& f) const
 {
     for (const Token *tok = startToken; precedes(tok, endToken); tok = tok->next()) {
@@ -99,7 +102,7 @@ PathAnalysis::Progress PathAnalysis::forwardRange(const Token* startToken, const
             tok = nextAfterAstRightmostLeaf(assignTok);
             if (!tok)
                 return Progress::Break;
-        } else if (Token::simpleMatch(tok, "}") && Token::simpleMatch(tok->link()->previous(), ") {") && Token::Match(tok->link()->linkAt(-1)->previous(), "if|while|for (")) {
+        } else if (Token::simpleMatch(tok, "}") && Token::simpleMatch(tok->link()->previous(), ") {") && Token::Match<ifWhileFor>(tok->link()->linkAt(-1)->previous())) {
             const Token * blockStart = tok->link()->linkAt(-1)->previous();
             const Token * condTok = getCondTok(blockStart);
             if (!condTok)
@@ -123,7 +126,7 @@ PathAnalysis::Progress PathAnalysis::forwardRange(const Token* startToken, const
             if (Token::simpleMatch(tok, "} else {")) {
                 tok = tok->linkAt(2);
             }
-        } else if (Token::Match(tok, "if|while|for (") && Token::simpleMatch(tok->linkAt(1), ") {")) {
+        } else if (Token::Match<ifWhileFor>(tok) && Token::simpleMatch(tok->linkAt(1), ") {")) {
             const Token * endCond = tok->linkAt(1);
             const Token * endBlock = endCond->linkAt(1);
             const Token * condTok = getCondTok(tok);
@@ -31,8 +31,13 @@
 
 #include <algorithm>
 #include <array>
+#include <cctype>
 #include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
 #include <iterator>
+#include <list>
 #include <sstream>
 #include <utility>
 
@@ -61,6 +66,103 @@ Directive::DirectiveToken::DirectiveToken(const simplecpp::Token & _tok) :
     tokStr(_tok.str())
 {}
 
+simplecpp::TokenList *HeaderTokenCache::load(const std::string &filename, std::vector<std::string> &filenames, simplecpp::OutputList *outputList)
+{
+    std::uint64_t size = 0;
+    std::uint64_t mtime = 0;
+    if (!Path::getFileStamp(filename, size, mtime))
+        return new simplecpp::TokenList(filename, filenames, outputList);
+
+    std::shared_ptr<const Entry> entry;
+    {
+        std::lock_guard<std::mutex> l(mEntriesSync);
+        const auto it = mEntries.find(filename);
+        if (it != mEntries.end() && it->second->second->size == size && it->second->second->mtime == mtime) {
+            entry = it->second->second;
+            mEntryList.splice(mEntryList.begin(), mEntryList, it->second);
+        }
+    }
+
+    if (entry) {
+        ++mHits;
+    } else {
+        ++mMisses;
+        auto newEntry = std::make_shared<Entry>();
+        newEntry->size = size;
+        newEntry->mtime = mtime;
+        newEntry->tokens.reset(new simplecpp::TokenList(filename, newEntry->files, &newEntry->outputList));
+        for (const simplecpp::Token *tok = newEntry->tokens->cfront(); tok; tok = tok->next)
+            ++newEntry->tokenCount;
+        entry = newEntry;
+
+        std::lock_guard<std::mutex> l(mEntriesSync);
+        const auto it = mEntries.find(filename);
+        if (it != mEntries.end()) {
+            mTokenCount -= it->second->second->tokenCount;
+            mEntryList.erase(it->second);
+            mEntries.erase(it);
+        }
+        mEntryList.emplace_front(filename, entry);
+        mEntries[filename] = mEntryList.begin();
+        mTokenCount += entry->tokenCount;
+        // the entries are shared so the ones in use stay valid when they are removed
+        while (mTokenCount > mMaxTokens && mEntryList.size() > 1) {
+            mTokenCount -= mEntryList.back().second->tokenCount;
+            mEntries.erase(mEntryList.back().first);
+            mEntryList.pop_back();
+        }
+    }
+
+    // the cached tokens refer to their own file list - map the indexes into the file list of this translation unit
+    std::vector<unsigned int> fileIndexes;
+    fileIndexes.reserve(entry->files.size());
+    for (const std::string &f : entry->files) {
+        const auto it = std::find(filenames.cbegin(), filenames.cend(), f);
+        fileIndexes.push_back(static_cast<unsigned int>(it - filenames.cbegin()));
+        if (it == filenames.cend())
+            filenames.push_back(f);
+    }
+
+    const auto copyLocation = [&fileIndexes](simplecpp::Location &loc, const simplecpp::Location &other) {
+        loc.fileIndex = other.fileIndex < fileIndexes.size() ? fileIndexes[other.fileIndex] : other.fileIndex;
+        loc.line = other.line;
+        loc.col = other.col;
+    };
+
+    auto *tokens = new simplecpp::TokenList(filenames);
+    for (const simplecpp::Token *tok = entry->tokens->cfront(); tok; tok = tok->next) {
+        simplecpp::Location loc(filenames);
+        copyLocation(loc, tok->location);
+        tokens->push_back(new simplecpp::Token(tok->str(), loc));
+    }
+
+    if (outputList) {
+        for (const simplecpp::Output &output : entry->outputList) {
+            simplecpp::Output out(filenames, output.type, output.msg);
+            copyLocation(out.location, output.location);
+            outputList->push_back(std::move(out));
+        }
+    }
+
+    return tokens;
+}
+
+std::size_t HeaderTokenCache::tokens() const
+{
+    std::lock_guard<std::mutex> l(mEntriesSync);
+    return mTokenCount;
+}
+
+void HeaderTokenCache::clear()
+{
+    std::lock_guard<std::mutex> l(mEntriesSync);
+    mEntries.clear();
+    mEntryList.clear();
+    mTokenCount = 0;
+    mHits = 0;
+    mMisses = 0;
+}
+
 char Preprocessor::macroChar = char(1);
 
 Preprocessor::Preprocessor(const Settings& settings, ErrorLogger &errorLogger) : mSettings(settings), mErrorLogger(errorLogger)
@@ -165,8 +267,7 @@ static bool parseInlineSuppressionCommentToken(const simplecpp::Token *tok, std:
     return true;
 }
 
-static std::string getRelativeFilename(const simplecpp::Token* tok, const Settings &settings) {
-    std::string relativeFilename(tok->location.file());
+std::string Preprocessor::getRelativeFilename(std::string relativeFilename, const Settings &settings) {
     if (settings.relativePaths) {
         for (const std::string & basePath : settings.basePaths) {
             const std::string bp = basePath + "/";
@@ -218,7 +319,7 @@ static void addInlineSuppressions(const simplecpp::TokenList &tokens, const Sett
             continue;
 
         // Relative filename
-        const std::string relativeFilename = getRelativeFilename(tok, settings);
+        const std::string relativeFilename = Preprocessor::getRelativeFilename(tok->location.file(), settings);
 
         // Macro name
         std::string macroName;
@@ -232,6 +333,7 @@ static void addInlineSuppressions(const simplecpp::TokenList &tokens, const Sett
         // Add the suppressions.
         for (SuppressionList::Suppression &suppr : inlineSuppressions) {
             suppr.fileName = relativeFilename;
+            suppr.isInline = true;
 
             if (SuppressionList::Type::blockBegin == suppr.type)
             {
@@ -766,12 +868,160 @@ void Preprocessor::handleErrors(const simplecpp::OutputList& outputList, bool th
     }
 }
 
+static bool isAbsoluteHeaderPath(const std::string &path)
+{
+#ifdef _WIN32
+    if (path.length() >= 3 && path[0] > 0 && std::isalpha(path[0]) && path[1] == ':' && (path[2] == '\\' || path[2] == '/'))
+        return true;
+    return path.length() > 1U && (path[0] == '/' || path[0] == '\\');
+#else
+    return path.length() > 1U && path[0] == '/';
+#endif
+}
+
+static std::string getRelativeHeaderName(const std::string &sourcefile, const std::string &header)
+{
+    if (sourcefile.find_first_of("\\/") != std::string::npos)
+        return simplecpp::simplifyPath(sourcefile.substr(0, sourcefile.find_last_of("\\/") + 1U) + header);
+    return simplecpp::simplifyPath(header);
+}
+
+static std::string getIncludePathHeaderName(const std::string &includePath, const std::string &header)
+{
+    std::string path = includePath;
+    if (!path.empty() && path.back() != '/' && path.back() != '\\')
+        path += '/';
+    return simplecpp::simplifyPath(path + header);
+}
+
+static bool canOpen(const std::string &filename)
+{
+    return std::ifstream(filename).is_open();
+}
+
+/** the name of the header if it is loaded already - the same lookup as in simplecpp */
+static std::string findLoadedHeader(const std::map<std::string, simplecpp::TokenList *> &tokenLists, const simplecpp::DUI &dui, const std::string &sourcefile, const std::string &header, bool systemheader)
+{
+    if (tokenLists.empty())
+        return "";
+    if (isAbsoluteHeaderPath(header))
+        return tokenLists.find(header) != tokenLists.end() ? simplecpp::simplifyPath(header) : "";
+    if (!systemheader) {
+        const std::string filename = getRelativeHeaderName(sourcefile, header);
+        if (tokenLists.find(filename) != tokenLists.end())
+            return filename;
+    }
+    for (const std::string &includePath : dui.includePaths) {
+        const std::string filename = getIncludePathHeaderName(includePath, header);
+        if (tokenLists.find(filename) != tokenLists.end())
+            return filename;
+    }
+    if (systemheader && tokenLists.find(header) != tokenLists.end())
+        return header;
+    return "";
+}
+
+/** the name of the header file to load - the same lookup as in simplecpp */
+static std::string findHeaderFile(const simplecpp::DUI &dui, const std::string &sourcefile, const std::string &header, bool systemheader)
+{
+    if (isAbsoluteHeaderPath(header)) {
+        const std::string filename = simplecpp::simplifyPath(header);
+        return canOpen(filename) ? filename : "";
+    }
+    if (!systemheader) {
+        const std::string filename = getRelativeHeaderName(sourcefile, header);
+        if (canOpen(filename))
+            return filename;
+    }
+    for (const std::string &includePath : dui.includePaths) {
+        const std::string filename = getIncludePathHeaderName(includePath, header);
+        if (canOpen(filename))
+            return filename;
+    }
+    return "";
+}
+
+/**
+ * Loads the included files like simplecpp::load() but gets their tokens
+ * from the cache. On Windows simplecpp also corrects the case of the header
+ * names, a header that is written with an other case is loaded again by
+ * simplecpp::preprocess().
+ */
+static std::map<std::string, simplecpp::TokenList *> loadWithCache(const simplecpp::TokenList &rawtokens, std::vector<std::string> &files, const simplecpp::DUI &dui, simplecpp::OutputList &outputList, HeaderTokenCache &headerCache)
+{
+    std::map<std::string, simplecpp::TokenList *> ret;
+    std::list<const simplecpp::Token *> filelist;
+
+    // -include files
+    for (const std::string &filename : dui.includes) {
+        if (ret.find(filename) != ret.end())
+            continue;
+        if (!canOpen(filename)) {
+            simplecpp::Output err(files);
+            err.type = simplecpp::Output::EXPLICIT_INCLUDE_NOT_FOUND;
+            err.location = simplecpp::Location(files);
+            err.msg = "Can not open include file '" + filename + "' that is explicitly included.";
+            outputList.push_back(std::move(err));
+            continue;
+        }
+        simplecpp::TokenList *tokens = headerCache.load(filename, files, &outputList);
+        if (!tokens->front()) {
+            delete tokens;
+            continue;
+        }
+        if (dui.removeComments)
+            tokens->removeComments();
+        ret[filename] = tokens;
+        filelist.push_back(tokens->front());
+    }
+
+    for (const simplecpp::Token *rawtok = rawtokens.cfront(); rawtok || !filelist.empty(); rawtok = rawtok ? rawtok->next : nullptr) {
+        if (rawtok == nullptr) {
+            rawtok = filelist.back();
+            filelist.pop_back();
+        }
+
+        if (rawtok->op != '#' || sameline(rawtok->previousSkipComments(), rawtok))
+            continue;
+
+        rawtok = rawtok->nextSkipComments();
+        if (!rawtok || rawtok->str() != "include")
+            continue;
+
+        const simplecpp::Token * const htok = rawtok->nextSkipComments();
+        if (!sameline(rawtok, htok))
+            continue;
+
+        const std::string &sourcefile = rawtok->location.file();
+        const bool systemheader = (htok->str()[0] == '<');
+        const std::string header = htok->str().substr(1U, htok->str().size() - 2U);
+        if (!findLoadedHeader(ret, dui, sourcefile, header, systemheader).empty())
+            continue;
+
+        const std::string header2 = findHeaderFile(dui, sourcefile, header, systemheader);
+        if (header2.empty())
+            continue;
+
+        simplecpp::TokenList *tokens = headerCache.load(header2, files, &outputList);
+        if (dui.removeComments)
+            tokens->removeComments();
+        ret[header2] = tokens;
+        if (tokens->front())
+            filelist.push_back(tokens->front());
+    }
+
+    return ret;
+}
+
 bool Preprocessor::loadFiles(const simplecpp::TokenList &rawtokens, std::vector<std::string> &files)
 {
     const simplecpp::DUI dui = createDUI(mSettings, emptyString, files[0]);
 
     simplecpp::OutputList outputList;
-    mTokenLists = simplecpp::load(rawtokens, files, dui, &outputList);
+    if (mHeaderCache)
+        mTokenLists = loadWithCache(rawtokens, files, dui, outputList, *mHeaderCache);
+    else
+        mTokenLists = simplecpp::load(rawtokens, files, dui, &outputList);
     handleErrors(outputList, false);
     return !hasErrors(outputList);
 }
@@ -1076,7 +1326,7 @@ void Preprocessor::addRemarkComments(const simplecpp::TokenList &tokens, std::ve
         }
 
         // Relative filename
-        const std::string relativeFilename = getRelativeFilename(remarkedToken, mSettings);
+        const std::string relativeFilename = getRelativeFilename(remarkedToken->location.file(), mSettings);
 
         // Add the suppressions.
         remarkComments.emplace_back(relativeFilename, remarkedToken->location.line, remarkText);
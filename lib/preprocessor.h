@@ -23,13 +23,17 @@
 
 #include "config.h"
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <istream>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -93,6 +97,58 @@ public:
 /// @addtogroup Core
 /// @{
 
+/**
+ * @brief Process-wide cache of the raw token lists of included files.
+ * Each file is lexed once and the result is copied into every translation
+ * unit which includes it. Entries are keyed by the filename and are lexed
+ * again when the size or the modification time of the file changes. When
+ * the cached files hold more than the given number of tokens the least
+ * recently used ones are removed. The cache is thread safe.
+ */
+class CPPCHECKLIB HeaderTokenCache {
+public:
+    explicit HeaderTokenCache(std::size_t maxTokens = 4000000) : mMaxTokens(maxTokens) {}
+
+    /** generates a token list from the given filename - same semantics as simplecpp::TokenList(filename, filenames, outputList) */
+    simplecpp::TokenList *load(const std::string &filename, std::vector<std::string> &filenames, simplecpp::OutputList *outputList);
+
+    /** number of files which were copied from the cache */
+    std::size_t hits() const {
+        return mHits;
+    }
+
+    /** number of files which had to be lexed */
+    std::size_t misses() const {
+        return mMisses;
+    }
+
+    /** number of tokens in the cached files */
+    std::size_t tokens() const;
+
+    void clear();
+
+private:
+    struct Entry {
+        std::uint64_t size{};
+        std::uint64_t mtime{};
+        std::size_t tokenCount{};
+        std::vector<std::string> files;
+        simplecpp::OutputList outputList;
+        std::unique_ptr<simplecpp::TokenList> tokens;
+    };
+
+    /** the most recently used entry is first */
+    using EntryList = std::list<std::pair<std::string, std::shared_ptr<const Entry>>>;
+
+    EntryList mEntryList;
+    std::unordered_map<std::string, EntryList::iterator> mEntries;
+    std::size_t mTokenCount{};
+    const std::size_t mMaxTokens;
+    mutable std::mutex mEntriesSync;
+    std::atomic<std::size_t> mHits{};
+    std::atomic<std::size_t> mMisses{};
+};
+
 /**
  * @brief The cppcheck preprocessor.
  * The preprocessor has special functionality for extracting the various ifdef
@@ -132,6 +188,11 @@ public:
 
     bool loadFiles(const simplecpp::TokenList &rawtokens, std::vector<std::string> &files);
 
+    /** use the given cache when loading the included files */
+    void setHeaderCache(HeaderTokenCache *headerCache) {
+        mHeaderCache = headerCache;
+    }
+
     void removeComments();
 
     void setPlatformInfo(simplecpp::TokenList *tokens) const;
@@ -162,6 +223,9 @@ public:
 
     static bool hasErrors(const simplecpp::Output &output);
 
+    /** The name of a file as it is used in the inline suppressions and the remark comments */
+    static std::string getRelativeFilename(std::string filename, const Settings &settings);
+
 private:
     static void simplifyPragmaAsmPrivate(simplecpp::TokenList *tokenList);
 
@@ -179,6 +243,8 @@ private:
 
     std::map<std::string, simplecpp::TokenList *> mTokenLists;
 
+    HeaderTokenCache *mHeaderCache{};
+
     /** filename for cpp/c file - useful when reporting errors */
     std::string mFile0;
 
@@ -115,12 +115,18 @@ public:
     /** @brief Path to the python interpreter to be used to run addons. */
     std::string addonPython;
 
+    /** @brief Run the Python addons in a resident interpreter per thread (--addon-server) */
+    bool addonServer{};
+
     /** @brief Paths used as base for conversion to relative paths. */
     std::vector<std::string> basePaths;
 
     /** @brief --cppcheck-build-dir. Always uses / as path separator. No trailing path separator. */
     std::string buildDir;
 
+    /** @brief Lex each included file only once and share the tokens between the checked files (--cache-headers) */
+    bool cacheHeaders{};
+
     /** @brief check all configurations (false if -D or --max-configs is used */
     bool checkAllConfigurations = true;
 
@@ -135,6 +141,9 @@ public:
     /** Check for incomplete info in library files? */
     bool checkLibrary{};
 
+    /** @brief --checks-jobs=<n> : Number of threads used to run the checks of a single file */
+    unsigned int checksJobs = 1;
+
     /** @brief The maximum time in seconds for the checks of a single file */
     int checksMaxTime{};
 
@@ -162,6 +171,9 @@ public:
     /** @brief include paths excluded from checking the configuration */
     std::set<std::string> configExcludePaths;
 
+    /** @brief --config-jobs=<n> : Number of threads used to check the configurations of a single file */
+    unsigned int configJobs = 1;
+
     /** cppcheck.cfg: Custom product name */
     std::string cppcheckCfgProductName;
 
@@ -193,6 +205,14 @@ public:
     bool dump{};
     std::string dumpFile;
 
+    enum class DumpFormat : std::uint8_t {
+        Xml,
+        Binary
+    };
+
+    /** @brief Format of the dump files (--dump-format) */
+    DumpFormat dumpFormat = DumpFormat::Xml;
+
     /** @brief Name of the language that is enforced. Empty per default. */
     Standards::Language enforcedLang{};
 
@@ -223,6 +243,9 @@ public:
     /** @brief List of --file-filter for analyzing special files */
     std::vector<std::string> fileFilters;
 
+    /** @brief Write statistics of the checked files to this file (--file-statistics). JSON if it ends with .json. */
+    std::string fileStatistics;
+
     /** @brief Force checking the files with "too many" configurations (--force). */
     bool force{};
 
@@ -360,6 +383,9 @@ public:
     /** @brief show timing information (--showtime=file|summary|top5) */
     SHOWTIME_MODES showtime{};
 
+    /** @brief Chrome trace file written by --showtime=trace. If empty cppcheck-trace.json in the build dir or the current dir. */
+    std::string showtimeTraceFile;
+
     /** Struct contains standards settings */
     Standards standards;
 
@@ -404,6 +430,13 @@ public:
         /** @brief Experimental: maximum execution time */
         int maxTime = -1;
 
+        /**
+         * @brief maximum memory in bytes for the tokens, ValueFlow values and symbol database of a
+         * translation unit, 0 for no limit. When it is exceeded the possible values are dropped and
+         * then the extended analysis is skipped.
+         */
+        std::size_t maxMemory = 0;
+
         /** @brief Control if condition expression analysis is performed */
         bool doConditionExpressionAnalysis = true;
 
@@ -421,6 +454,9 @@ public:
 
         /** @brief Maximum expression varid depth */
         int maxExprVarIdDepth = 4;
+
+        /** @brief number of threads which run the function local passes for independent functions */
+        unsigned int jobs = 1;
     };
 
     /** @brief The ValueFlow options */
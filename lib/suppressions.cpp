@@ -30,7 +30,6 @@
 #include <algorithm>
 #include <cctype>   // std::isdigit, std::isalnum, etc
 #include <cstring>
-#include <functional> // std::bind, std::placeholders
 #include <sstream>
 #include <utility>
 
@@ -245,15 +244,106 @@ std::string SuppressionList::addSuppressionLine(const std::string &line)
     return addSuppression(std::move(suppression));
 }
 
+SuppressionList::SuppressionList(const SuppressionList &other)
+    : mSuppressions(other.mSuppressions)
+{
+    for (Suppression &s : mSuppressions)
+        addToIndex(s);
+}
+
+SuppressionList &SuppressionList::operator=(const SuppressionList &other)
+{
+    if (this != &other) {
+        mSuppressions = other.mSuppressions;
+        mIndexed.clear();
+        mIndex.clear();
+        mGlobIndex.clear();
+        for (Suppression &s : mSuppressions)
+            addToIndex(s);
+    }
+    return *this;
+}
+
+static bool isGlobPattern(const std::string &str)
+{
+    return str.find_first_of("*?") != std::string::npos;
+}
+
+/** matchglob() does not distinguish '/' and '\\' so neither does the index */
+static std::string indexFileName(std::string fileName)
+{
+    std::replace(fileName.begin(), fileName.end(), '\\', '/');
+    return fileName;
+}
+
+static bool isIndexed(const SuppressionList::Suppression &suppression)
+{
+    return !suppression.errorId.empty() && !isGlobPattern(suppression.errorId) &&
+           suppression.type != SuppressionList::Type::macro && !isGlobPattern(suppression.fileName);
+}
+
+void SuppressionList::addToIndex(Suppression &suppression)
+{
+    const std::size_t pos = mIndexed.size();
+    mIndexed.push_back(&suppression);
+    if (isIndexed(suppression))
+        mIndex[suppression.errorId][indexFileName(suppression.fileName)].push_back(pos);
+    else
+        mGlobIndex.push_back(pos);
+}
+
+std::vector<std::size_t> SuppressionList::getCandidates(const SuppressionList::ErrorMessage &errmsg) const
+{
+    std::vector<std::size_t> candidates(mGlobIndex);
+    const auto it = mIndex.find(errmsg.errorId);
+    if (it != mIndex.end()) {
+        const auto addCandidates = [&](const std::string &fileName) {
+            const auto it2 = it->second.find(fileName);
+            if (it2 != it->second.end())
+                candidates.insert(candidates.end(), it2->second.cbegin(), it2->second.cend());
+        };
+        const std::string fileName = indexFileName(errmsg.getFileName());
+        addCandidates(fileName);
+        if (!fileName.empty())
+            addCandidates(emptyString);
+        std::sort(candidates.begin(), candidates.end());
+    }
+    return candidates;
+}
+
 std::string SuppressionList::addSuppression(SuppressionList::Suppression suppression)
 {
     // Check if suppression is already in list
-    auto foundSuppression = std::find_if(mSuppressions.begin(), mSuppressions.end(),
-                                         std::bind(&Suppression::isSameParameters, &suppression, std::placeholders::_1));
-    if (foundSuppression != mSuppressions.end()) {
+    Suppression *foundSuppression = nullptr;
+    const auto isSame = [&](std::size_t pos) {
+        return suppression.isSameParameters(*mIndexed[pos]);
+    };
+    if (isIndexed(suppression)) {
+        const auto it = mIndex.find(suppression.errorId);
+        if (it != mIndex.end()) {
+            const auto it2 = it->second.find(indexFileName(suppression.fileName));
+            if (it2 != it->second.end()) {
+                const auto pos = std::find_if(it2->second.cbegin(), it2->second.cend(), isSame);
+                if (pos != it2->second.cend())
+                    foundSuppression = mIndexed[*pos];
+            }
+        }
+    }
+    if (!foundSuppression) {
+        // macro suppressions are not indexed by error id and file name
+        const auto pos = std::find_if(mGlobIndex.cbegin(), mGlobIndex.cend(), isSame);
+        if (pos != mGlobIndex.cend())
+            foundSuppression = mIndexed[*pos];
+    }
+    if (foundSuppression) {
         // Update matched state of existing global suppression
         if (!suppression.isLocal() && suppression.matched)
             foundSuppression->matched = suppression.matched;
+        // The state of an inline suppression is restored when the stored results of its file are reused
+        if (suppression.isInline && suppression.matched)
+            foundSuppression->matched = true;
+        if (suppression.isInline && suppression.checked)
+            foundSuppression->checked = true;
         return "";
     }
 
@@ -276,6 +366,7 @@ std::string SuppressionList::addSuppression(SuppressionList::Suppression suppres
         return "Failed to add suppression. Invalid glob pattern '" + suppression.fileName + "'.";
 
     mSuppressions.push_back(std::move(suppression));
+    addToIndex(mSuppressions.back());
 
     return "";
 }
@@ -413,7 +504,8 @@ bool SuppressionList::isSuppressed(const SuppressionList::ErrorMessage &errmsg,
 {
     const bool unmatchedSuppression(errmsg.errorId == "unmatchedSuppression");
     bool returnValue = false;
-    for (Suppression &s : mSuppressions) {
+    for (const std::size_t pos : getCandidates(errmsg)) {
+        Suppression &s = *mIndexed[pos];
         if (!global && !s.isLocal())
             continue;
         if (unmatchedSuppression && s.errorId != errmsg.errorId)
@@ -426,7 +518,8 @@ bool SuppressionList::isSuppressed(const SuppressionList::ErrorMessage &errmsg,
 
 bool SuppressionList::isSuppressedExplicitly(const SuppressionList::ErrorMessage &errmsg, bool global)
 {
-    for (Suppression &s : mSuppressions) {
+    for (const std::size_t pos : getCandidates(errmsg)) {
+        Suppression &s = *mIndexed[pos];
         if (!global && !s.isLocal())
             continue;
         if (s.errorId != errmsg.errorId) // Error id must match exactly
@@ -523,23 +616,33 @@ const std::list<SuppressionList::Suppression> &SuppressionList::getSuppressions(
 }
 
 void SuppressionList::markUnmatchedInlineSuppressionsAsChecked(const Tokenizer &tokenizer) {
+    // Only the suppressions for the files of the token list can be checked
+    const std::vector<std::string> &files = tokenizer.list.getFiles();
+    std::vector<Suppression *> unchecked;
+    for (Suppression &suppression : mSuppressions) {
+        if (!suppression.checked && std::find(files.cbegin(), files.cend(), suppression.fileName) != files.cend())
+            unchecked.push_back(&suppression);
+    }
+    if (unchecked.empty())
+        return;
+
     int currLineNr = -1;
     int currFileIdx = -1;
     for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
         if (currFileIdx != tok->fileIndex() || currLineNr != tok->linenr()) {
             currLineNr = tok->linenr();
             currFileIdx = tok->fileIndex();
-            for (auto &suppression : mSuppressions) {
-                if (suppression.type == SuppressionList::Type::unique) {
-                    if (!suppression.checked && (suppression.lineNumber == currLineNr) && (suppression.fileName == tokenizer.list.file(tok))) {
-                        suppression.checked = true;
+            for (Suppression *suppression : unchecked) {
+                if (suppression->type == SuppressionList::Type::unique) {
+                    if (!suppression->checked && (suppression->lineNumber == currLineNr) && (suppression->fileName == tokenizer.list.file(tok))) {
+                        suppression->checked = true;
                     }
-                } else if (suppression.type == SuppressionList::Type::block) {
-                    if ((!suppression.checked && (suppression.lineBegin <= currLineNr) && (suppression.lineEnd >= currLineNr) && (suppression.fileName == tokenizer.list.file(tok)))) {
-                        suppression.checked = true;
+                } else if (suppression->type == SuppressionList::Type::block) {
+                    if ((!suppression->checked && (suppression->lineBegin <= currLineNr) && (suppression->lineEnd >= currLineNr) && (suppression->fileName == tokenizer.list.file(tok)))) {
+                        suppression->checked = true;
                     }
-                } else if (!suppression.checked && suppression.fileName == tokenizer.list.file(tok)) {
-                    suppression.checked = true;
+                } else if (!suppression->checked && suppression->fileName == tokenizer.list.file(tok)) {
+                    suppression->checked = true;
                 }
             }
         }
@@ -28,6 +28,7 @@
 #include <list>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -148,10 +149,17 @@ public:
         bool thisAndNextLine{}; // Special case for backwards compatibility: { // cppcheck-suppress something
         bool matched{};
         bool checked{}; // for inline suppressions, checked or not
+        bool isInline{}; // added from a comment in the code
 
         enum : std::int8_t { NO_LINE = -1 };
     };
 
+    SuppressionList() = default;
+    SuppressionList(const SuppressionList &other);
+    SuppressionList(SuppressionList &&other) = default;
+    SuppressionList &operator=(const SuppressionList &other);
+    SuppressionList &operator=(SuppressionList &&other) = default;
+
     /**
      * @brief Don't show errors listed in the file.
      * @param istr Open file stream where errors can be read.
@@ -256,8 +264,26 @@ public:
     static bool reportUnmatchedSuppressions(const std::list<SuppressionList::Suppression> &unmatched, ErrorLogger &errorLogger);
 
 private:
+    /** @brief Add suppression to the lookup index */
+    void addToIndex(Suppression &suppression);
+
+    /** @brief Positions in mIndexed of the suppressions that can match the error, in list order */
+    std::vector<std::size_t> getCandidates(const ErrorMessage &errmsg) const;
+
     /** @brief List of error which the user doesn't want to see. */
     std::list<Suppression> mSuppressions;
+
+    /** @brief The suppressions of mSuppressions in list order */
+    std::vector<Suppression *> mIndexed;
+
+    /**
+     * @brief Suppressions with a plain error id and a plain or empty file name.
+     * The positions in mIndexed are looked up by error id and file name.
+     */
+    std::unordered_map<std::string, std::unordered_map<std::string, std::vector<std::size_t>>> mIndex;
+
+    /** @brief Suppressions that need glob matching of the error id or file name, and macro suppressions */
+    std::vector<std::size_t> mGlobIndex;
 };
 
 struct Suppressions
@@ -30,6 +30,7 @@
 #include "settings.h"
 #include "standards.h"
 #include "templatesimplifier.h"
+#include "timer.h"
 #include "token.h"
 #include "tokenize.h"
 #include "tokenlist.h"
@@ -52,6 +53,9 @@
 #include <unordered_set>
 //---------------------------------------------------------------------------
 
+std::atomic<std::size_t> SymbolDatabase::mFunctionLookups;
+std::atomic<std::size_t> SymbolDatabase::mFunctionLookupsRejected;
+
 SymbolDatabase::SymbolDatabase(Tokenizer& tokenizer, const Settings& settings, ErrorLogger& errorLogger)
     : mTokenizer(tokenizer), mSettings(settings), mErrorLogger(errorLogger)
 {
@@ -66,6 +70,7 @@ SymbolDatabase::SymbolDatabase(Tokenizer& tokenizer, const Settings& settings, E
         mDefaultSignedness = ValueType::UNKNOWN_SIGN;
 
     createSymbolDatabaseFindAllScopes();
+    createSymbolDatabaseFunctionIndex();
     createSymbolDatabaseClassInfo();
     createSymbolDatabaseVariableInfo();
     createSymbolDatabaseCopyAndMoveConstructors();
@@ -1130,6 +1135,36 @@ void SymbolDatabase::createSymbolDatabaseSetScopePointers()
     }
 }
 
+void SymbolDatabase::createSymbolDatabaseFunctionIndex()
+{
+    for (const Scope& scope : scopeList) {
+        for (const auto& nameAndFunction : scope.functionMap) {
+            const Function* func = nameAndFunction.second;
+            mFunctionIndex[func->tokenDef->str()][&scope].push_back(func);
+        }
+    }
+    mFunctionIndexBuilt = true;
+}
+
+const std::vector<const Function *> *SymbolDatabase::findFunctionsInIndex(const Scope *scope, const Token *tok) const
+{
+    static const std::vector<const Function *> none;
+    if (!mFunctionIndexBuilt || !tok->isInSameList(mTokenizer.list.front()))
+        return nullptr;
+    const auto it = mFunctionIndex.find(tok->str());
+    if (it == mFunctionIndex.end())
+        return &none;
+    const auto it2 = it->second.find(scope);
+    return it2 == it->second.end() ? &none : &it2->second;
+}
+
+bool SymbolDatabase::mayBeFunctionName(const Token *tok) const
+{
+    if (!mFunctionIndexBuilt || !tok->isInSameList(mTokenizer.list.front()))
+        return true;
+    return mFunctionIndex.find(tok->str()) != mFunctionIndex.end();
+}
+
 void SymbolDatabase::createSymbolDatabaseSetFunctionPointers(bool firstPass)
 {
     if (firstPass) {
@@ -3946,6 +3981,19 @@ void SymbolDatabase::printVariable(const Variable *var, const char *indent) cons
     std::cout << std::endl;
 }
 
+std::size_t SymbolDatabase::memoryUsage() const
+{
+    std::size_t usage = typeList.size() * sizeof(Type);
+    for (const Scope& scope : scopeList) {
+        usage += sizeof(Scope);
+        usage += scope.varlist.size() * sizeof(Variable);
+        usage += scope.enumeratorList.size() * sizeof(Enumerator);
+        for (const Function& function : scope.functionList)
+            usage += sizeof(Function) + function.argumentList.size() * sizeof(Variable);
+    }
+    return usage;
+}
+
 void SymbolDatabase::printOut(const char *title) const
 {
     std::cout << std::setiosflags(std::ios::boolalpha);
@@ -5531,7 +5579,20 @@ bool Scope::hasInlineOrLambdaFunction() const
     });
 }
 
-void Scope::findFunctionInBase(const std::string & name, nonneg int args, std::vector<const Function *> & matches) const
+template<class F>
+void Scope::forEachFunction(const Token *tok, const F &f) const
+{
+    if (const std::vector<const Function *> *functions = check ? check->findFunctionsInIndex(this, tok) : nullptr) {
+        for (const Function *func : *functions)
+            f(func);
+        return;
+    }
+    auto range = functionMap.equal_range(tok->str());
+    for (std::multimap<std::string, const Function *>::const_iterator it = range.first; it != range.second; ++it)
+        f(it->second);
+}
+
+void Scope::findFunctionInBase(const Token *tok, nonneg int args, std::vector<const Function *> & matches) const
 {
     if (isClassOrStruct() && definedType && !definedType->derivedFrom.empty()) {
         const std::vector<Type::BaseInfo> &derivedFrom = definedType->derivedFrom;
@@ -5541,16 +5602,14 @@ void Scope::findFunctionInBase(const std::string & name, nonneg int args, std::v
                 if (base->classScope == this) // Ticket #5120, #5125: Recursive class; tok should have been found already
                     continue;
 
-                auto range = base->classScope->functionMap.equal_range(name);
-                for (std::multimap<std::string, const Function*>::const_iterator it = range.first; it != range.second; ++it) {
-                    const Function *func = it->second;
+                base->classScope->forEachFunction(tok, [&](const Function *func) {
                     if ((func->isVariadic() && args >= (func->argCount() - 1)) ||
                         (args == func->argCount() || (args < func->argCount() && args >= func->minArgCount()))) {
                         matches.push_back(func);
                     }
-                }
+                });
 
-                base->classScope->findFunctionInBase(name, args, matches);
+                base->classScope->findFunctionInBase(tok, args, matches);
             }
         }
     }
@@ -5691,6 +5750,10 @@ static bool hasMatchingConstructor(const Scope* classScope, const ValueType* arg
 
 const Function* Scope::findFunction(const Token *tok, bool requireConst) const
 {
+    // no function has this name => don't look at the arguments
+    if (check && !check->mayBeFunctionName(tok))
+        return nullptr;
+
     const bool isCall = Token::Match(tok->next(), "(|{");
 
     const std::vector<const Token *> arguments = getArguments(tok);
@@ -5701,15 +5764,13 @@ const Function* Scope::findFunction(const Token *tok, bool requireConst) const
     const std::size_t args = arguments.size();
 
     auto addMatchingFunctions = [&](const Scope *scope) {
-        auto range = scope->functionMap.equal_range(tok->str());
-        for (std::multimap<std::string, const Function *>::const_iterator it = range.first; it != range.second; ++it) {
-            const Function *func = it->second;
+        scope->forEachFunction(tok, [&](const Function *func) {
             if (!isCall || args == func->argCount() ||
                 (func->isVariadic() && args >= (func->minArgCount() - 1)) ||
                 (args < func->argCount() && args >= func->minArgCount())) {
                 matches.push_back(func);
             }
-        }
+        });
     };
 
     addMatchingFunctions(this);
@@ -5723,7 +5784,7 @@ const Function* Scope::findFunction(const Token *tok, bool requireConst) const
     const std::size_t numberOfMatchesNonBase = matches.size();
 
     // check in base classes
-    findFunctionInBase(tok->str(), args, matches);
+    findFunctionInBase(tok, args, matches);
 
     // Non-call => Do not match parameters
     if (!isCall) {
@@ -5970,6 +6031,18 @@ const Function* Scope::findFunction(const Token *tok, bool requireConst) const
 
 const Function* SymbolDatabase::findFunction(const Token* const tok) const
 {
+    // the counters are shared by the threads so they are only updated when they are shown
+    const bool countLookups = mSettings.showtime == SHOWTIME_MODES::SHOWTIME_FILE || mSettings.showtime == SHOWTIME_MODES::SHOWTIME_SUMMARY;
+    if (countLookups)
+        mFunctionLookups.fetch_add(1, std::memory_order_relaxed);
+
+    // an unqualified name is only looked up by its name
+    if (tok->strAt(-1) != "::" && !mayBeFunctionName(tok)) {
+        if (countLookups)
+            mFunctionLookupsRejected.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
     // find the scope this function is in
     const Scope *currScope = tok->scope();
     while (currScope && currScope->isExecutable()) {
@@ -30,13 +30,16 @@
 #include "utils.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>
 #include <list>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -1193,7 +1196,11 @@ private:
      */
     bool isVariableDeclaration(const Token* const tok, const Token*& vartok, const Token*& typetok) const;
 
-    void findFunctionInBase(const std::string & name, nonneg int args, std::vector<const Function *> & matches) const;
+    void findFunctionInBase(const Token *tok, nonneg int args, std::vector<const Function *> & matches) const;
+
+    /** @brief call f for each function of this scope with the name of tok, in the order they were added */
+    template<class F>
+    void forEachFunction(const Token *tok, const F &f) const;
 
     /** @brief initialize varlist */
     void getVariableList(const Settings& settings, const Token *start, const Token *end);
@@ -1350,6 +1357,24 @@ public:
      */
     const Function* findFunction(const Token* tok) const;
 
+    /** @brief Estimated memory usage in bytes of the scopes, types, functions and variables */
+    std::size_t memoryUsage() const;
+
+    /** @brief number of findFunction() calls of all symbol databases, only counted when --showtime=file or --showtime=summary shows it */
+    static std::size_t functionLookups() {
+        return mFunctionLookups;
+    }
+
+    /** @brief number of findFunction() calls that were rejected because no function has the name */
+    static std::size_t functionLookupsRejected() {
+        return mFunctionLookupsRejected;
+    }
+
+    static void resetFunctionLookups() {
+        mFunctionLookups = 0;
+        mFunctionLookupsRejected = 0;
+    }
+
     /** For unit testing only */
     const Scope* findScopeByName(const std::string& name) const;
 
@@ -1415,6 +1440,7 @@ private:
 
     // Create symboldatabase...
     void createSymbolDatabaseFindAllScopes();
+    void createSymbolDatabaseFunctionIndex();
     void createSymbolDatabaseClassInfo();
     void createSymbolDatabaseVariableInfo();
     void createSymbolDatabaseCopyAndMoveConstructors();
@@ -1446,6 +1472,17 @@ private:
     static Function *findFunctionInScope(const Token *func, const Scope *ns, const std::string & path, nonneg int path_length);
     static const Type *findVariableTypeInBase(const Scope *scope, const Token *typeTok);
 
+    /**
+     * @brief find the functions of a scope in the function index
+     * @param scope scope of the functions
+     * @param tok name of the functions
+     * @return the functions in the order they were added, nullptr if the index can not be used for tok
+     */
+    const std::vector<const Function *> *findFunctionsInIndex(const Scope *scope, const Token *tok) const;
+
+    /** @brief true unless the index is built and no function in any scope has the name of tok */
+    bool mayBeFunctionName(const Token *tok) const;
+
     using MemberIdMap = std::map<unsigned int, unsigned int>;
     using VarIdMap = std::map<unsigned int, MemberIdMap>;
 
@@ -1477,6 +1514,15 @@ private:
     std::list<Type> mBlankTypes;
 
     ValueType::Sign mDefaultSignedness;
+
+    /** functions of all scopes by their name and scope, the same as the functionMap of the scopes */
+    std::unordered_map<std::string, std::unordered_map<const Scope *, std::vector<const Function *>>> mFunctionIndex;
+
+    /** is the function index built */
+    bool mFunctionIndexBuilt{};
+
+    static std::atomic<std::size_t> mFunctionLookups;
+    static std::atomic<std::size_t> mFunctionLookupsRejected;
 };
 
 
@@ -21,10 +21,23 @@
 #include "utils.h"
 
 #include <algorithm>
+#include <atomic>
+#include <ctime>
 #include <iostream>
+#include <sstream>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "json.h"
+
+#ifndef _WIN32
+#include <unistd.h> // for getpid()
+#else
+#include <process.h> // for getpid()
+#include <windows.h>
+#endif
+
 namespace {
     using dataElementType = std::pair<std::string, TimerResultsData>;
     bool more_second_sec(const dataElementType& lhs, const dataElementType& rhs)
@@ -34,23 +47,96 @@ namespace {
 
     // TODO: remove and print through (synchronized) ErrorLogger instead
     std::mutex stdCoutLock;
+
+    std::atomic<std::uint64_t> timerResultsId{0};
+
+    // the TimerResults instances which still exist, a thread which ends only folds its
+    // buffers into those. It is never destroyed since static TimerResults may outlive it.
+    std::mutex& liveTimerResultsSync()
+    {
+        static std::mutex* sync = new std::mutex;
+        return *sync;
+    }
+
+    std::unordered_map<std::uint64_t, TimerResults*>& liveTimerResults()
+    {
+        static auto* timerResults = new std::unordered_map<std::uint64_t, TimerResults*>;
+        return *timerResults;
+    }
+
+    int getPid()
+    {
+#ifndef _WIN32
+        return getpid();
+#else
+        return _getpid();
+#endif
+    }
+}
+
+struct TimerResults::ThreadBuffers {
+    ThreadBuffers() = default;
+    ThreadBuffers(const ThreadBuffers&) = delete;
+    ThreadBuffers& operator=(const ThreadBuffers&) = delete;
+
+    ~ThreadBuffers() {
+        std::lock_guard<std::mutex> l(liveTimerResultsSync());
+        for (const auto &buffer : buffers) {
+            const auto it = liveTimerResults().find(buffer.first);
+            if (it != liveTimerResults().end())
+                it->second->finishThread(buffer.second);
+        }
+    }
+
+    /** forget the buffers of the TimerResults which have been destroyed */
+    void prune() {
+        std::lock_guard<std::mutex> l(liveTimerResultsSync());
+        for (auto it = buffers.begin(); it != buffers.end();) {
+            if (liveTimerResults().count(it->first) == 0)
+                it = buffers.erase(it);
+            else
+                ++it;
+        }
+    }
+
+    /** the buffers of the calling thread by the id of their TimerResults */
+    std::unordered_map<std::uint64_t, ThreadResults*> buffers;
+};
+
+TimerResults::TimerResults()
+    : mId(++timerResultsId)
+    , mStart(std::chrono::steady_clock::now())
+{
+    std::lock_guard<std::mutex> l(liveTimerResultsSync());
+    liveTimerResults()[mId] = this;
+}
+
+TimerResults::~TimerResults()
+{
+    std::lock_guard<std::mutex> l(liveTimerResultsSync());
+    liveTimerResults().erase(mId);
 }
 
 // TODO: this does not include any file context when SHOWTIME_FILE thus rendering it useless - should we include the logging with the progress logging?
 // that could also get rid of the broader locking
 void TimerResults::showResults(SHOWTIME_MODES mode) const
 {
-    if (mode == SHOWTIME_MODES::SHOWTIME_NONE || mode == SHOWTIME_MODES::SHOWTIME_FILE_TOTAL)
+    if (mode == SHOWTIME_MODES::SHOWTIME_NONE || mode == SHOWTIME_MODES::SHOWTIME_FILE_TOTAL || mode == SHOWTIME_MODES::SHOWTIME_TRACE)
         return;
 
     TimerResultsData overallData;
     std::vector<dataElementType> data;
-
+    std::chrono::steady_clock::time_point start;
     {
-        std::lock_guard<std::mutex> l(mResultsSync);
+        std::lock_guard<std::mutex> l(mThreadResultsSync);
+        start = mStart;
+    }
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 
-        data.reserve(mResults.size());
-        data.insert(data.begin(), mResults.cbegin(), mResults.cend());
+    {
+        const std::map<std::string, TimerResultsData> results = getResults();
+        data.reserve(results.size());
+        data.insert(data.begin(), results.cbegin(), results.cend());
     }
     std::sort(data.begin(), data.end(), more_second_sec);
 
@@ -77,35 +163,168 @@ void TimerResults::showResults(SHOWTIME_MODES mode) const
                 });
         }
         if (!hasParent)
-            overallData.mClocks += iter->second.mClocks;
+            overallData.mCpuTime += iter->second.mCpuTime;
         if ((mode != SHOWTIME_MODES::SHOWTIME_TOP5_FILE && mode != SHOWTIME_MODES::SHOWTIME_TOP5_SUMMARY) || (ordinal<=5)) {
-            std::cout << iter->first << ": " << sec << "s (avg. " << secAverage << "s - " << iter->second.mNumberOfResults  << " result(s))" << std::endl;
+            std::cout << iter->first << ": " << sec << "s cpu, " << iter->second.wallSeconds() << "s wall (avg. " << secAverage << "s - " << iter->second.mNumberOfResults  << " result(s))" << std::endl;
         }
         ++ordinal;
     }
 
-    const double secOverall = overallData.seconds();
-    std::cout << "Overall time: " << secOverall << "s" << std::endl;
+    // the wall times of the threads overlap so their sum is not the elapsed time
+    std::cout << "Overall time: " << overallData.seconds() << "s cpu (all threads), " << elapsed << "s elapsed" << std::endl;
+}
+
+void TimerResults::addResults(const std::string& str, std::chrono::nanoseconds cpuTime, std::chrono::nanoseconds wallTime)
+{
+    ThreadResults &threadResults = getThreadResults();
+    std::lock_guard<std::mutex> l(threadResults.sync);
+
+    TimerResultsData &data = threadResults.results[str];
+    data.mCpuTime += cpuTime;
+    data.mWallTime += wallTime;
+    data.mNumberOfResults++;
 }
 
-void TimerResults::addResults(const std::string& str, std::clock_t clocks)
+void TimerResults::addTraceEvent(const std::string& str, std::chrono::steady_clock::time_point start, std::chrono::nanoseconds wallTime)
 {
-    std::lock_guard<std::mutex> l(mResultsSync);
+    ThreadResults &threadResults = getThreadResults();
+    std::lock_guard<std::mutex> l(threadResults.sync);
 
-    mResults[str].mClocks += clocks;
-    mResults[str].mNumberOfResults++;
+    threadResults.traceEvents.push_back({str, start, wallTime});
+}
+
+TimerResults::ThreadResults &TimerResults::getThreadResults()
+{
+    static thread_local ThreadBuffers threadBuffers;
+
+    const auto it = threadBuffers.buffers.find(mId);
+    if (it != threadBuffers.buffers.end())
+        return *it->second;
+
+    threadBuffers.prune();
+
+    std::lock_guard<std::mutex> l(mThreadResultsSync);
+    const int index = static_cast<int>(mThreadIndexes.size()) + 1;
+    mThreadResults.emplace_back();
+    mThreadResults.back().tid = mThreadIndexes.emplace(std::this_thread::get_id(), index).first->second;
+    threadBuffers.buffers[mId] = &mThreadResults.back();
+    return mThreadResults.back();
+}
+
+void TimerResults::finishThread(const ThreadResults *threadResults)
+{
+    std::lock_guard<std::mutex> l(mThreadResultsSync);
+    const auto it = std::find_if(mThreadResults.begin(), mThreadResults.end(), [&](const ThreadResults &r) {
+        return &r == threadResults;
+    });
+    if (it == mThreadResults.end())
+        return;
+    for (const auto &r : it->results) {
+        TimerResultsData &data = mFinishedResults[r.first];
+        data.mCpuTime += r.second.mCpuTime;
+        data.mWallTime += r.second.mWallTime;
+        data.mNumberOfResults += r.second.mNumberOfResults;
+    }
+    for (TraceEvent &event : it->traceEvents)
+        mFinishedTraceEvents.emplace_back(it->tid, std::move(event));
+    mThreadResults.erase(it);
+}
+
+std::map<std::string, TimerResultsData> TimerResults::getResults() const
+{
+    std::lock_guard<std::mutex> l(mThreadResultsSync);
+    std::map<std::string, TimerResultsData> results = mFinishedResults;
+    for (const ThreadResults &threadResults : mThreadResults) {
+        std::lock_guard<std::mutex> l2(threadResults.sync);
+        for (const auto &r : threadResults.results) {
+            TimerResultsData &data = results[r.first];
+            data.mCpuTime += r.second.mCpuTime;
+            data.mWallTime += r.second.mWallTime;
+            data.mNumberOfResults += r.second.mNumberOfResults;
+        }
+    }
+    return results;
+}
+
+std::string TimerResults::getTraceEvents() const
+{
+    std::ostringstream out;
+    const int pid = getPid();
+
+    const auto writeEvent = [&](const TraceEvent &event, int tid) {
+        // the steady clock of the child processes is the same so their events can be merged
+        const auto ts = std::chrono::duration_cast<std::chrono::microseconds>(event.start.time_since_epoch()).count();
+        const auto dur = std::chrono::duration_cast<std::chrono::microseconds>(event.duration).count();
+        out << "{\"name\":" << picojson::value(event.name).serialize()
+            << ",\"ph\":\"X\",\"ts\":" << ts << ",\"dur\":" << dur
+            << ",\"pid\":" << pid << ",\"tid\":" << tid << "}\n";
+    };
+
+    std::lock_guard<std::mutex> l(mThreadResultsSync);
+    for (const ThreadResults &threadResults : mThreadResults) {
+        std::lock_guard<std::mutex> l2(threadResults.sync);
+        for (const TraceEvent &event : threadResults.traceEvents)
+            writeEvent(event, threadResults.tid);
+    }
+    for (const auto &event : mFinishedTraceEvents)
+        writeEvent(event.second, event.first);
+    return out.str();
+}
+
+void TimerResults::writeTrace(std::ostream &out, const std::string &traceEvents)
+{
+    out << "{\"traceEvents\":[\n";
+    std::istringstream in(traceEvents);
+    std::string line;
+    bool first = true;
+    while (std::getline(in, line)) {
+        if (line.empty())
+            continue;
+        if (!first)
+            out << ",\n";
+        out << line;
+        first = false;
+    }
+    out << "\n],\"displayTimeUnit\":\"ms\"}\n";
 }
 
 void TimerResults::reset()
 {
-    std::lock_guard<std::mutex> l(mResultsSync);
-    mResults.clear();
+    // the buffers are kept since the threads still refer to them
+    std::lock_guard<std::mutex> l(mThreadResultsSync);
+    mStart = std::chrono::steady_clock::now();
+    mFinishedResults.clear();
+    mFinishedTraceEvents.clear();
+    for (ThreadResults &threadResults : mThreadResults) {
+        std::lock_guard<std::mutex> l2(threadResults.sync);
+        threadResults.results.clear();
+        threadResults.traceEvents.clear();
+    }
+}
+
+std::chrono::nanoseconds Timer::threadCpuTime()
+{
+#if defined(_WIN32)
+    FILETIME creationTime, exitTime, kernelTime, userTime;
+    if (GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime)) {
+        const auto toTicks = [](const FILETIME &ft) {
+            return (static_cast<std::uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+        };
+        // 100 nanosecond ticks
+        return std::chrono::nanoseconds((toTicks(kernelTime) + toTicks(userTime)) * 100);
+    }
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+    timespec ts;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+        return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+#endif
+    // fall back to the CPU time of the process
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>((double)std::clock() / CLOCKS_PER_SEC));
 }
 
 Timer::Timer(std::string str, SHOWTIME_MODES showtimeMode, TimerResultsIntf* timerResults)
     : mStr(std::move(str))
     , mTimerResults(timerResults)
-    , mStart(std::clock())
     , mShowTimeMode(showtimeMode)
     , mStopped(showtimeMode == SHOWTIME_MODES::SHOWTIME_NONE || showtimeMode == SHOWTIME_MODES::SHOWTIME_FILE_TOTAL)
 {}
@@ -123,20 +342,25 @@ Timer::~Timer()
 void Timer::stop()
 {
     if ((mShowTimeMode != SHOWTIME_MODES::SHOWTIME_NONE) && !mStopped) {
-        const std::clock_t end = std::clock();
-        const std::clock_t diff = end - mStart;
+        const std::chrono::nanoseconds cpuTime = threadCpuTime() - mCpuStart;
+        const std::chrono::nanoseconds wallTime = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - mWallStart);
 
         if (mShowTimeMode == SHOWTIME_MODES::SHOWTIME_FILE) {
-            const double sec = (double)diff / CLOCKS_PER_SEC;
+            const double sec = std::chrono::duration<double>(cpuTime).count();
+            const double wallSec = std::chrono::duration<double>(wallTime).count();
             std::lock_guard<std::mutex> l(stdCoutLock);
-            std::cout << mStr << ": " << sec << "s" << std::endl;
+            std::cout << mStr << ": " << sec << "s cpu, " << wallSec << "s wall" << std::endl;
         } else if (mShowTimeMode == SHOWTIME_MODES::SHOWTIME_FILE_TOTAL) {
-            const double sec = (double)diff / CLOCKS_PER_SEC;
+            const double sec = std::chrono::duration<double>(cpuTime).count();
+            const double wallSec = std::chrono::duration<double>(wallTime).count();
             std::lock_guard<std::mutex> l(stdCoutLock);
-            std::cout << "Check time: " << mStr << ": " << sec << "s" << std::endl;
+            std::cout << "Check time: " << mStr << ": " << sec << "s cpu, " << wallSec << "s wall" << std::endl;
+        } else if (mShowTimeMode == SHOWTIME_MODES::SHOWTIME_TRACE) {
+            if (mTimerResults)
+                mTimerResults->addTraceEvent(mStr, mWallStart, wallTime);
         } else {
             if (mTimerResults)
-                mTimerResults->addResults(mStr, diff);
+                mTimerResults->addResults(mStr, cpuTime, wallTime);
         }
     }
 
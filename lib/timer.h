@@ -22,11 +22,15 @@
 
 #include "config.h"
 
+#include <chrono>
 #include <cstdint>
-#include <ctime>
+#include <list>
 #include <map>
 #include <mutex>
+#include <ostream>
 #include <string>
+#include <thread>
+#include <vector>
 
 enum class SHOWTIME_MODES : std::uint8_t {
     SHOWTIME_NONE,
@@ -34,38 +38,108 @@ enum class SHOWTIME_MODES : std::uint8_t {
     SHOWTIME_FILE_TOTAL,
     SHOWTIME_SUMMARY,
     SHOWTIME_TOP5_SUMMARY,
-    SHOWTIME_TOP5_FILE
+    SHOWTIME_TOP5_FILE,
+    SHOWTIME_TRACE
 };
 
 class CPPCHECKLIB TimerResultsIntf {
 public:
     virtual ~TimerResultsIntf() = default;
 
-    virtual void addResults(const std::string& str, std::clock_t clocks) = 0;
+    virtual void addResults(const std::string& str, std::chrono::nanoseconds cpuTime, std::chrono::nanoseconds wallTime) = 0;
+    virtual void addTraceEvent(const std::string& str, std::chrono::steady_clock::time_point start, std::chrono::nanoseconds wallTime) = 0;
 };
 
 struct TimerResultsData {
-    std::clock_t mClocks{};
+    /** CPU time of the thread(s) that did the work */
+    std::chrono::nanoseconds mCpuTime{};
+    /** elapsed (steady clock) time */
+    std::chrono::nanoseconds mWallTime{};
     long mNumberOfResults{};
 
     double seconds() const {
-        const double ret = (double)((unsigned long)mClocks) / (double)CLOCKS_PER_SEC;
-        return ret;
+        return std::chrono::duration<double>(mCpuTime).count();
+    }
+
+    double wallSeconds() const {
+        return std::chrono::duration<double>(mWallTime).count();
     }
 };
 
+/**
+ * Collects the timer results. Each thread adds its results to its own
+ * buffer so the threads do not wait for each other, the buffers are
+ * merged when the results are read. The buffer of a thread is folded
+ * into the totals when the thread ends.
+ */
 class CPPCHECKLIB TimerResults : public TimerResultsIntf {
 public:
-    TimerResults() = default;
+    TimerResults();
+    ~TimerResults() override;
+
+    TimerResults(const TimerResults&) = delete;
+    TimerResults& operator=(const TimerResults&) = delete;
 
     void showResults(SHOWTIME_MODES mode) const;
-    void addResults(const std::string& str, std::clock_t clocks) override;
+    void addResults(const std::string& str, std::chrono::nanoseconds cpuTime, std::chrono::nanoseconds wallTime) override;
+    void addTraceEvent(const std::string& str, std::chrono::steady_clock::time_point start, std::chrono::nanoseconds wallTime) override;
+
+    /** The results of all threads */
+    std::map<std::string, TimerResultsData> getResults() const;
+
+    /**
+     * The trace events of all threads in the Chrome trace event format, one
+     * JSON object per line. The thread ids are small indexes of the
+     * std::thread::id of the threads in the order of their first result.
+     */
+    std::string getTraceEvents() const;
+
+    /**
+     * Write a Chrome trace file, it can be loaded in chrome://tracing or Perfetto
+     * @param out stream to write the trace to
+     * @param traceEvents trace events from getTraceEvents()
+     */
+    static void writeTrace(std::ostream &out, const std::string &traceEvents);
 
     void reset();
 
 private:
-    std::map<std::string, TimerResultsData> mResults;
-    mutable std::mutex mResultsSync;
+    struct TraceEvent {
+        std::string name;
+        std::chrono::steady_clock::time_point start;
+        std::chrono::nanoseconds duration;
+    };
+
+    struct ThreadResults {
+        std::map<std::string, TimerResultsData> results;
+        std::vector<TraceEvent> traceEvents;
+        /** index of the thread in the trace */
+        int tid{};
+        /** only contended while the results are merged or reset */
+        mutable std::mutex sync;
+    };
+
+    /** the buffers of a thread, they are folded into the totals when the thread ends */
+    struct ThreadBuffers;
+
+    ThreadResults &getThreadResults();
+
+    /** add the buffer of a thread which ends to the totals */
+    void finishThread(const ThreadResults *threadResults);
+
+    /** identifies the buffers of this instance in the threads */
+    const std::uint64_t mId;
+    /** the elapsed time is measured from here, the sum of the threads' wall times is not */
+    std::chrono::steady_clock::time_point mStart;
+    std::list<ThreadResults> mThreadResults;
+    /** the results of the threads which have ended */
+    std::map<std::string, TimerResultsData> mFinishedResults;
+    /** the trace events of the threads which have ended with the trace index of their thread */
+    std::vector<std::pair<int, TraceEvent>> mFinishedTraceEvents;
+    /** the trace index of each thread, a thread which is started again with the same id gets the same index */
+    std::map<std::thread::id, int> mThreadIndexes;
+    /** taken when a thread adds its first result or ends and when the buffers are read */
+    mutable std::mutex mThreadResultsSync;
 };
 
 class CPPCHECKLIB Timer {
@@ -79,10 +153,14 @@ public:
 
     void stop();
 
+    /** CPU time used by the calling thread */
+    static std::chrono::nanoseconds threadCpuTime();
+
 private:
     const std::string mStr;
     TimerResultsIntf* mTimerResults{};
-    std::clock_t mStart = std::clock();
+    std::chrono::nanoseconds mCpuStart = threadCpuTime();
+    std::chrono::steady_clock::time_point mWallStart = std::chrono::steady_clock::now();
     const SHOWTIME_MODES mShowTimeMode = SHOWTIME_MODES::SHOWTIME_FILE_TOTAL;
     bool mStopped{};
 };
@@ -25,6 +25,7 @@
 #include "simplecpp.h"
 #include "symboldatabase.h"
 #include "tokenlist.h"
+#include "tokenstrings.h"
 #include "utils.h"
 #include "tokenrange.h"
 #include "valueflow.h"
@@ -33,6 +34,7 @@
 #include <cassert>
 #include <cctype>
 #include <climits>
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <functional>
@@ -43,8 +45,10 @@
 #include <sstream>
 #include <stack>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace {
     struct less {
@@ -55,16 +59,17 @@ namespace {
     };
 }
 
-const std::list<ValueFlow::Value> TokenImpl::mEmptyValueList;
+const ValueFlow::ValueList TokenImpl::mEmptyValueList;
 
 Token::Token(TokensFrontBack &tokensFrontBack) :
     mTokensFrontBack(tokensFrontBack)
 {
     mImpl = new TokenImpl();
+    ++mTokensFrontBack.tokens;
 }
 
-Token::Token(const Token* tok)
-    : Token(const_cast<Token*>(tok)->mTokensFrontBack)
+Token::Token(TokensFrontBack &tokensFrontBack, const Token* tok)
+    : Token(tokensFrontBack)
 {
     fileIndex(tok->fileIndex());
     linenr(tok->linenr());
@@ -72,7 +77,9 @@ Token::Token(const Token* tok)
 
 Token::~Token()
 {
+    valuesDeleted();
     delete mImpl;
+    --mTokensFrontBack.tokens;
 }
 
 /*
@@ -86,23 +93,34 @@ ConstTokenRange Token::until(const Token* t) const
     return ConstTokenRange(this, t);
 }
 
-static const std::unordered_set<std::string> controlFlowKeywords = {
-    "goto",
-    "do",
-    "if",
-    "else",
-    "for",
-    "while",
-    "switch",
-    "case",
-    "break",
-    "continue",
-    "return"
-};
+static const std::unordered_map<std::string, std::uint16_t> fixedStrIds = [] {
+    std::unordered_map<std::string, std::uint16_t> ids;
+    for (std::uint16_t i = 0; i < TokenStrings::fixedCount; ++i)
+        ids.emplace(TokenStrings::fixed[i], i + 1);
+    return ids;
+}();
+
+std::uint16_t TokenStrings::fixedId(const std::string &s)
+{
+    // most names are longer than the keywords, they are not hashed
+    static constexpr std::size_t maxFixedLength = TokenStrings::maxLength();
+    if (s.empty() || s.size() > maxFixedLength)
+        return 0;
+    const auto it = fixedStrIds.find(s);
+    return it == fixedStrIds.end() ? 0 : it->second;
+}
+
+static const std::vector<bool> controlFlowKeywords = [] {
+    std::vector<bool> ids(TokenStrings::fixedCount + 1);
+    for (const char *keyword : { "goto", "do", "if", "else", "for", "while", "switch", "case", "break", "continue", "return" })
+        ids[TokenStrings::fixedId(keyword)] = true;
+    return ids;
+}();
 
 void Token::update_property_info()
 {
-    setFlag(fIsControlFlowKeyword, controlFlowKeywords.find(mStr) != controlFlowKeywords.end());
+    mStrId = TokenStrings::fixedId(mStr);
+    setFlag(fIsControlFlowKeyword, controlFlowKeywords[mStrId]);
     isStandardType(false);
 
     if (!mStr.empty()) {
@@ -193,6 +211,11 @@ void Token::update_property_isStandardType()
     }
 }
 
+bool Token::isInSameList(const Token *tok) const
+{
+    return &tok->mTokensFrontBack == &mTokensFrontBack;
+}
+
 bool Token::isUpperCaseName() const
 {
     if (!isName())
@@ -279,18 +302,19 @@ void Token::swapWithNext()
 {
     if (mNext) {
         std::swap(mStr, mNext->mStr);
+        std::swap(mStrId, mNext->mStrId);
         std::swap(mTokType, mNext->mTokType);
         std::swap(mFlags, mNext->mFlags);
         std::swap(mImpl, mNext->mImpl);
-        if (mImpl->mTemplateSimplifierPointers)
+        if (templateSimplifierPointers())
             // cppcheck-suppress shadowFunction - TODO: fix this
-            for (auto *templateSimplifierPointer : *mImpl->mTemplateSimplifierPointers) {
+            for (auto *templateSimplifierPointer : *templateSimplifierPointers()) {
                 templateSimplifierPointer->token(this);
             }
 
-        if (mNext->mImpl->mTemplateSimplifierPointers)
+        if (mNext->templateSimplifierPointers())
             // cppcheck-suppress shadowFunction - TODO: fix this
-            for (auto *templateSimplifierPointer : *mNext->mImpl->mTemplateSimplifierPointers) {
+            for (auto *templateSimplifierPointer : *mNext->templateSimplifierPointers()) {
                 templateSimplifierPointer->token(mNext);
             }
         if (mNext->mLink)
@@ -304,14 +328,16 @@ void Token::swapWithNext()
 void Token::takeData(Token *fromToken)
 {
     mStr = fromToken->mStr;
+    mStrId = fromToken->mStrId;
     tokType(fromToken->mTokType);
     mFlags = fromToken->mFlags;
+    valuesDeleted();
     delete mImpl;
     mImpl = fromToken->mImpl;
     fromToken->mImpl = nullptr;
-    if (mImpl->mTemplateSimplifierPointers)
+    if (templateSimplifierPointers())
         // cppcheck-suppress shadowFunction - TODO: fix this
-        for (auto *templateSimplifierPointer : *mImpl->mTemplateSimplifierPointers) {
+        for (auto *templateSimplifierPointer : *templateSimplifierPointers()) {
             templateSimplifierPointer->token(this);
         }
     mLink = fromToken->mLink;
@@ -1062,7 +1088,8 @@ Token* Token::insertToken(const std::string& tokenStr, const std::string& origin
             newToken->previous(this);
         }
 
-        if (mImpl->mScopeInfo) {
+        if (mImpl->mCold && mImpl->mCold->mScopeInfo) {
+            const std::shared_ptr<ScopeInfo2>& scopeInfo = mImpl->mCold->mScopeInfo;
             // If the brace is immediately closed there is no point opening a new scope for it
             if (newToken->str() == "{") {
                 std::string nextScopeNameAddition;
@@ -1114,7 +1141,7 @@ Token* Token::insertToken(const std::string& tokenStr, const std::string& origin
                 }
 
                 // New scope is opening, record it here
-                std::shared_ptr<ScopeInfo2> newScopeInfo = std::make_shared<ScopeInfo2>(mImpl->mScopeInfo->name, nullptr, mImpl->mScopeInfo->usingNamespaces);
+                std::shared_ptr<ScopeInfo2> newScopeInfo = std::make_shared<ScopeInfo2>(scopeInfo->name, nullptr, scopeInfo->usingNamespaces);
 
                 if (!newScopeInfo->name.empty() && !nextScopeNameAddition.empty()) newScopeInfo->name.append(" :: ");
                 newScopeInfo->name.append(nextScopeNameAddition);
@@ -1130,13 +1157,13 @@ Token* Token::insertToken(const std::string& tokenStr, const std::string& origin
                     matchingTok = matchingTok->previous();
                 }
                 if (matchingTok && matchingTok->previous()) {
-                    newToken->mImpl->mScopeInfo = matchingTok->previous()->scopeInfo();
+                    newToken->scopeInfo(matchingTok->previous()->scopeInfo());
                 }
             } else {
                 if (prepend && newToken->previous()) {
-                    newToken->mImpl->mScopeInfo = newToken->previous()->scopeInfo();
+                    newToken->scopeInfo(newToken->previous()->scopeInfo());
                 } else {
-                    newToken->mImpl->mScopeInfo = mImpl->mScopeInfo;
+                    newToken->scopeInfo(scopeInfo);
                 }
                 if (newToken->str() == ";") {
                     const Token* statementStart;
@@ -1150,7 +1177,7 @@ Token* Token::insertToken(const std::string& tokenStr, const std::string& origin
                             nameSpace += tok1->str();
                             tok1 = tok1->next();
                         }
-                        mImpl->mScopeInfo->usingNamespaces.insert(nameSpace);
+                        scopeInfo->usingNamespaces.insert(nameSpace);
                     }
                 }
             }
@@ -1890,7 +1917,7 @@ const ValueFlow::Value * Token::getInvalidValue(const Token *ftok, nonneg int ar
     if (!mImpl->mValues)
         return nullptr;
     const ValueFlow::Value *ret = nullptr;
-    for (std::list<ValueFlow::Value>::const_iterator it = mImpl->mValues->begin(); it != mImpl->mValues->end(); ++it) {
+    for (ValueFlow::ValueList::const_iterator it = mImpl->mValues->begin(); it != mImpl->mValues->end(); ++it) {
         if (it->isImpossible())
             continue;
         if ((it->isIntValue() && !settings.library.isIntArgValid(ftok, argnr, it->intvalue)) ||
@@ -1916,7 +1943,7 @@ const Token *Token::getValueTokenMinStrSize(const Settings &settings, MathLib::b
         return nullptr;
     const Token *ret = nullptr;
     int minsize = INT_MAX;
-    for (std::list<ValueFlow::Value>::const_iterator it = mImpl->mValues->begin(); it != mImpl->mValues->end(); ++it) {
+    for (ValueFlow::ValueList::const_iterator it = mImpl->mValues->begin(); it != mImpl->mValues->end(); ++it) {
         if (it->isTokValue() && it->tokvalue && it->tokvalue->tokType() == Token::eString) {
             const int size = getStrSize(it->tokvalue, settings);
             if (!ret || size < minsize) {
@@ -1936,7 +1963,7 @@ const Token *Token::getValueTokenMaxStrLength() const
         return nullptr;
     const Token *ret = nullptr;
     int maxlength = 0;
-    for (std::list<ValueFlow::Value>::const_iterator it = mImpl->mValues->begin(); it != mImpl->mValues->end(); ++it) {
+    for (ValueFlow::ValueList::const_iterator it = mImpl->mValues->begin(); it != mImpl->mValues->end(); ++it) {
         if (it->isTokValue() && it->tokvalue && it->tokvalue->tokType() == Token::eString) {
             const int length = getStrLength(it->tokvalue);
             if (!ret || length > maxlength) {
@@ -1957,7 +1984,7 @@ static bool isAdjacent(const ValueFlow::Value& x, const ValueFlow::Value& y)
     return std::abs(x.intvalue - y.intvalue) == 1;
 }
 
-static bool removePointValue(std::list<ValueFlow::Value>& values, std::list<ValueFlow::Value>::iterator& x)
+static bool removePointValue(ValueFlow::ValueList& values, ValueFlow::ValueList::iterator& x)
 {
     const bool isPoint = x->bound == ValueFlow::Value::Bound::Point;
     if (!isPoint)
@@ -1967,7 +1994,7 @@ static bool removePointValue(std::list<ValueFlow::Value>& values, std::list<Valu
     return isPoint;
 }
 
-static bool removeContradiction(std::list<ValueFlow::Value>& values)
+static bool removeContradiction(ValueFlow::ValueList& values)
 {
     bool result = false;
     for (auto itx = values.begin(); itx != values.end(); ++itx) {
@@ -1988,7 +2015,7 @@ static bool removeContradiction(std::list<ValueFlow::Value>& values)
             if (itx->isSymbolicValue() && !ValueFlow::Value::sameToken(itx->tokvalue, ity->tokvalue))
                 continue;
             if (!itx->equalValue(*ity)) {
-                auto compare = [](const std::list<ValueFlow::Value>::const_iterator& x, const std::list<ValueFlow::Value>::const_iterator& y) {
+                auto compare = [](const ValueFlow::ValueList::const_iterator& x, const ValueFlow::ValueList::const_iterator& y) {
                     return x->compareValue(*y, less{});
                 };
                 auto itMax = std::max(itx, ity, compare);
@@ -2027,11 +2054,11 @@ static bool removeContradiction(std::list<ValueFlow::Value>& values)
     return result;
 }
 
-using ValueIterator = std::list<ValueFlow::Value>::iterator;
+using ValueIterator = ValueFlow::ValueList::iterator;
 
 template<class Iterator>
 // NOLINTNEXTLINE(performance-unnecessary-value-param) - false positive
-static ValueIterator removeAdjacentValues(std::list<ValueFlow::Value>& values, ValueIterator x, Iterator start, Iterator last)
+static ValueIterator removeAdjacentValues(ValueFlow::ValueList& values, ValueIterator x, Iterator start, Iterator last)
 {
     if (!isAdjacent(*x, **start))
         return std::next(x);
@@ -2047,7 +2074,7 @@ static ValueIterator removeAdjacentValues(std::list<ValueFlow::Value>& values, V
     return values.erase(x);
 }
 
-static void mergeAdjacent(std::list<ValueFlow::Value>& values)
+static void mergeAdjacent(ValueFlow::ValueList& values)
 {
     for (auto x = values.begin(); x != values.end();) {
         if (x->isNonValue()) {
@@ -2103,7 +2130,7 @@ static void mergeAdjacent(std::list<ValueFlow::Value>& values)
     }
 }
 
-static void removeOverlaps(std::list<ValueFlow::Value>& values)
+static void removeOverlaps(ValueFlow::ValueList& values)
 {
     for (const ValueFlow::Value& x : values) {
         if (x.isNonValue())
@@ -2131,7 +2158,7 @@ static void removeOverlaps(std::list<ValueFlow::Value>& values)
 
 // Removing contradictions is an NP-hard problem. Instead we run multiple
 // passes to try to catch most contradictions
-static void removeContradictions(std::list<ValueFlow::Value>& values)
+static void removeContradictions(ValueFlow::ValueList& values)
 {
     removeOverlaps(values);
     for (int i = 0; i < 4; i++) {
@@ -2151,7 +2178,30 @@ static bool sameValueType(const ValueFlow::Value& x, const ValueFlow::Value& y)
     return true;
 }
 
+void Token::valuesChanged(std::size_t oldSize)
+{
+    mTokensFrontBack.values -= oldSize;
+    mTokensFrontBack.values += values().size();
+}
+
+void Token::valuesDeleted()
+{
+    if (mImpl && mImpl->mValues)
+        mTokensFrontBack.values -= mImpl->mValues->size();
+}
+
 bool Token::addValue(const ValueFlow::Value &value)
+{
+    if (value.isPossible() && !mTokensFrontBack.possibleValues)
+        return false;
+    const std::size_t oldSize = values().size();
+    const bool added = addValueInternal(value);
+    if (added || values().size() != oldSize)
+        valuesChanged(oldSize);
+    return added;
+}
+
+bool Token::addValueInternal(const ValueFlow::Value &value)
 {
     if (value.isKnown() && mImpl->mValues) {
         // Clear all other values of the same type since value is known
@@ -2179,7 +2229,7 @@ bool Token::addValue(const ValueFlow::Value &value)
             return false;
 
         // if value already exists, don't add it again
-        std::list<ValueFlow::Value>::iterator it;
+        ValueFlow::ValueList::iterator it;
         for (it = mImpl->mValues->begin(); it != mImpl->mValues->end(); ++it) {
             // different types => continue
             if (it->valueType != value.valueType)
@@ -2221,7 +2271,7 @@ bool Token::addValue(const ValueFlow::Value &value)
         ValueFlow::Value v(value);
         if (v.varId == 0)
             v.varId = mImpl->mVarId;
-        mImpl->mValues = new std::list<ValueFlow::Value>;
+        mImpl->mValues = new ValueFlow::ValueList(ValueFlow::ValueAllocator<ValueFlow::Value>(&mTokensFrontBack.valueArena));
         mImpl->mValues->push_back(std::move(v));
     }
 
@@ -2442,11 +2492,16 @@ std::string Token::typeStr(const Token* tok)
 
 void Token::scopeInfo(std::shared_ptr<ScopeInfo2> newScopeInfo)
 {
-    mImpl->mScopeInfo = std::move(newScopeInfo);
+    if (newScopeInfo) {
+        mImpl->cold().mScopeInfo = std::move(newScopeInfo);
+    } else if (mImpl->mCold) {
+        mImpl->mCold->mScopeInfo.reset();
+        mImpl->releaseCold();
+    }
 }
 std::shared_ptr<ScopeInfo2> Token::scopeInfo() const
 {
-    return mImpl->mScopeInfo;
+    return mImpl->mCold ? mImpl->mCold->mScopeInfo : nullptr;
 }
 
 bool Token::hasKnownIntValue() const
@@ -2503,7 +2558,7 @@ const ValueFlow::Value* Token::getValue(const MathLib::bigint val) const
 }
 
 template<class Compare>
-static const ValueFlow::Value* getCompareValue(const std::list<ValueFlow::Value>& values,
+static const ValueFlow::Value* getCompareValue(const ValueFlow::ValueList& values,
                                                bool condition,
                                                MathLib::bigint path,
                                                Compare compare)
@@ -2560,10 +2615,12 @@ const ValueFlow::Value* Token::getContainerSizeValue(const MathLib::bigint val)
 
 TokenImpl::~TokenImpl()
 {
-    delete mOriginalName;
     delete mValueType;
     delete mValues;
+}
 
+TokenImpl::Cold::~Cold()
+{
     if (mTemplateSimplifierPointers) {
         for (auto *templateSimplifierPointer : *mTemplateSimplifierPointers) {
             templateSimplifierPointer->token(nullptr);
@@ -2580,7 +2637,8 @@ TokenImpl::~TokenImpl()
 
 void TokenImpl::setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type type, MathLib::bigint value)
 {
-    CppcheckAttributes *attr = mCppcheckAttributes;
+    CppcheckAttributes *&cppcheckAttributes = cold().mCppcheckAttributes;
+    CppcheckAttributes *attr = cppcheckAttributes;
     while (attr && attr->type != type)
         attr = attr->next;
     if (attr)
@@ -2589,14 +2647,14 @@ void TokenImpl::setCppcheckAttribute(TokenImpl::CppcheckAttributes::Type type, M
         attr = new CppcheckAttributes;
         attr->type = type;
         attr->value = value;
-        attr->next = mCppcheckAttributes;
-        mCppcheckAttributes = attr;
+        attr->next = cppcheckAttributes;
+        cppcheckAttributes = attr;
     }
 }
 
 bool TokenImpl::getCppcheckAttribute(TokenImpl::CppcheckAttributes::Type type, MathLib::bigint &value) const
 {
-    CppcheckAttributes *attr = mCppcheckAttributes;
+    CppcheckAttributes *attr = mCold ? mCold->mCppcheckAttributes : nullptr;
     while (attr && attr->type != type)
         attr = attr->next;
     if (attr)
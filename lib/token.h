@@ -63,11 +63,35 @@ struct ScopeInfo2 {
 enum class TokenDebug : std::uint8_t { None, ValueFlow, ValueType };
 
 struct TokenImpl {
+    // The data that is used when matching tokens and walking the AST is kept
+    // together at the start. Data that only few tokens have is in mCold.
+
+    // AST..
+    Token* mAstOperand1{};
+    Token* mAstOperand2{};
+    Token* mAstParent{};
+
+    // symbol database information
+    const Scope* mScope{};
+    union {
+        const Function *mFunction;
+        const Variable *mVariable;
+        const ::Type* mType;
+        const Enumerator *mEnumerator;
+    };
+
+    // ValueType
+    ValueType* mValueType{};
+
+    // ValueFlow
+    ValueFlow::ValueList* mValues{};
+    static const ValueFlow::ValueList mEmptyValueList;
+
     nonneg int mVarId{};
+    nonneg int mExprId{};
     nonneg int mFileIndex{};
     nonneg int mLineNumber{};
     nonneg int mColumn{};
-    nonneg int mExprId{};
 
     /**
      * A value from 0-100 that provides a rough idea about where in the token
@@ -83,60 +107,66 @@ struct TokenImpl {
     /** Bitfield bit count. */
     unsigned char mBits{};
 
-    // AST..
-    Token* mAstOperand1{};
-    Token* mAstOperand2{};
-    Token* mAstParent{};
+    // For memoization, to speed up parsing of huge arrays #8897
+    enum class Cpp11init : std::uint8_t { UNKNOWN, CPP11INIT, NOINIT } mCpp11init = Cpp11init::UNKNOWN;
 
-    // symbol database information
-    const Scope* mScope{};
-    union {
-        const Function *mFunction;
-        const Variable *mVariable;
-        const ::Type* mType;
-        const Enumerator *mEnumerator;
+    TokenDebug mDebug{};
+
+    // __cppcheck_in_range__
+    struct CppcheckAttributes {
+        enum Type : std::uint8_t { LOW, HIGH } type = LOW;
+        MathLib::bigint value{};
+        CppcheckAttributes* next{};
     };
 
-    // original name like size_t
-    std::string* mOriginalName{};
+    /** Rarely used data. It is only allocated for the tokens that have some of it. */
+    struct Cold {
+        // original name like size_t
+        std::string mOriginalName;
 
-    // If this token came from a macro replacement list, this is the name of that macro
-    std::string mMacroName;
+        // If this token came from a macro replacement list, this is the name of that macro
+        std::string mMacroName;
 
-    // ValueType
-    ValueType* mValueType{};
+        // Pointer to a template in the template simplifier
+        std::set<TemplateSimplifier::TokenAndName*>* mTemplateSimplifierPointers{};
 
-    // ValueFlow
-    std::list<ValueFlow::Value>* mValues{};
-    static const std::list<ValueFlow::Value> mEmptyValueList;
+        // Pointer to the object representing this token's scope
+        std::shared_ptr<ScopeInfo2> mScopeInfo;
 
-    // Pointer to a template in the template simplifier
-    std::set<TemplateSimplifier::TokenAndName*>* mTemplateSimplifierPointers{};
+        CppcheckAttributes* mCppcheckAttributes{};
 
-    // Pointer to the object representing this token's scope
-    std::shared_ptr<ScopeInfo2> mScopeInfo;
+        // alignas expressions
+        std::vector<std::string> mAttributeAlignas;
 
-    // __cppcheck_in_range__
-    struct CppcheckAttributes {
-        enum Type : std::uint8_t { LOW, HIGH } type = LOW;
-        MathLib::bigint value{};
-        CppcheckAttributes* next{};
+        bool empty() const {
+            return mOriginalName.empty() && mMacroName.empty() && !mTemplateSimplifierPointers && !mScopeInfo &&
+                   !mCppcheckAttributes && mAttributeAlignas.empty();
+        }
+
+        Cold() = default;
+        Cold(const Cold &) = delete;
+        Cold& operator=(const Cold &) = delete;
+        ~Cold();
     };
-    CppcheckAttributes* mCppcheckAttributes{};
+    std::unique_ptr<Cold> mCold;
 
-    // alignas expressions
-    std::unique_ptr<std::vector<std::string>> mAttributeAlignas;
-    void addAttributeAlignas(const std::string& a) {
-        if (!mAttributeAlignas)
-            mAttributeAlignas = std::unique_ptr<std::vector<std::string>>(new std::vector<std::string>());
-        if (std::find(mAttributeAlignas->cbegin(), mAttributeAlignas->cend(), a) == mAttributeAlignas->cend())
-            mAttributeAlignas->push_back(a);
+    Cold& cold() {
+        if (!mCold)
+            mCold = std::unique_ptr<Cold>(new Cold);
+        return *mCold;
     }
 
-    // For memoization, to speed up parsing of huge arrays #8897
-    enum class Cpp11init : std::uint8_t { UNKNOWN, CPP11INIT, NOINIT } mCpp11init = Cpp11init::UNKNOWN;
+    /** Release the cold data when nothing is stored in it */
+    void releaseCold() {
+        if (mCold && mCold->empty())
+            mCold.reset();
+    }
 
-    TokenDebug mDebug{};
+    void addAttributeAlignas(const std::string& a) {
+        std::vector<std::string>& attributeAlignas = cold().mAttributeAlignas;
+        if (std::find(attributeAlignas.cbegin(), attributeAlignas.cend(), a) == attributeAlignas.cend())
+            attributeAlignas.push_back(a);
+    }
 
     void setCppcheckAttribute(CppcheckAttributes::Type type, MathLib::bigint value);
     bool getCppcheckAttribute(CppcheckAttributes::Type type, MathLib::bigint &value) const;
@@ -182,7 +212,7 @@ public:
 
     explicit Token(TokensFrontBack &tokensFrontBack);
     // for usage in CheckIO::ArgumentInfo only
-    explicit Token(const Token *tok);
+    Token(TokensFrontBack &tokensFrontBack, const Token *tok);
     ~Token();
 
     ConstTokenRange until(const Token * t) const;
@@ -205,6 +235,20 @@ public:
         return mStr;
     }
 
+    /**
+     * @return the fixed id of the string of this token if it is a keyword,
+     * an operator or a common name, otherwise 0. See TokenStrings.
+     */
+    std::uint16_t strId() const {
+        return mStrId;
+    }
+
+    /**
+     * @return true if this token and the given token are in the same token
+     * list.
+     */
+    bool isInSameList(const Token *tok) const;
+
     /**
      * Unlink and delete the next 'count' tokens.
      */
@@ -328,6 +372,21 @@ public:
      */
     static bool Match(const Token *tok, const char pattern[], nonneg int varid = 0);
 
+    /**
+     * Match given token (or list of tokens) to a pattern that is compiled
+     * by the C++ compiler. The pattern has the same syntax as for Match()
+     * and must be a constexpr char array at namespace scope:
+     *
+     * @code
+     * static constexpr char assignNum[] = "%var% = %num% ;";
+     * if (Token::Match<assignNum>(tok)) ...
+     * @endcode
+     *
+     * It is defined in tokenmatch.h which must be included where it is used.
+     */
+    template<const char* pattern>
+    static bool Match(const Token *tok, nonneg int varid = 0);
+
     /**
      * @return length of C-string.
      *
@@ -476,7 +535,7 @@ public:
         setFlag(fIsStandardType, b);
     }
     bool isExpandedMacro() const {
-        return !mImpl->mMacroName.empty();
+        return mImpl->mCold && !mImpl->mCold->mMacroName.empty();
     }
     bool isCast() const {
         return getFlag(fIsCast);
@@ -557,10 +616,10 @@ public:
         setFlag(fIsAttributeMaybeUnused, value);
     }
     std::vector<std::string> getAttributeAlignas() const {
-        return mImpl->mAttributeAlignas ? *mImpl->mAttributeAlignas : std::vector<std::string>();
+        return mImpl->mCold ? mImpl->mCold->mAttributeAlignas : std::vector<std::string>();
     }
     bool hasAttributeAlignas() const {
-        return !!mImpl->mAttributeAlignas;
+        return mImpl->mCold && !mImpl->mCold->mAttributeAlignas.empty();
     }
     void addAttributeAlignas(const std::string& a) {
         mImpl->addAttributeAlignas(a);
@@ -573,7 +632,7 @@ public:
     }
     // cppcheck-suppress unusedFunction
     bool hasCppcheckAttributes() const {
-        return nullptr != mImpl->mCppcheckAttributes;
+        return mImpl->mCold && nullptr != mImpl->mCold->mCppcheckAttributes;
     }
     bool isControlFlowKeyword() const {
         return getFlag(fIsControlFlowKeyword);
@@ -722,15 +781,16 @@ public:
         return mImpl->mBits;
     }
     const std::set<TemplateSimplifier::TokenAndName*>* templateSimplifierPointers() const {
-        return mImpl->mTemplateSimplifierPointers;
+        return mImpl->mCold ? mImpl->mCold->mTemplateSimplifierPointers : nullptr;
     }
     std::set<TemplateSimplifier::TokenAndName*>* templateSimplifierPointers() {
-        return mImpl->mTemplateSimplifierPointers;
+        return mImpl->mCold ? mImpl->mCold->mTemplateSimplifierPointers : nullptr;
     }
     void templateSimplifierPointer(TemplateSimplifier::TokenAndName* tokenAndName) {
-        if (!mImpl->mTemplateSimplifierPointers)
-            mImpl->mTemplateSimplifierPointers = new std::set<TemplateSimplifier::TokenAndName*>;
-        mImpl->mTemplateSimplifierPointers->insert(tokenAndName);
+        TokenImpl::Cold& cold = mImpl->cold();
+        if (!cold.mTemplateSimplifierPointers)
+            cold.mTemplateSimplifierPointers = new std::set<TemplateSimplifier::TokenAndName*>;
+        cold.mTemplateSimplifierPointers->insert(tokenAndName);
     }
     void setBits(const unsigned char b) {
         mImpl->mBits = b;
@@ -785,10 +845,12 @@ public:
     }
 
     std::string getMacroName() const {
-        return mImpl->mMacroName;
+        return mImpl->mCold ? mImpl->mCold->mMacroName : emptyString;
     }
     void setMacroName(std::string name) {
-        mImpl->mMacroName = std::move(name);
+        if (name.empty() && !mImpl->mCold)
+            return;
+        mImpl->cold().mMacroName = std::move(name);
     }
 
     template<size_t count>
@@ -1247,10 +1309,10 @@ public:
      * @return the original name.
      */
     const std::string & originalName() const {
-        return mImpl->mOriginalName ? *mImpl->mOriginalName : emptyString;
+        return mImpl->mCold ? mImpl->mCold->mOriginalName : emptyString;
     }
 
-    const std::list<ValueFlow::Value>& values() const {
+    const ValueFlow::ValueList& values() const {
         return mImpl->mValues ? *mImpl->mValues : TokenImpl::mEmptyValueList;
     }
 
@@ -1259,10 +1321,7 @@ public:
      */
     template<typename T>
     void originalName(T&& name) {
-        if (!mImpl->mOriginalName)
-            mImpl->mOriginalName = new std::string(name);
-        else
-            *mImpl->mOriginalName = name;
+        mImpl->cold().mOriginalName = name;
     }
 
     bool hasKnownIntValue() const;
@@ -1296,8 +1355,12 @@ public:
     bool addValue(const ValueFlow::Value &value);
 
     void removeValues(std::function<bool(const ValueFlow::Value &)> pred) {
-        if (mImpl->mValues)
+        if (mImpl->mValues) {
+            const std::size_t oldSize = mImpl->mValues->size();
             mImpl->mValues->remove_if(std::move(pred));
+            if (mImpl->mValues->size() != oldSize)
+                valuesChanged(oldSize);
+        }
     }
 
     nonneg int index() const {
@@ -1318,6 +1381,14 @@ private:
     /** used by deleteThis() to take data from token to delete */
     void takeData(Token *fromToken);
 
+    bool addValueInternal(const ValueFlow::Value &value);
+
+    /** Update the value count of the token list after the values have been changed */
+    void valuesChanged(std::size_t oldSize);
+
+    /** Remove the values from the value count of the token list before the values are deleted */
+    void valuesDeleted();
+
     /**
      * Works almost like strcmp() except returns only true or false and
      * if str has empty space &apos; &apos; character, that character is handled
@@ -1332,12 +1403,6 @@ private:
      */
     static const char *chrInFirstWord(const char *str, char c);
 
-    std::string mStr;
-
-    Token* mNext{};
-    Token* mPrevious{};
-    Token* mLink{};
-
     enum : uint64_t {
         fIsUnsigned             = (1ULL << 0),
         fIsSigned               = (1ULL << 1),
@@ -1389,11 +1454,22 @@ private:
         efIsUnique = efMaxSize - 2,
     };
 
-    Token::Type mTokType = eNone;
+    // The links and the classification are used for every token that is
+    // visited so they are kept next to each other.
+    Token* mNext{};
+    Token* mPrevious{};
+    Token* mLink{};
+
+    TokenImpl* mImpl{};
 
     uint64_t mFlags{};
 
-    TokenImpl* mImpl{};
+    Token::Type mTokType = eNone;
+
+    /** fixed id of mStr, see TokenStrings */
+    std::uint16_t mStrId{};
+
+    std::string mStr;
 
     /**
      * Get specified flag state.
@@ -1492,8 +1568,12 @@ public:
     bool isCalculation() const;
 
     void clearValueFlow() {
-        delete mImpl->mValues;
-        mImpl->mValues = nullptr;
+        if (mImpl->mValues) {
+            const std::size_t oldSize = mImpl->mValues->size();
+            delete mImpl->mValues;
+            mImpl->mValues = nullptr;
+            valuesChanged(oldSize);
+        }
     }
 
     std::string astString(const char *sep = "") const {
@@ -4126,6 +4126,10 @@ void Tokenizer::simplifyTemplates()
     const std::time_t maxTime = mSettings.templateMaxTime > 0 ? std::time(nullptr) + mSettings.templateMaxTime : 0;
     mTemplateSimplifier->simplifyTemplates(
         maxTime);
+
+    // the scope information is only used by the template simplifier
+    for (Token *tok = list.front(); tok; tok = tok->next())
+        tok->scopeInfo(nullptr);
 }
 //---------------------------------------------------------------------------
 
@@ -5947,7 +5951,7 @@ void Tokenizer::printDebugOutput(int simplification) const
     }
 }
 
-void Tokenizer::dump(std::ostream &out) const
+void Tokenizer::dump(std::ostream &out, std::uint8_t sections) const
 {
     // Create a xml data dump.
     // The idea is not that this will be readable for humans. It's a
@@ -5957,204 +5961,208 @@ void Tokenizer::dump(std::ostream &out) const
 
     std::set<const Library::Container*> containers;
 
-    outs += "  <directivelist>";
-    outs += '\n';
-    for (const Directive &dir : mDirectives) {
-        outs += "    <directive ";
-        outs += "file=\"";
-        outs += ErrorLogger::toxml(Path::getRelativePath(dir.file, mSettings.basePaths));
-        outs += "\" ";
-        outs += "linenr=\"";
-        outs += std::to_string(dir.linenr);
-        outs += "\" ";
-        // str might contain characters such as '"', '<' or '>' which
-        // could result in invalid XML, so run it through toxml().
-        outs += "str=\"";
-        outs += ErrorLogger::toxml(dir.str);
-        outs +="\">";
+    if (sections & AddonInfo::DumpDirectives) {
+        outs += "  <directivelist>";
         outs += '\n';
-        for (const auto & strToken : dir.strTokens) {
-            outs += "      <token ";
-            outs += "column=\"";
-            outs += std::to_string(strToken.column);
+        for (const Directive &dir : mDirectives) {
+            outs += "    <directive ";
+            outs += "file=\"";
+            outs += ErrorLogger::toxml(Path::getRelativePath(dir.file, mSettings.basePaths));
+            outs += "\" ";
+            outs += "linenr=\"";
+            outs += std::to_string(dir.linenr);
             outs += "\" ";
+            // str might contain characters such as '"', '<' or '>' which
+            // could result in invalid XML, so run it through toxml().
             outs += "str=\"";
-            outs += ErrorLogger::toxml(strToken.tokStr);
-            outs +="\"/>";
+            outs += ErrorLogger::toxml(dir.str);
+            outs +="\">";
+            outs += '\n';
+            for (const auto & strToken : dir.strTokens) {
+                outs += "      <token ";
+                outs += "column=\"";
+                outs += std::to_string(strToken.column);
+                outs += "\" ";
+                outs += "str=\"";
+                outs += ErrorLogger::toxml(strToken.tokStr);
+                outs +="\"/>";
+                outs += '\n';
+            }
+            outs += "    </directive>";
             outs += '\n';
         }
-        outs += "    </directive>";
+        outs += "  </directivelist>";
         outs += '\n';
     }
-    outs += "  </directivelist>";
-    outs += '\n';
 
     // tokens..
-    outs += "  <tokenlist>";
-    outs += '\n';
-    for (const Token *tok = list.front(); tok; tok = tok->next()) {
-        outs += "    <token id=\"";
-        outs += id_string(tok);
-        outs += "\" file=\"";
-        outs += ErrorLogger::toxml(list.file(tok));
-        outs += "\" linenr=\"";
-        outs += std::to_string(tok->linenr());
-        outs += "\" column=\"";
-        outs += std::to_string(tok->column());
-        outs += "\"";
-
-        outs += " str=\"";
-        outs += ErrorLogger::toxml(tok->str());
-        outs += '\"';
-
-        outs += " scope=\"";
-        outs += id_string(tok->scope());
-        outs += '\"';
-        if (tok->isName()) {
-            outs += " type=\"name\"";
-            if (tok->isUnsigned())
-                outs += " isUnsigned=\"true\"";
-            else if (tok->isSigned())
-                outs += " isSigned=\"true\"";
-        } else if (tok->isNumber()) {
-            outs += " type=\"number\"";
-            if (MathLib::isInt(tok->str()))
-                outs += " isInt=\"true\"";
-            if (MathLib::isFloat(tok->str()))
-                outs += " isFloat=\"true\"";
-        } else if (tok->tokType() == Token::eString) {
-            outs += " type=\"string\" strlen=\"";
-            outs += std::to_string(Token::getStrLength(tok));
-            outs += '\"';
-        }
-        else if (tok->tokType() == Token::eChar)
-            outs += " type=\"char\"";
-        else if (tok->isBoolean())
-            outs += " type=\"boolean\"";
-        else if (tok->isOp()) {
-            outs += " type=\"op\"";
-            if (tok->isArithmeticalOp())
-                outs += " isArithmeticalOp=\"true\"";
-            else if (tok->isAssignmentOp())
-                outs += " isAssignmentOp=\"true\"";
-            else if (tok->isComparisonOp())
-                outs += " isComparisonOp=\"true\"";
-            else if (tok->tokType() == Token::eLogicalOp)
-                outs += " isLogicalOp=\"true\"";
-        }
-        if (tok->isCast())
-            outs += " isCast=\"true\"";
-        if (tok->isExternC())
-            outs += " externLang=\"C\"";
-        if (tok->isExpandedMacro())
-            outs += " macroName=\"" + tok->getMacroName() + "\"";
-        if (tok->isTemplateArg())
-            outs += " isTemplateArg=\"true\"";
-        if (tok->isRemovedVoidParameter())
-            outs += " isRemovedVoidParameter=\"true\"";
-        if (tok->isSplittedVarDeclComma())
-            outs += " isSplittedVarDeclComma=\"true\"";
-        if (tok->isSplittedVarDeclEq())
-            outs += " isSplittedVarDeclEq=\"true\"";
-        if (tok->isImplicitInt())
-            outs += " isImplicitInt=\"true\"";
-        if (tok->isComplex())
-            outs += " isComplex=\"true\"";
-        if (tok->isRestrict())
-            outs += " isRestrict=\"true\"";
-        if (tok->isAtomic())
-            outs += " isAtomic=\"true\"";
-        if (tok->isAttributeExport())
-            outs += " isAttributeExport=\"true\"";
-        if (tok->isAttributeMaybeUnused())
-            outs += " isAttributeMaybeUnused=\"true\"";
-        if (tok->isAttributeUnused())
-            outs += " isAttributeUnused=\"true\"";
-        if (tok->hasAttributeAlignas()) {
-            const std::vector<std::string>& a = tok->getAttributeAlignas();
-            outs += " alignas=\"" + ErrorLogger::toxml(a[0]) + "\"";
-            if (a.size() > 1)
-                // we could write all alignas expressions but currently we only need 2
-                outs += " alignas2=\"" + ErrorLogger::toxml(a[1]) + "\"";
-        }
-        if (tok->link()) {
-            outs += " link=\"";
-            outs += id_string(tok->link());
-            outs += '\"';
-        }
-        if (tok->varId() > 0) {
-            outs += " varId=\"";
-            outs += std::to_string(tok->varId());
-            outs += '\"';
-        }
-        if (tok->exprId() > 0) {
-            outs += " exprId=\"";
-            outs += std::to_string(tok->exprId());
-            outs += '\"';
-        }
-        if (tok->variable()) {
-            outs += " variable=\"";
-            outs += id_string(tok->variable());
-            outs += '\"';
-        }
-        if (tok->function()) {
-            outs += " function=\"";
-            outs += id_string(tok->function());
-            outs += '\"';
-        }
-        if (!tok->values().empty()) {
-            outs += " values=\"";
-            outs += id_string(&tok->values());
-            outs += '\"';
-        }
-        if (tok->type()) {
-            outs += " type-scope=\"";
-            outs += id_string(tok->type()->classScope);
-            outs += '\"';
-        }
-        if (tok->astParent()) {
-            outs += " astParent=\"";
-            outs += id_string(tok->astParent());
-            outs += '\"';
-        }
-        if (tok->astOperand1()) {
-            outs += " astOperand1=\"";
-            outs += id_string(tok->astOperand1());
-            outs += '\"';
-        }
-        if (tok->astOperand2()) {
-            outs += " astOperand2=\"";
-            outs += id_string(tok->astOperand2());
+    if (sections & AddonInfo::DumpTokens) {
+        outs += "  <tokenlist>";
+        outs += '\n';
+        for (const Token *tok = list.front(); tok; tok = tok->next()) {
+            outs += "    <token id=\"";
+            outs += id_string(tok);
+            outs += "\" file=\"";
+            outs += ErrorLogger::toxml(list.file(tok));
+            outs += "\" linenr=\"";
+            outs += std::to_string(tok->linenr());
+            outs += "\" column=\"";
+            outs += std::to_string(tok->column());
+            outs += "\"";
+
+            outs += " str=\"";
+            outs += ErrorLogger::toxml(tok->str());
             outs += '\"';
-        }
-        if (!tok->originalName().empty()) {
-            outs += " originalName=\"";
-            outs += tok->originalName();
+
+            outs += " scope=\"";
+            outs += id_string(tok->scope());
             outs += '\"';
-        }
-        if (tok->valueType()) {
-            const std::string vt = tok->valueType()->dump();
-            if (!vt.empty()) {
-                outs += ' ';
-                outs += vt;
+            if (tok->isName()) {
+                outs += " type=\"name\"";
+                if (tok->isUnsigned())
+                    outs += " isUnsigned=\"true\"";
+                else if (tok->isSigned())
+                    outs += " isSigned=\"true\"";
+            } else if (tok->isNumber()) {
+                outs += " type=\"number\"";
+                if (MathLib::isInt(tok->str()))
+                    outs += " isInt=\"true\"";
+                if (MathLib::isFloat(tok->str()))
+                    outs += " isFloat=\"true\"";
+            } else if (tok->tokType() == Token::eString) {
+                outs += " type=\"string\" strlen=\"";
+                outs += std::to_string(Token::getStrLength(tok));
+                outs += '\"';
+            }
+            else if (tok->tokType() == Token::eChar)
+                outs += " type=\"char\"";
+            else if (tok->isBoolean())
+                outs += " type=\"boolean\"";
+            else if (tok->isOp()) {
+                outs += " type=\"op\"";
+                if (tok->isArithmeticalOp())
+                    outs += " isArithmeticalOp=\"true\"";
+                else if (tok->isAssignmentOp())
+                    outs += " isAssignmentOp=\"true\"";
+                else if (tok->isComparisonOp())
+                    outs += " isComparisonOp=\"true\"";
+                else if (tok->tokType() == Token::eLogicalOp)
+                    outs += " isLogicalOp=\"true\"";
+            }
+            if (tok->isCast())
+                outs += " isCast=\"true\"";
+            if (tok->isExternC())
+                outs += " externLang=\"C\"";
+            if (tok->isExpandedMacro())
+                outs += " macroName=\"" + tok->getMacroName() + "\"";
+            if (tok->isTemplateArg())
+                outs += " isTemplateArg=\"true\"";
+            if (tok->isRemovedVoidParameter())
+                outs += " isRemovedVoidParameter=\"true\"";
+            if (tok->isSplittedVarDeclComma())
+                outs += " isSplittedVarDeclComma=\"true\"";
+            if (tok->isSplittedVarDeclEq())
+                outs += " isSplittedVarDeclEq=\"true\"";
+            if (tok->isImplicitInt())
+                outs += " isImplicitInt=\"true\"";
+            if (tok->isComplex())
+                outs += " isComplex=\"true\"";
+            if (tok->isRestrict())
+                outs += " isRestrict=\"true\"";
+            if (tok->isAtomic())
+                outs += " isAtomic=\"true\"";
+            if (tok->isAttributeExport())
+                outs += " isAttributeExport=\"true\"";
+            if (tok->isAttributeMaybeUnused())
+                outs += " isAttributeMaybeUnused=\"true\"";
+            if (tok->isAttributeUnused())
+                outs += " isAttributeUnused=\"true\"";
+            if (tok->hasAttributeAlignas()) {
+                const std::vector<std::string>& a = tok->getAttributeAlignas();
+                outs += " alignas=\"" + ErrorLogger::toxml(a[0]) + "\"";
+                if (a.size() > 1)
+                    // we could write all alignas expressions but currently we only need 2
+                    outs += " alignas2=\"" + ErrorLogger::toxml(a[1]) + "\"";
+            }
+            if (tok->link()) {
+                outs += " link=\"";
+                outs += id_string(tok->link());
+                outs += '\"';
+            }
+            if (tok->varId() > 0) {
+                outs += " varId=\"";
+                outs += std::to_string(tok->varId());
+                outs += '\"';
+            }
+            if (tok->exprId() > 0) {
+                outs += " exprId=\"";
+                outs += std::to_string(tok->exprId());
+                outs += '\"';
+            }
+            if (tok->variable()) {
+                outs += " variable=\"";
+                outs += id_string(tok->variable());
+                outs += '\"';
+            }
+            if (tok->function()) {
+                outs += " function=\"";
+                outs += id_string(tok->function());
+                outs += '\"';
+            }
+            if (!tok->values().empty()) {
+                outs += " values=\"";
+                outs += id_string(&tok->values());
+                outs += '\"';
+            }
+            if (tok->type()) {
+                outs += " type-scope=\"";
+                outs += id_string(tok->type()->classScope);
+                outs += '\"';
+            }
+            if (tok->astParent()) {
+                outs += " astParent=\"";
+                outs += id_string(tok->astParent());
+                outs += '\"';
+            }
+            if (tok->astOperand1()) {
+                outs += " astOperand1=\"";
+                outs += id_string(tok->astOperand1());
+                outs += '\"';
+            }
+            if (tok->astOperand2()) {
+                outs += " astOperand2=\"";
+                outs += id_string(tok->astOperand2());
+                outs += '\"';
+            }
+            if (!tok->originalName().empty()) {
+                outs += " originalName=\"";
+                outs += tok->originalName();
+                outs += '\"';
+            }
+            if (tok->valueType()) {
+                const std::string vt = tok->valueType()->dump();
+                if (!vt.empty()) {
+                    outs += ' ';
+                    outs += vt;
+                }
+                containers.insert(tok->valueType()->container);
+            }
+            if (!tok->varId() && tok->scope()->isExecutable() && Token::Match(tok, "%name% (")) {
+                if (mSettings.library.isnoreturn(tok))
+                    outs += " noreturn=\"true\"";
             }
-            containers.insert(tok->valueType()->container);
-        }
-        if (!tok->varId() && tok->scope()->isExecutable() && Token::Match(tok, "%name% (")) {
-            if (mSettings.library.isnoreturn(tok))
-                outs += " noreturn=\"true\"";
-        }
 
-        outs += "/>";
+            outs += "/>";
+            outs += '\n';
+        }
+        outs += "  </tokenlist>";
         outs += '\n';
     }
-    outs += "  </tokenlist>";
-    outs += '\n';
 
     out << outs;
     outs.clear();
 
-    if (mSymbolDatabase)
+    if (mSymbolDatabase && (sections & AddonInfo::DumpScopes))
         mSymbolDatabase->printXml(out);
 
     containers.erase(nullptr);
@@ -6176,10 +6184,10 @@ void Tokenizer::dump(std::ostream &out) const
         outs += '\n';
     }
 
-    if (list.front())
+    if (list.front() && (sections & AddonInfo::DumpValueFlow))
         list.front()->printValueFlow(true, out);
 
-    if (!mTypedefInfo.empty()) {
+    if (!mTypedefInfo.empty() && (sections & AddonInfo::DumpTokens)) {
         outs += "  <typedef-info>";
         outs += '\n';
         for (const TypedefInfo &typedefInfo: mTypedefInfo) {
@@ -6211,7 +6219,8 @@ void Tokenizer::dump(std::ostream &out) const
         outs += "  </typedef-info>";
         outs += '\n';
     }
-    outs += mTemplateSimplifier->dump();
+    if (sections & AddonInfo::DumpTokens)
+        outs += mTemplateSimplifier->dump();
 
     out << outs;
 }
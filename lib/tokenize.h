@@ -21,6 +21,7 @@
 #define tokenizeH
 //---------------------------------------------------------------------------
 
+#include "addoninfo.h"
 #include "config.h"
 #include "tokenlist.h"
 
@@ -573,7 +574,8 @@ public:
      */
     void printDebugOutput(int simplification) const;
 
-    void dump(std::ostream &out) const;
+    /** write the dump xml data, @param sections the AddonInfo::DumpSection that are written */
+    void dump(std::ostream &out, std::uint8_t sections = AddonInfo::DumpAll) const;
 
     Token *deleteInvalidTypedef(Token *typeDef);
 
@@ -423,6 +423,21 @@ void TokenList::createTokens(simplecpp::TokenList&& tokenList)
 
 //---------------------------------------------------------------------------
 
+std::size_t TokenList::memoryUsage() const
+{
+    return mTokensFrontBack.tokens * (sizeof(Token) + sizeof(TokenImpl)) + mTokensFrontBack.valueArena.allocated();
+}
+
+void TokenList::removePossibleValues()
+{
+    mTokensFrontBack.possibleValues = false;
+    for (Token* tok = front(); tok; tok = tok->next()) {
+        tok->removeValues([](const ValueFlow::Value& v) {
+            return v.isPossible();
+        });
+    }
+}
+
 std::size_t TokenList::calculateHash() const
 {
     std::string hashData;
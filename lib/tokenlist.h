@@ -23,7 +23,9 @@
 
 #include "config.h"
 #include "standards.h"
+#include "vfvalue.h"
 
+#include <atomic>
 #include <cstddef>
 #include <iosfwd>
 #include <string>
@@ -48,6 +50,14 @@ struct TokensFrontBack {
     Token *front{};
     Token* back{};
     const TokenList& list;
+    /** number of tokens which exist for this list */
+    std::atomic<std::size_t> tokens{};
+    /** total number of ValueFlow values of the tokens */
+    std::atomic<std::size_t> values{};
+    /** possible ValueFlow values are not added to the tokens when this is false */
+    std::atomic<bool> possibleValues{true};
+    /** memory for the ValueFlow values of the tokens */
+    ValueFlow::ValueArena valueArena;
 };
 
 class CPPCHECKLIB TokenList {
@@ -134,6 +144,17 @@ public:
         return mTokensFrontBack.back;
     }
 
+    /** get total number of ValueFlow values of all tokens */
+    std::size_t getValueCount() const {
+        return mTokensFrontBack.values;
+    }
+
+    /** get the estimated memory usage in bytes of the tokens and their ValueFlow values, it is derived from the token count and the arena size */
+    std::size_t memoryUsage() const;
+
+    /** drop the possible ValueFlow values of the tokens and do not add them anymore */
+    void removePossibleValues();
+
     /**
      * Get filenames (the sourcefile + the files it include).
      * The first filename is the filename for the sourcefile
@@ -0,0 +1,336 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2024 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef tokenmatchH
+#define tokenmatchH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+#include "errortypes.h"
+#include "token.h"
+#include "tokenstrings.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Compilation of Token::Match() patterns by the C++ compiler.
+ *
+ * The pattern is a template argument. It is split into words and
+ * alternatives by constexpr functions and every word and alternative
+ * becomes a template instantiation, so the compiler generates the same
+ * kind of code as tools/matchcompiler.py. A literal word with a fixed id
+ * (see TokenStrings) is compared with the id of the token, the other
+ * literal words are compared with memcmp.
+ */
+namespace TokenMatch {
+    /** @return the position of the first character at or after i that is not a space */
+    constexpr std::size_t skipSpaces(const char *p, std::size_t i) {
+        return p[i] == ' ' ? skipSpaces(p, i + 1) : i;
+    }
+
+    /** @return the end of the word that starts at i */
+    constexpr std::size_t wordEnd(const char *p, std::size_t i) {
+        return (p[i] == ' ' || p[i] == '\0') ? i : wordEnd(p, i + 1);
+    }
+
+    /** @return the end of the alternative that starts at i */
+    constexpr std::size_t alternativeEnd(const char *p, std::size_t i) {
+        return (p[i] == '|' || p[i] == ' ' || p[i] == '\0') ? i : alternativeEnd(p, i + 1);
+    }
+
+    /** @return the number of characters c in [b, e) */
+    constexpr std::size_t count(const char *p, std::size_t b, std::size_t e, char c) {
+        return b < e ? (p[b] == c ? 1 : 0) + count(p, b + 1, e, c) : 0;
+    }
+
+    /** @return true if [b, e) is the string s */
+    constexpr bool equals(const char *p, std::size_t b, std::size_t e, const char *s) {
+        return b == e ? *s == '\0' : (*s == p[b] && equals(p, b + 1, e, s + 1));
+    }
+
+    enum class Kind : std::uint8_t { End, Chars, Not, Alternatives };
+
+    /** @return the kind of the word that starts at b */
+    constexpr Kind wordKind(const char *p, std::size_t b) {
+        return p[b] == '\0' ? Kind::End :
+               (p[b] == '[' && count(p, b, wordEnd(p, b), ']') > 0) ? Kind::Chars :
+               (p[b] == '!' && p[b + 1] == '!' && p[b + 2] != '\0') ? Kind::Not :
+               Kind::Alternatives;
+    }
+
+    enum class Command : std::uint8_t {
+        Literal, Any, Assign, Bool, Char, Comp, Cop, Name, Num, Op, Or, OrOr, Str, Type, Var, VarId, Unknown
+    };
+
+    /** @return the %%cmd% of the alternative [b, e) */
+    constexpr Command command(const char *p, std::size_t b, std::size_t e) {
+        return (e - b < 2 || p[b] != '%') ? Command::Literal :
+               equals(p, b, e, "%any%") ? Command::Any :
+               equals(p, b, e, "%assign%") ? Command::Assign :
+               equals(p, b, e, "%bool%") ? Command::Bool :
+               equals(p, b, e, "%char%") ? Command::Char :
+               equals(p, b, e, "%comp%") ? Command::Comp :
+               equals(p, b, e, "%cop%") ? Command::Cop :
+               equals(p, b, e, "%name%") ? Command::Name :
+               equals(p, b, e, "%num%") ? Command::Num :
+               equals(p, b, e, "%op%") ? Command::Op :
+               equals(p, b, e, "%or%") ? Command::Or :
+               equals(p, b, e, "%oror%") ? Command::OrOr :
+               equals(p, b, e, "%str%") ? Command::Str :
+               equals(p, b, e, "%type%") ? Command::Type :
+               equals(p, b, e, "%var%") ? Command::Var :
+               equals(p, b, e, "%varid%") ? Command::VarId :
+               Command::Unknown;
+    }
+
+    /** The string [B, E) */
+    template<const char *P, std::size_t B, std::size_t E, std::uint16_t Id = TokenStrings::fixedId(P, B, E)>
+    struct Literal {
+        static bool match(const Token *tok) {
+            return tok->strId() == Id;
+        }
+    };
+
+    template<const char *P, std::size_t B, std::size_t E>
+    struct Literal<P, B, E, 0> {
+        static bool match(const Token *tok) {
+            const std::string &str = tok->str();
+            return str.size() == E - B && std::memcmp(str.data(), P + B, E - B) == 0;
+        }
+    };
+
+    template<Command C>
+    struct CommandMatch;
+
+    template<>
+    struct CommandMatch<Command::Any> {
+        static bool match(const Token * /*tok*/, nonneg int /*varid*/) {
+            return true;
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::Assign> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->isAssignmentOp();
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::Bool> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->isBoolean();
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::Char> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->tokType() == Token::eChar;
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::Comp> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->isComparisonOp();
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::Cop> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->isConstOp();
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::Name> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->isName();
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::Num> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->isNumber();
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::Op> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->isOp();
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::Or> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->tokType() == Token::eBitOp && tok->str() == "|";
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::OrOr> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->tokType() == Token::eLogicalOp && tok->str() == "||";
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::Str> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->tokType() == Token::eString;
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::Type> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->isName() && tok->varId() == 0;
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::Var> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return tok->varId() != 0;
+        }
+    };
+
+    template<>
+    struct CommandMatch<Command::VarId> {
+        static bool match(const Token *tok, nonneg int varid) {
+            if (varid == 0)
+                throw InternalError(tok, "Internal error. Token::Match called with varid 0. Please report this to Cppcheck developers");
+            return tok->varId() == varid;
+        }
+    };
+
+    /** The alternative [B, E) */
+    template<const char *P, std::size_t B, std::size_t E, Command C = command(P, B, E)>
+    struct Alternative {
+        static_assert(C != Command::Unknown, "Unexpected command in Token::Match() pattern");
+        static bool match(const Token *tok, nonneg int varid) {
+            return CommandMatch<C>::match(tok, varid);
+        }
+    };
+
+    template<const char *P, std::size_t B, std::size_t E>
+    struct Alternative<P, B, E, Command::Literal> {
+        static bool match(const Token *tok, nonneg int /*varid*/) {
+            return Literal<P, B, E>::match(tok);
+        }
+    };
+
+    /** The alternatives of the word which start at B and end at E */
+    template<const char *P, std::size_t B, std::size_t E, std::size_t A = alternativeEnd(P, B), bool Last = (A == E || A + 1 == E)>
+    struct Alternatives {
+        static bool match(const Token *tok, nonneg int varid) {
+            return Alternative<P, B, A>::match(tok, varid) || Alternatives<P, A + 1, E>::match(tok, varid);
+        }
+    };
+
+    template<const char *P, std::size_t B, std::size_t E, std::size_t A>
+    struct Alternatives<P, B, E, A, true> {
+        static bool match(const Token *tok, nonneg int varid) {
+            return Alternative<P, B, A>::match(tok, varid);
+        }
+    };
+
+    /** The characters of a "[abc]" word. The ']' is only one of them if it is given twice. */
+    template<const char *P, std::size_t I, std::size_t E>
+    struct Chars {
+        static bool contains(char c) {
+            return (P[I] != ']' && c == P[I]) || Chars<P, I + 1, E>::contains(c);
+        }
+    };
+
+    template<const char *P, std::size_t E>
+    struct Chars<P, E, E> {
+        static bool contains(char /*c*/) {
+            return false;
+        }
+    };
+
+    /** The words of the pattern from Pos on */
+    template<const char *P, std::size_t Pos, std::size_t B = skipSpaces(P, Pos), Kind K = wordKind(P, B)>
+    struct Words;
+
+    template<const char *P, std::size_t Pos, std::size_t B>
+    struct Words<P, Pos, B, Kind::End> {
+        static bool match(const Token * /*tok*/, nonneg int /*varid*/) {
+            return true;
+        }
+    };
+
+    template<const char *P, std::size_t Pos, std::size_t B>
+    struct Words<P, Pos, B, Kind::Chars> {
+        static bool match(const Token *tok, nonneg int varid) {
+            if (!tok || tok->str().length() != 1)
+                return false;
+            const char c = tok->str()[0];
+            if (!Chars<P, B + 1, wordEnd(P, B)>::contains(c) && !(c == ']' && count(P, B + 1, wordEnd(P, B), ']') > 1))
+                return false;
+            return Words<P, wordEnd(P, B)>::match(tok->next(), varid);
+        }
+    };
+
+    template<const char *P, std::size_t Pos, std::size_t B>
+    struct Words<P, Pos, B, Kind::Not> {
+        static bool match(const Token *tok, nonneg int varid) {
+            // If we have no tokens, pattern "!!else" should return true
+            if (!tok)
+                return Words<P, wordEnd(P, B)>::match(tok, varid);
+            if (Literal<P, B + 2, wordEnd(P, B)>::match(tok))
+                return false;
+            return Words<P, wordEnd(P, B)>::match(tok->next(), varid);
+        }
+    };
+
+    template<const char *P, std::size_t Pos, std::size_t B>
+    struct Words<P, Pos, B, Kind::Alternatives> {
+        static bool match(const Token *tok, nonneg int varid) {
+            if (!tok)
+                return false;
+            if (Alternatives<P, B, wordEnd(P, B)>::match(tok, varid))
+                return Words<P, wordEnd(P, B)>::match(tok->next(), varid);
+            // Empty alternative matches, use the same token for the next word
+            return P[wordEnd(P, B) - 1] == '|' && Words<P, wordEnd(P, B)>::match(tok, varid);
+        }
+    };
+}
+
+template<const char* pattern>
+bool Token::Match(const Token *tok, nonneg int varid)
+{
+    return TokenMatch::Words<pattern, 0>::match(tok, varid);
+}
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // tokenmatchH
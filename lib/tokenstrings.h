@@ -0,0 +1,93 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2024 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+//---------------------------------------------------------------------------
+#ifndef tokenstringsH
+#define tokenstringsH
+//---------------------------------------------------------------------------
+
+#include "config.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/// @addtogroup Core
+/// @{
+
+/**
+ * @brief Fixed ids of the token strings.
+ *
+ * Keywords, operators and a few very common names have a fixed id which
+ * every token with that string stores, see Token::strId(). The id is the
+ * index in the table + 1, the other strings have the id 0. The ids of the
+ * words of a Token::Match<pattern>() are looked up by the compiler so the
+ * compiled pattern compares integers.
+ */
+namespace TokenStrings {
+    constexpr const char *fixed[] = {
+        // operators and punctuators
+        "(", ")", "[", "]", "{", "}", ";", ",", ".", "->", "::", "?", ":", "...",
+        "=", "+=", "-=", "*=", "/=", "%=", "&=", "|=", "^=", "<<=", ">>=",
+        "==", "!=", "<", ">", "<=", ">=", "<=>", "&&", "||", "!",
+        "+", "-", "*", "/", "%", "&", "|", "^", "~", "<<", ">>", "++", "--", "#", "##",
+        // C and C++ keywords
+        "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break",
+        "case", "catch", "char", "char8_t", "char16_t", "char32_t", "class", "co_await", "co_return", "co_yield",
+        "compl", "concept", "const", "const_cast", "consteval", "constexpr", "constinit", "continue", "decltype", "default",
+        "delete", "do", "double", "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false",
+        "float", "for", "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace",
+        "new", "noexcept", "not", "not_eq", "nullptr", "operator", "or", "or_eq", "private", "protected",
+        "public", "register", "reinterpret_cast", "requires", "restrict", "return", "short", "signed", "sizeof", "static",
+        "static_assert", "static_cast", "struct", "switch", "template", "this", "thread_local", "throw", "true", "try",
+        "typedef", "typeid", "typename", "typeof", "union", "unsigned", "using", "virtual", "void", "volatile",
+        "wchar_t", "while", "xor", "xor_eq",
+        "_Alignas", "_Alignof", "_Atomic", "_Bool", "_Complex", "_Generic", "_Imaginary", "_Noreturn", "_Static_assert", "_Thread_local",
+        // common names and numbers
+        "std", "size", "empty", "begin", "end", "push_back", "NULL", "0", "1"
+    };
+
+    /** Number of fixed ids */
+    constexpr std::uint16_t fixedCount = sizeof(fixed) / sizeof(fixed[0]);
+
+    constexpr std::size_t length(const char *s) {
+        return *s == '\0' ? 0 : 1 + length(s + 1);
+    }
+
+    /** @return the length of the longest string with a fixed id */
+    constexpr std::size_t maxLength(std::size_t i = 0, std::size_t len = 0) {
+        return i == fixedCount ? len : maxLength(i + 1, length(fixed[i]) > len ? length(fixed[i]) : len);
+    }
+
+    /** @return true if [b, e) of p is the string s */
+    constexpr bool sameString(const char *p, std::size_t b, std::size_t e, const char *s) {
+        return b == e ? *s == '\0' : (*s == p[b] && sameString(p, b + 1, e, s + 1));
+    }
+
+    /** @return the fixed id of [b, e) of p, 0 if it does not have one */
+    constexpr std::uint16_t fixedId(const char *p, std::size_t b, std::size_t e, std::uint16_t i = 0) {
+        return i == fixedCount ? 0 : sameString(p, b, e, fixed[i]) ? static_cast<std::uint16_t>(i + 1) : fixedId(p, b, e, static_cast<std::uint16_t>(i + 1));
+    }
+
+    /** @return the fixed id of the string, 0 if it does not have one */
+    CPPCHECKLIB std::uint16_t fixedId(const std::string &s);
+}
+
+/// @}
+//---------------------------------------------------------------------------
+#endif // tokenstringsH
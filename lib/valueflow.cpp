@@ -100,6 +100,7 @@
 #include "timer.h"
 #include "token.h"
 #include "tokenlist.h"
+#include "tokenmatch.h"
 #include "utils.h"
 #include "valueptr.h"
 #include "vfvalue.h"
@@ -111,17 +112,21 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <exception>
 #include <functional>
+#include <future>
 #include <initializer_list>
 #include <iterator>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <set>
 #include <sstream>
@@ -131,7 +136,7 @@
 #include <unordered_set>
 #include <vector>
 
-static void changeKnownToPossible(std::list<ValueFlow::Value> &values, int indirect=-1)
+static void changeKnownToPossible(ValueFlow::ValueList &values, int indirect=-1)
 {
     for (ValueFlow::Value& v: values) {
         if (indirect >= 0 && v.indirect != indirect)
@@ -140,7 +145,7 @@ static void changeKnownToPossible(std::list<ValueFlow::Value> &values, int indir
     }
 }
 
-static void removeImpossible(std::list<ValueFlow::Value>& values, int indirect = -1)
+static void removeImpossible(ValueFlow::ValueList& values, int indirect = -1)
 {
     values.remove_if([&](const ValueFlow::Value& v) {
         if (indirect >= 0 && v.indirect != indirect)
@@ -149,13 +154,13 @@ static void removeImpossible(std::list<ValueFlow::Value>& values, int indirect =
     });
 }
 
-static void lowerToPossible(std::list<ValueFlow::Value>& values, int indirect = -1)
+static void lowerToPossible(ValueFlow::ValueList& values, int indirect = -1)
 {
     changeKnownToPossible(values, indirect);
     removeImpossible(values, indirect);
 }
 
-static void changePossibleToKnown(std::list<ValueFlow::Value>& values, int indirect = -1)
+static void changePossibleToKnown(ValueFlow::ValueList& values, int indirect = -1)
 {
     for (ValueFlow::Value& v : values) {
         if (indirect >= 0 && v.indirect != indirect)
@@ -549,7 +554,7 @@ static Analyzer::Result valueFlowForward(Token* startToken,
 static Analyzer::Result valueFlowForward(Token* startToken,
                                          const Token* endToken,
                                          const Token* exprTok,
-                                         std::list<ValueFlow::Value> values,
+                                         ValueFlow::ValueList values,
                                          const TokenList& tokenlist,
                                          ErrorLogger& errorLogger,
                                          const Settings& settings,
@@ -582,7 +587,7 @@ static Analyzer::Result valueFlowForward(Token* startToken,
 
 static Analyzer::Result valueFlowForwardRecursive(Token* top,
                                                   const Token* exprTok,
-                                                  std::list<ValueFlow::Value> values,
+                                                  ValueFlow::ValueList values,
                                                   const TokenList& tokenlist,
                                                   ErrorLogger& errorLogger,
                                                   const Settings& settings,
@@ -601,7 +606,7 @@ static Analyzer::Result valueFlowForwardRecursive(Token* top,
 static void valueFlowReverse(Token* tok,
                              const Token* const endToken,
                              const Token* const varToken,
-                             std::list<ValueFlow::Value> values,
+                             ValueFlow::ValueList values,
                              const TokenList& tokenlist,
                              ErrorLogger& errorLogger,
                              const Settings& settings,
@@ -2401,7 +2406,7 @@ static void valueFlowForwardLifetime(Token * tok, const TokenList &tokenlist, Er
 {
     // Forward lifetimes to constructed variable
     if (Token::Match(tok->previous(), "%var% {|(") && isVariableDecl(tok->previous())) {
-        std::list<ValueFlow::Value> values = tok->values();
+        ValueFlow::ValueList values = tok->values();
         values.remove_if(&isNotLifetimeValue);
         valueFlowForward(nextAfterAstRightmostLeaf(tok), ValueFlow::getEndOfExprScope(tok), tok->previous(), std::move(values), tokenlist, errorLogger, settings);
         return;
@@ -2430,7 +2435,7 @@ static void valueFlowForwardLifetime(Token * tok, const TokenList &tokenlist, Er
         const Token* endOfVarScope = ValueFlow::getEndOfExprScope(expr);
 
         // Only forward lifetime values
-        std::list<ValueFlow::Value> values = parent->astOperand2()->values();
+        ValueFlow::ValueList values = parent->astOperand2()->values();
         values.remove_if(&isNotLifetimeValue);
         // Dont forward lifetimes that overlap
         values.remove_if([&](const ValueFlow::Value& value) {
@@ -2471,14 +2476,14 @@ static void valueFlowForwardLifetime(Token * tok, const TokenList &tokenlist, Er
         const Variable *var = tok->variable();
         const Token *endOfVarScope = var->scope()->bodyEnd;
 
-        std::list<ValueFlow::Value> values = tok->values();
+        ValueFlow::ValueList values = tok->values();
         Token *nextExpression = nextAfterAstRightmostLeaf(parent);
         // Only forward lifetime values
         values.remove_if(&isNotLifetimeValue);
         valueFlowForward(nextExpression, endOfVarScope, tok, std::move(values), tokenlist, errorLogger, settings);
         // Cast
     } else if (parent->isCast()) {
-        std::list<ValueFlow::Value> values = tok->values();
+        ValueFlow::ValueList values = tok->values();
         // Only forward lifetime values
         values.remove_if(&isNotLifetimeValue);
         for (ValueFlow::Value& value:values)
@@ -3635,11 +3640,11 @@ static Token* findEndOfFunctionCallForParameter(Token* parameterToken)
     return nextAfterAstRightmostLeaf(parent);
 }
 
-static void valueFlowAfterMove(const TokenList& tokenlist, const SymbolDatabase& symboldatabase, ErrorLogger& errorLogger, const Settings& settings)
+static void valueFlowAfterMove(const TokenList& tokenlist, const std::vector<const Scope*>& functionScopes, ErrorLogger& errorLogger, const Settings& settings)
 {
     if (!tokenlist.isCPP() || settings.standards.cpp < Standards::CPP11)
         return;
-    for (const Scope * scope : symboldatabase.functionScopes) {
+    for (const Scope * scope : functionScopes) {
         if (!scope)
             continue;
         const Token * start = scope->bodyStart;
@@ -4018,14 +4023,16 @@ static const Token* isStrlenOf(const Token* tok, const Token* expr, int depth =
 
 static ValueFlow::Value inferCondition(const std::string& op, const Token* varTok, MathLib::bigint val);
 
-static void valueFlowSymbolicOperators(const SymbolDatabase& symboldatabase, const Settings& settings)
+static constexpr char absCall[] = "abs|labs|llabs|fabs|fabsf|fabsl (";
+
+static void valueFlowSymbolicOperators(const std::vector<const Scope*>& functionScopes, const Settings& settings)
 {
-    for (const Scope* scope : symboldatabase.functionScopes) {
+    for (const Scope* scope : functionScopes) {
         for (auto* tok = const_cast<Token*>(scope->bodyStart); tok != scope->bodyEnd; tok = tok->next()) {
             if (tok->hasKnownIntValue())
                 continue;
 
-            if (Token::Match(tok, "abs|labs|llabs|fabs|fabsf|fabsl (")) {
+            if (Token::Match<absCall>(tok)) {
                 const Token* arg = tok->next()->astOperand2();
                 if (!arg)
                     continue;
@@ -4222,7 +4229,7 @@ static bool isInitialVarAssign(const Token* tok)
 static void valueFlowForwardAssign(Token* const tok,
                                    const Token* expr,
                                    std::vector<const Variable*> vars,
-                                   std::list<ValueFlow::Value> values,
+                                   ValueFlow::ValueList values,
                                    const bool init,
                                    const TokenList& tokenlist,
                                    ErrorLogger& errorLogger,
@@ -4304,7 +4311,7 @@ static void valueFlowForwardAssign(Token* const tok,
                 return true;
             return false;
         });
-        std::list<ValueFlow::Value> constValues;
+        ValueFlow::ValueList constValues;
         constValues.splice(constValues.end(), values, it, values.end());
         valueFlowForwardConst(nextExpression, endOfVarScope, expr->variable(), constValues, settings);
     }
@@ -4331,7 +4338,7 @@ static void valueFlowForwardAssign(Token* const tok,
 
 static void valueFlowForwardAssign(Token* const tok,
                                    const Variable* const var,
-                                   const std::list<ValueFlow::Value>& values,
+                                   const ValueFlow::ValueList& values,
                                    const bool /*unused*/,
                                    const bool init,
                                    const TokenList& tokenlist,
@@ -4341,7 +4348,7 @@ static void valueFlowForwardAssign(Token* const tok,
     valueFlowForwardAssign(tok, var->nameToken(), {var}, values, init, tokenlist, errorLogger, settings);
 }
 
-static std::list<ValueFlow::Value> truncateValues(std::list<ValueFlow::Value> values,
+static ValueFlow::ValueList truncateValues(ValueFlow::ValueList values,
                                                   const ValueType* dst,
                                                   const ValueType* src,
                                                   const Settings& settings)
@@ -4423,12 +4430,12 @@ static bool intersects(const C1& c1, const C2& c2)
 }
 
 static void valueFlowAfterAssign(TokenList &tokenlist,
-                                 const SymbolDatabase& symboldatabase,
+                                 const std::vector<const Scope*>& functionScopes,
                                  ErrorLogger &errorLogger,
                                  const Settings &settings,
                                  const std::set<const Scope*>& skippedFunctions)
 {
-    for (const Scope * scope : symboldatabase.functionScopes) {
+    for (const Scope * scope : functionScopes) {
         if (skippedFunctions.count(scope))
             continue;
         std::unordered_map<nonneg int, std::unordered_set<nonneg int>> backAssigns;
@@ -4453,7 +4460,7 @@ static void valueFlowAfterAssign(TokenList &tokenlist,
             if (!rhs || rhs->values().empty())
                 continue;
 
-            std::list<ValueFlow::Value> values = truncateValues(
+            ValueFlow::ValueList values = truncateValues(
                 rhs->values(), tok->astOperand1()->valueType(), rhs->valueType(), settings);
             // Remove known values
             std::set<ValueFlow::Value::ValueType> types;
@@ -4560,11 +4567,11 @@ static std::vector<const Variable*> getVariables(const Token* tok)
 }
 
 static void valueFlowAfterSwap(const TokenList& tokenlist,
-                               const SymbolDatabase& symboldatabase,
+                               const std::vector<const Scope*>& functionScopes,
                                ErrorLogger& errorLogger,
                                const Settings& settings)
 {
-    for (const Scope* scope : symboldatabase.functionScopes) {
+    for (const Scope* scope : functionScopes) {
         for (auto* tok = const_cast<Token*>(scope->bodyStart); tok != scope->bodyEnd; tok = tok->next()) {
             if (!Token::simpleMatch(tok, "swap ("))
                 continue;
@@ -4579,7 +4586,7 @@ static void valueFlowAfterSwap(const TokenList& tokenlist,
                 continue;
             for (int i = 0; i < 2; i++) {
                 std::vector<const Variable*> vars = getVariables(args[0]);
-                const std::list<ValueFlow::Value>& values = args[0]->values();
+                const ValueFlow::ValueList& values = args[0]->values();
                 valueFlowForwardAssign(args[0], args[1], std::move(vars), values, false, tokenlist, errorLogger, settings);
                 std::swap(args[0], args[1]);
             }
@@ -4587,7 +4594,7 @@ static void valueFlowAfterSwap(const TokenList& tokenlist,
     }
 }
 
-static void valueFlowSetConditionToKnown(const Token* tok, std::list<ValueFlow::Value>& values, bool then)
+static void valueFlowSetConditionToKnown(const Token* tok, ValueFlow::ValueList& values, bool then)
 {
     if (values.empty())
         return;
@@ -4615,12 +4622,12 @@ ValueFlow::Value ValueFlow::asImpossible(ValueFlow::Value v)
     return v;
 }
 
-static void insertImpossible(std::list<ValueFlow::Value>& values, const std::list<ValueFlow::Value>& input)
+static void insertImpossible(ValueFlow::ValueList& values, const ValueFlow::ValueList& input)
 {
     std::transform(input.cbegin(), input.cend(), std::back_inserter(values), &ValueFlow::asImpossible);
 }
 
-static void insertNegateKnown(std::list<ValueFlow::Value>& values, const std::list<ValueFlow::Value>& input)
+static void insertNegateKnown(ValueFlow::ValueList& values, const ValueFlow::ValueList& input)
 {
     for (ValueFlow::Value value:input) {
         if (!value.isIntValue() && !value.isContainerSizeValue())
@@ -4631,11 +4638,15 @@ static void insertNegateKnown(std::list<ValueFlow::Value>& values, const std::li
     }
 }
 
+static constexpr char ifWhileFor[] = "if|while|for (";
+static constexpr char conditionSeparator[] = ":|;|,";
+static constexpr char conditionOp[] = "&&|%oror%|?|!";
+
 struct ConditionHandler {
     struct Condition {
         const Token* vartok{};
-        std::list<ValueFlow::Value> true_values;
-        std::list<ValueFlow::Value> false_values;
+        ValueFlow::ValueList true_values;
+        ValueFlow::ValueList false_values;
         bool inverted = false;
         // Whether to insert impossible values for the condition or only use possible values
         bool impossible = true;
@@ -4644,7 +4655,7 @@ struct ConditionHandler {
             return astIsBool(vartok);
         }
 
-        static MathLib::bigint findPath(const std::list<ValueFlow::Value>& values)
+        static MathLib::bigint findPath(const ValueFlow::ValueList& values)
         {
             auto it = std::find_if(values.cbegin(), values.cend(), [](const ValueFlow::Value& v) {
                 return v.path > 0;
@@ -4664,8 +4675,8 @@ struct ConditionHandler {
         }
 
         Token* getContextAndValues(Token* condTok,
-                                   std::list<ValueFlow::Value>& thenValues,
-                                   std::list<ValueFlow::Value>& elseValues,
+                                   ValueFlow::ValueList& thenValues,
+                                   ValueFlow::ValueList& elseValues,
                                    bool known = false) const
         {
             const MathLib::bigint path = getPath();
@@ -4702,7 +4713,7 @@ struct ConditionHandler {
     virtual Analyzer::Result forward(Token* start,
                                      const Token* stop,
                                      const Token* exprTok,
-                                     const std::list<ValueFlow::Value>& values,
+                                     const ValueFlow::ValueList& values,
                                      TokenList& tokenlist,
                                      ErrorLogger& errorLogger,
                                      const Settings& settings,
@@ -4713,7 +4724,7 @@ struct ConditionHandler {
 
     virtual Analyzer::Result forward(Token* top,
                                      const Token* exprTok,
-                                     const std::list<ValueFlow::Value>& values,
+                                     const ValueFlow::ValueList& values,
                                      TokenList& tokenlist,
                                      ErrorLogger& errorLogger,
                                      const Settings& settings,
@@ -4725,7 +4736,7 @@ struct ConditionHandler {
     virtual void reverse(Token* start,
                          const Token* endToken,
                          const Token* exprTok,
-                         const std::list<ValueFlow::Value>& values,
+                         const ValueFlow::ValueList& values,
                          TokenList& tokenlist,
                          ErrorLogger& errorLogger,
                          const Settings& settings,
@@ -4734,25 +4745,25 @@ struct ConditionHandler {
         valueFlowReverse(start, endToken, exprTok, values, tokenlist, errorLogger, settings, loc);
     }
 
-    void traverseCondition(const SymbolDatabase& symboldatabase,
+    void traverseCondition(const std::vector<const Scope*>& functionScopes,
                            const Settings& settings,
                            const std::set<const Scope*>& skippedFunctions,
                            const std::function<void(const Condition& cond, Token* tok, const Scope* scope)>& f) const
     {
-        for (const Scope *scope : symboldatabase.functionScopes) {
+        for (const Scope *scope : functionScopes) {
             if (skippedFunctions.count(scope))
                 continue;
             for (auto *tok = const_cast<Token *>(scope->bodyStart); tok != scope->bodyEnd; tok = tok->next()) {
-                if (Token::Match(tok, "if|while|for ("))
+                if (Token::Match<ifWhileFor>(tok))
                     continue;
-                if (Token::Match(tok, ":|;|,"))
+                if (Token::Match<conditionSeparator>(tok))
                     continue;
 
                 const Token* top = tok->astTop();
                 if (!top)
                     continue;
 
-                if (!Token::Match(top->previous(), "if|while|for (") && !Token::Match(tok->astParent(), "&&|%oror%|?|!"))
+                if (!Token::Match<ifWhileFor>(top->previous()) && !Token::Match<conditionOp>(tok->astParent()))
                     continue;
                 for (const Condition& cond : parse(tok, settings)) {
                     if (!cond.vartok)
@@ -4772,11 +4783,11 @@ struct ConditionHandler {
     }
 
     void beforeCondition(TokenList& tokenlist,
-                         const SymbolDatabase& symboldatabase,
+                         const std::vector<const Scope*>& functionScopes,
                          ErrorLogger& errorLogger,
                          const Settings& settings,
                          const std::set<const Scope*>& skippedFunctions) const {
-        traverseCondition(symboldatabase, settings, skippedFunctions, [&](const Condition& cond, Token* tok, const Scope*) {
+        traverseCondition(functionScopes, settings, skippedFunctions, [&](const Condition& cond, Token* tok, const Scope*) {
             if (cond.vartok->exprId() == 0)
                 return;
 
@@ -4810,7 +4821,7 @@ struct ConditionHandler {
                 return;
             }
 
-            std::list<ValueFlow::Value> values = cond.true_values;
+            ValueFlow::ValueList values = cond.true_values;
             if (cond.true_values != cond.false_values)
                 values.insert(values.end(), cond.false_values.cbegin(), cond.false_values.cend());
 
@@ -4920,18 +4931,18 @@ struct ConditionHandler {
     }
 
     void afterCondition(TokenList& tokenlist,
-                        const SymbolDatabase& symboldatabase,
+                        const std::vector<const Scope*>& functionScopes,
                         ErrorLogger& errorLogger,
                         const Settings& settings,
                         const std::set<const Scope*>& skippedFunctions) const {
-        traverseCondition(symboldatabase, settings, skippedFunctions, [&](const Condition& cond, Token* condTok, const Scope* scope) {
+        traverseCondition(functionScopes, settings, skippedFunctions, [&](const Condition& cond, Token* condTok, const Scope* scope) {
             Token* top = condTok->astTop();
 
             const MathLib::bigint path = cond.getPath();
             const bool allowKnown = path == 0;
 
-            std::list<ValueFlow::Value> thenValues;
-            std::list<ValueFlow::Value> elseValues;
+            ValueFlow::ValueList thenValues;
+            ValueFlow::ValueList elseValues;
 
             Token* ctx = cond.getContextAndValues(condTok, thenValues, elseValues);
 
@@ -4948,12 +4959,12 @@ struct ConditionHandler {
                     if (astIsLHS(parent) && parent->astParent() && parent->astParent()->str() == parent->str()) {
                         nextExprs.push_back(parent->astParent()->astOperand2());
                     }
-                    std::list<ValueFlow::Value> andValues;
-                    std::list<ValueFlow::Value> orValues;
+                    ValueFlow::ValueList andValues;
+                    ValueFlow::ValueList orValues;
                     cond.getContextAndValues(condTok, andValues, orValues, true);
 
                     const std::string& op(parent->str());
-                    std::list<ValueFlow::Value> values;
+                    ValueFlow::ValueList values;
                     if (op == "&&")
                         values = std::move(andValues);
                     else if (op == "||")
@@ -5005,7 +5016,7 @@ struct ConditionHandler {
                 return;
 
             if (top->previous()->isExpandedMacro()) {
-                for (std::list<ValueFlow::Value>* values : {&thenValues, &elseValues}) {
+                for (ValueFlow::ValueList* values : {&thenValues, &elseValues}) {
                     for (ValueFlow::Value& v : *values)
                         v.macro = true;
                 }
@@ -5088,7 +5099,7 @@ struct ConditionHandler {
                 if (result == 0)
                     return;
                 // Remove condition since for condition is not redundant
-                for (std::list<ValueFlow::Value>* values : {&thenValues, &elseValues}) {
+                for (ValueFlow::ValueList* values : {&thenValues, &elseValues}) {
                     for (ValueFlow::Value& v : *values) {
                         v.condition = nullptr;
                         v.conditional = true;
@@ -5112,7 +5123,7 @@ struct ConditionHandler {
                 const Token* const startToken = startTokens[i];
                 if (!startToken)
                     continue;
-                std::list<ValueFlow::Value>& values = (i == 0 ? thenValues : elseValues);
+                ValueFlow::ValueList& values = (i == 0 ? thenValues : elseValues);
                 if (allowKnown)
                     valueFlowSetConditionToKnown(condTok, values, i == 0);
 
@@ -5175,7 +5186,7 @@ struct ConditionHandler {
                 if (dead_if && dead_else)
                     return;
 
-                std::list<ValueFlow::Value> values;
+                ValueFlow::ValueList values;
                 if (dead_if) {
                     values = std::move(elseValues);
                 } else if (dead_else) {
@@ -5252,13 +5263,13 @@ protected:
 
 static void valueFlowCondition(const ValuePtr<ConditionHandler>& handler,
                                TokenList& tokenlist,
-                               SymbolDatabase& symboldatabase,
+                               const std::vector<const Scope*>& functionScopes,
                                ErrorLogger& errorLogger,
                                const Settings& settings,
                                const std::set<const Scope*>& skippedFunctions)
 {
-    handler->beforeCondition(tokenlist, symboldatabase, errorLogger, settings, skippedFunctions);
-    handler->afterCondition(tokenlist, symboldatabase, errorLogger, settings, skippedFunctions);
+    handler->beforeCondition(tokenlist, functionScopes, errorLogger, settings, skippedFunctions);
+    handler->afterCondition(tokenlist, functionScopes, errorLogger, settings, skippedFunctions);
 }
 
 struct SimpleConditionHandler : ConditionHandler {
@@ -5700,13 +5711,13 @@ static void valueFlowForLoop(TokenList &tokenlist, const SymbolDatabase& symbold
             const bool executeBody = !knownInitValue || initValue <= lastValue;
             const Token* vartok = Token::findmatch(tok, "%varid%", bodyStart, varid);
             if (executeBody && vartok) {
-                std::list<ValueFlow::Value> initValues;
+                ValueFlow::ValueList initValues;
                 initValues.emplace_back(initValue, ValueFlow::Value::Bound::Lower);
                 initValues.push_back(ValueFlow::asImpossible(initValues.back()));
                 Analyzer::Result result = valueFlowForward(bodyStart, bodyStart->link(), vartok, std::move(initValues), tokenlist, errorLogger, settings);
 
                 if (!result.action.isModified()) {
-                    std::list<ValueFlow::Value> lastValues;
+                    ValueFlow::ValueList lastValues;
                     lastValues.emplace_back(lastValue, ValueFlow::Value::Bound::Upper);
                     lastValues.back().conditional = true;
                     lastValues.push_back(ValueFlow::asImpossible(lastValues.back()));
@@ -5900,7 +5911,7 @@ struct MultiValueFlowAnalyzer : ValueFlowAnalyzer {
 };
 
 template<class Key, class F>
-static bool productParams(const Settings& settings, const std::unordered_map<Key, std::list<ValueFlow::Value>>& vars, F f)
+static bool productParams(const Settings& settings, const std::unordered_map<Key, ValueFlow::ValueList>& vars, F f)
 {
     using Args = std::vector<std::unordered_map<Key, ValueFlow::Value>>;
     Args args(1);
@@ -5963,7 +5974,7 @@ static void valueFlowInjectParameter(const TokenList& tokenlist,
                                      ErrorLogger& errorLogger,
                                      const Settings& settings,
                                      const Scope* functionScope,
-                                     const std::unordered_map<const Variable*, std::list<ValueFlow::Value>>& vars)
+                                     const std::unordered_map<const Variable*, ValueFlow::ValueList>& vars)
 {
     const bool r = productParams(settings, vars, [&](const std::unordered_map<const Variable*, ValueFlow::Value>& arg) {
         MultiValueFlowAnalyzer a(arg, settings);
@@ -5983,7 +5994,7 @@ static void valueFlowInjectParameter(const TokenList& tokenlist,
                                      const Settings& settings,
                                      const Variable* arg,
                                      const Scope* functionScope,
-                                     const std::list<ValueFlow::Value>& argvalues)
+                                     const ValueFlow::ValueList& argvalues)
 {
     // Is argument passed by value or const reference, and is it a known non-class type?
     if (arg->isReference() && !arg->isConst() && !arg->isClass())
@@ -6028,7 +6039,7 @@ static void valueFlowSwitchVariable(const TokenList &tokenlist, const SymbolData
                 continue;
             }
             if (Token::Match(tok, "case %num% :")) {
-                std::list<ValueFlow::Value> values;
+                ValueFlow::ValueList values;
                 values.emplace_back(MathLib::toBigNumber(tok->strAt(1)));
                 values.back().condition = tok;
                 values.back().errorPath.emplace_back(tok, "case " + tok->strAt(1) + ": " + vartok->str() + " is " + tok->strAt(1) + " here.");
@@ -6075,9 +6086,9 @@ static void valueFlowSwitchVariable(const TokenList &tokenlist, const SymbolData
     }
 }
 
-static std::list<ValueFlow::Value> getFunctionArgumentValues(const Token *argtok)
+static ValueFlow::ValueList getFunctionArgumentValues(const Token *argtok)
 {
-    std::list<ValueFlow::Value> argvalues(argtok->values());
+    ValueFlow::ValueList argvalues(argtok->values());
     removeImpossible(argvalues);
     if (argvalues.empty() && Token::Match(argtok, "%comp%|%oror%|&&|!")) {
         argvalues.emplace_back(0);
@@ -6088,7 +6099,7 @@ static std::list<ValueFlow::Value> getFunctionArgumentValues(const Token *argtok
 
 static void valueFlowLibraryFunction(Token *tok, const std::string &returnValue, const Settings &settings)
 {
-    std::unordered_map<nonneg int, std::list<ValueFlow::Value>> argValues;
+    std::unordered_map<nonneg int, ValueFlow::ValueList> argValues;
     int argn = 1;
     for (const Token *argtok : getArguments(tok->previous())) {
         argValues[argn] = getFunctionArgumentValues(argtok);
@@ -6143,7 +6154,7 @@ static void valueFlowSubFunction(const TokenList& tokenlist, SymbolDatabase& sym
                 continue;
 
             id++;
-            std::unordered_map<const Variable*, std::list<ValueFlow::Value>> argvars;
+            std::unordered_map<const Variable*, ValueFlow::ValueList> argvars;
             // TODO: Rewrite this. It does not work well to inject 1 argument at a time.
             const std::vector<const Token *> &callArguments = getArguments(tok);
             for (int argnr = 0U; argnr < callArguments.size(); ++argnr) {
@@ -6154,7 +6165,7 @@ static void valueFlowSubFunction(const TokenList& tokenlist, SymbolDatabase& sym
                     break;
 
                 // passing value(s) to function
-                std::list<ValueFlow::Value> argvalues(getFunctionArgumentValues(argtok));
+                ValueFlow::ValueList argvalues(getFunctionArgumentValues(argtok));
 
                 // Remove non-local lifetimes
                 argvalues.remove_if([](const ValueFlow::Value& v) {
@@ -6212,8 +6223,8 @@ static void valueFlowFunctionDefaultParameter(const TokenList& tokenlist, const
         for (std::size_t arg = function->minArgCount(); arg < function->argCount(); arg++) {
             const Variable* var = function->getArgumentVar(arg);
             if (var && var->hasDefault() && Token::Match(var->nameToken(), "%var% = %num%|%str%|%char%|%name% [,)]")) {
-                const std::list<ValueFlow::Value> &values = var->nameToken()->tokAt(2)->values();
-                std::list<ValueFlow::Value> argvalues;
+                const ValueFlow::ValueList &values = var->nameToken()->tokAt(2)->values();
+                ValueFlow::ValueList argvalues;
                 for (const ValueFlow::Value &value : values) {
                     ValueFlow::Value v(value);
                     v.defaultArg = true;
@@ -6762,7 +6773,7 @@ static void valueFlowSmartPointer(TokenList &tokenlist, ErrorLogger & errorLogge
                 if (Token::Match(tok, "%var% (|{") && tok->next()->astOperand2() &&
                     tok->next()->astOperand2()->str() != ",") {
                     Token* inTok = tok->next()->astOperand2();
-                    const std::list<ValueFlow::Value>& values = inTok->values();
+                    const ValueFlow::ValueList& values = inTok->values();
                     const bool constValue = inTok->isNumber();
                     valueFlowForwardAssign(inTok, var, values, constValue, true, tokenlist, errorLogger, settings);
 
@@ -6786,7 +6797,7 @@ static void valueFlowSmartPointer(TokenList &tokenlist, ErrorLogger & errorLogge
                     Token* inTok = ftok->astOperand2();
                     if (!inTok)
                         continue;
-                    const std::list<ValueFlow::Value>& values = inTok->values();
+                    const ValueFlow::ValueList& values = inTok->values();
                     valueFlowForwardAssign(inTok, tok, std::move(vars), values, false, tokenlist, errorLogger, settings);
                 }
             } else if (Token::simpleMatch(tok->astParent(), ". release ( )")) {
@@ -6829,7 +6840,7 @@ struct IteratorConditionHandler : SimpleConditionHandler {
                 return {};
 
             constexpr ValueFlow::Value::ValueKind kind = ValueFlow::Value::ValueKind::Known;
-            std::list<ValueFlow::Value> values = getIteratorValues(tok->astOperand1()->values(), &kind);
+            ValueFlow::ValueList values = getIteratorValues(tok->astOperand1()->values(), &kind);
             if (!values.empty()) {
                 cond.vartok = tok->astOperand2();
             } else {
@@ -7349,9 +7360,9 @@ static void valueFlowDynamicBufferSize(const TokenList& tokenlist, const SymbolD
     }
 }
 
-static void valueFlowSafeFunctions(const TokenList& tokenlist, const SymbolDatabase& symboldatabase, ErrorLogger& errorLogger, const Settings& settings)
+static void valueFlowSafeFunctions(const TokenList& tokenlist, const std::vector<const Scope*>& functionScopes, ErrorLogger& errorLogger, const Settings& settings)
 {
-    for (const Scope *functionScope : symboldatabase.functionScopes) {
+    for (const Scope *functionScope : functionScopes) {
         if (!functionScope->bodyStart)
             continue;
         const Function *function = functionScope->function;
@@ -7368,7 +7379,7 @@ static void valueFlowSafeFunctions(const TokenList& tokenlist, const SymbolDatab
             if (arg.valueType()->type == ValueType::Type::CONTAINER) {
                 if (!safe)
                     continue;
-                std::list<ValueFlow::Value> argValues;
+                ValueFlow::ValueList argValues;
                 argValues.emplace_back(0);
                 argValues.back().valueType = ValueFlow::Value::ValueType::CONTAINER_SIZE;
                 argValues.back().errorPath.emplace_back(arg.nameToken(), "Assuming " + arg.name() + " is empty");
@@ -7401,7 +7412,7 @@ static void valueFlowSafeFunctions(const TokenList& tokenlist, const SymbolDatab
                         high = maxValue;
                     isLow = isHigh = true;
                 } else if (arg.valueType()->type == ValueType::Type::FLOAT || arg.valueType()->type == ValueType::Type::DOUBLE || arg.valueType()->type == ValueType::Type::LONGDOUBLE) {
-                    std::list<ValueFlow::Value> argValues;
+                    ValueFlow::ValueList argValues;
                     argValues.emplace_back(0);
                     argValues.back().valueType = ValueFlow::Value::ValueType::FLOAT;
                     argValues.back().floatValue = isLow ? low : -1E25;
@@ -7423,7 +7434,7 @@ static void valueFlowSafeFunctions(const TokenList& tokenlist, const SymbolDatab
                 }
             }
 
-            std::list<ValueFlow::Value> argValues;
+            ValueFlow::ValueList argValues;
             if (isLow) {
                 argValues.emplace_back(low);
                 argValues.back().errorPath.emplace_back(arg.nameToken(), std::string(safeLow ? "Safe checks: " : "") + "Assuming argument has value " + std::to_string(low));
@@ -7477,13 +7488,43 @@ struct ValueFlowPass {
     ValueFlowPass(const ValueFlowPass&) = default;
     // Name of pass
     virtual const char* name() const = 0;
-    // Run the pass
-    virtual void run(const ValueFlowState& state) const = 0;
+    // Run the pass for the given function scopes
+    virtual void run(const ValueFlowState& state, const std::vector<const Scope*>& functionScopes, ErrorLogger& errorLogger) const = 0;
     // Returns true if pass needs C++
     virtual bool cpp() const = 0;
+    // Returns true if pass only reads and writes values in the given function scopes
+    virtual bool local() const = 0;
     virtual ~ValueFlowPass() noexcept = default;
 };
 
+namespace {
+    class ValueFlowErrorCollector : public ErrorLogger
+    {
+    public:
+        ValueFlowErrorCollector(ErrorLogger &errorLogger, std::mutex &outSync)
+            : mErrorLogger(errorLogger)
+            , mOutSync(outSync)
+        {}
+
+        void reportOut(const std::string &outmsg, Color c) override
+        {
+            std::lock_guard<std::mutex> lg(mOutSync);
+            mErrorLogger.reportOut(outmsg, c);
+        }
+
+        void reportErr(const ErrorMessage &msg) override
+        {
+            errors.push_back(msg);
+        }
+
+        std::vector<ErrorMessage> errors;
+
+    private:
+        ErrorLogger &mErrorLogger;
+        std::mutex &mOutSync;
+    };
+}
+
 struct ValueFlowPassRunner {
     using Clock = std::chrono::steady_clock;
     using TimePoint = std::chrono::time_point<Clock>;
@@ -7492,6 +7533,10 @@ struct ValueFlowPassRunner {
     {
         setSkippedFunctions();
         setStopTime();
+        setUnits();
+        // ValueFlow does not add to the symbol database so its size is only estimated once
+        if (this->state.settings.vfOptions.maxMemory > 0)
+            symbolDatabaseMemory = this->state.symboldatabase.memoryUsage();
     }
 
     bool run_once(std::initializer_list<ValuePtr<ValueFlowPass>> passes) const
@@ -7507,10 +7552,13 @@ struct ValueFlowPassRunner {
         std::size_t n = state.settings.vfOptions.maxIterations;
         while (n > 0 && values != getTotalValues()) {
             values = getTotalValues();
-            if (std::any_of(passes.begin(), passes.end(), [&](const ValuePtr<ValueFlowPass>& pass) {
-                return run(pass);
-            }))
-                return true;
+            for (const ValuePtr<ValueFlowPass>& pass : passes) {
+                // only the basic analysis is done when the memory budget is exceeded
+                if (memoryStage == MemoryStage::Basic)
+                    return false;
+                if (run(pass))
+                    return true;
+            }
             --n;
         }
         if (state.settings.debugwarnings) {
@@ -7539,19 +7587,106 @@ struct ValueFlowPassRunner {
             return false;
         if (timerResults) {
             Timer t(pass->name(), state.settings.showtime, timerResults);
-            pass->run(state);
+            runPass(pass);
         } else {
-            pass->run(state);
+            runPass(pass);
         }
+        checkMemory();
         return false;
     }
 
+    // Degrade the analysis in stages when the memory budget is exceeded. First the possible
+    // values are dropped and no new ones are added. If that is not enough the extended analysis
+    // is skipped.
+    void checkMemory() const
+    {
+        const std::size_t maxMemory = state.settings.vfOptions.maxMemory;
+        if (maxMemory == 0)
+            return;
+        if (memoryStage == MemoryStage::Basic || getMemoryUsage() <= maxMemory)
+            return;
+        if (memoryStage == MemoryStage::Full) {
+            memoryStage = MemoryStage::NoPossibleValues;
+            state.tokenlist.removePossibleValues();
+            reportMemoryBudgetExceeded("the possible values are dropped");
+            if (getMemoryUsage() <= maxMemory)
+                return;
+        }
+        memoryStage = MemoryStage::Basic;
+        reportMemoryBudgetExceeded("the extended analysis is skipped");
+    }
+
+    std::size_t getMemoryUsage() const
+    {
+        return state.tokenlist.memoryUsage() + symbolDatabaseMemory;
+    }
+
+    void reportMemoryBudgetExceeded(const std::string& what) const
+    {
+        if (!state.settings.severity.isEnabled(Severity::information))
+            return;
+        ErrorMessage::FileLocation loc(state.tokenlist.getFiles()[0], 0, 0);
+        const ErrorMessage errmsg({std::move(loc)},
+                                  state.tokenlist.getSourceFilePath(),
+                                  Severity::information,
+                                  "Limiting ValueFlow analysis since the memory budget is exceeded, " + what + ". "
+                                  "Please increase --performance-valueflow-max-memory to perform full analysis.",
+                                  "valueFlowMaxMemory",
+                                  Certainty::normal);
+        state.errorLogger.reportErr(errmsg);
+    }
+
+    void runPass(const ValuePtr<ValueFlowPass>& pass) const
+    {
+        if (pass->local() && units.size() > 1)
+            runParallel(pass);
+        else
+            pass->run(state, state.symboldatabase.functionScopes, state.errorLogger);
+    }
+
+    // run the pass for each unit of function scopes in parallel
+    void runParallel(const ValuePtr<ValueFlowPass>& pass) const
+    {
+        struct UnitResult {
+            std::vector<ErrorMessage> errors;
+            std::exception_ptr exception;
+        };
+        std::vector<UnitResult> results(units.size());
+        std::atomic<std::size_t> nextUnit{0};
+        std::mutex outSync;
+
+        const auto worker = [&]() {
+            for (std::size_t i = nextUnit++; i < units.size(); i = nextUnit++) {
+                ValueFlowErrorCollector collector(state.errorLogger, outSync);
+                try {
+                    pass->run(state, units[i], collector);
+                } catch (...) {
+                    results[i].exception = std::current_exception();
+                }
+                results[i].errors = std::move(collector.errors);
+            }
+        };
+
+        const std::size_t threads = std::min<std::size_t>(state.settings.vfOptions.jobs, units.size());
+        std::vector<std::future<void>> futures;
+        futures.reserve(threads);
+        for (std::size_t t = 1; t < threads; ++t)
+            futures.emplace_back(std::async(std::launch::async, worker));
+        worker();
+        for (std::future<void> &f : futures)
+            f.get();
+
+        for (const UnitResult &result : results) {
+            for (const ErrorMessage &errmsg : result.errors)
+                state.errorLogger.reportErr(errmsg);
+            if (result.exception)
+                std::rethrow_exception(result.exception);
+        }
+    }
+
     std::size_t getTotalValues() const
     {
-        std::size_t n = 1;
-        for (Token* tok = state.tokenlist.front(); tok; tok = tok->next())
-            n += tok->values().size();
-        return n;
+        return state.tokenlist.getValueCount() + 1;
     }
 
     void setSkippedFunctions()
@@ -7597,53 +7732,125 @@ struct ValueFlowPassRunner {
             stop = Clock::now() + std::chrono::seconds{state.settings.vfOptions.maxTime};
     }
 
+    // Split the function scopes into units which can be analyzed independently. Nested
+    // function scopes and functions which call each other are put in the same unit since
+    // the analysis of a function may look at the values in the functions it calls.
+    void setUnits()
+    {
+        if (state.settings.vfOptions.jobs <= 1)
+            return;
+        const std::vector<const Scope*>& functionScopes = state.symboldatabase.functionScopes;
+        if (functionScopes.size() <= 1)
+            return;
+
+        std::unordered_map<const Scope*, std::size_t> index;
+        for (std::size_t i = 0; i < functionScopes.size(); ++i)
+            index[functionScopes[i]] = i;
+
+        std::vector<std::size_t> parent(functionScopes.size());
+        std::iota(parent.begin(), parent.end(), 0);
+        const auto find = [&parent](std::size_t i) {
+            while (parent[i] != i)
+                i = parent[i] = parent[parent[i]];
+            return i;
+        };
+        const auto merge = [&](std::size_t i1, std::size_t i2) {
+            parent[find(i1)] = find(i2);
+        };
+
+        for (std::size_t i = 0; i < functionScopes.size(); ++i) {
+            const Scope* scope = functionScopes[i];
+            for (const Scope* s = scope->nestedIn; s; s = s->nestedIn) {
+                const auto it = index.find(s);
+                if (it != index.end())
+                    merge(i, it->second);
+            }
+            const Token* start = scope->bodyStart;
+            if (scope->function && scope->function->constructorMemberInitialization())
+                start = scope->function->constructorMemberInitialization();
+            for (const Token* tok = start; tok && tok != scope->bodyEnd; tok = tok->next()) {
+                const Function* f = tok->function();
+                if (!f || !f->functionScope)
+                    continue;
+                const auto it = index.find(f->functionScope);
+                if (it != index.end())
+                    merge(i, it->second);
+            }
+        }
+
+        // the units are ordered by their first function scope
+        std::unordered_map<std::size_t, std::size_t> unitIndex;
+        for (std::size_t i = 0; i < functionScopes.size(); ++i) {
+            const std::size_t root = find(i);
+            const auto it = unitIndex.emplace(root, units.size());
+            if (it.second)
+                units.emplace_back();
+            units[it.first->second].push_back(functionScopes[i]);
+        }
+    }
+
+    enum class MemoryStage : std::uint8_t { Full, NoPossibleValues, Basic };
+
     ValueFlowState state;
     TimePoint stop;
     TimerResultsIntf* timerResults;
+    std::vector<std::vector<const Scope*>> units;
+    mutable MemoryStage memoryStage = MemoryStage::Full;
+    std::size_t symbolDatabaseMemory{};
 };
 
 template<class F>
 struct ValueFlowPassAdaptor : ValueFlowPass {
     const char* mName = nullptr;
     bool mCPP = false;
+    bool mLocal = false;
     F mRun;
-    ValueFlowPassAdaptor(const char* pname, bool pcpp, F prun) : ValueFlowPass(), mName(pname), mCPP(pcpp), mRun(prun) {}
+    ValueFlowPassAdaptor(const char* pname, bool pcpp, bool plocal, F prun) : ValueFlowPass(), mName(pname), mCPP(pcpp), mLocal(plocal), mRun(prun) {}
     const char* name() const override {
         return mName;
     }
-    void run(const ValueFlowState& state) const override
+    void run(const ValueFlowState& state, const std::vector<const Scope*>& functionScopes, ErrorLogger& errorLogger) const override
     {
-        mRun(state.tokenlist, state.symboldatabase, state.errorLogger, state.settings, state.skippedFunctions);
+        mRun(state.tokenlist, state.symboldatabase, functionScopes, errorLogger, state.settings, state.skippedFunctions);
     }
     bool cpp() const override {
         return mCPP;
     }
+    bool local() const override {
+        return mLocal;
+    }
 };
 
 template<class F>
-static ValueFlowPassAdaptor<F> makeValueFlowPassAdaptor(const char* name, bool cpp, F run)
+static ValueFlowPassAdaptor<F> makeValueFlowPassAdaptor(const char* name, bool cpp, bool local, F run)
 {
-    return {name, cpp, run};
+    return {name, cpp, local, run};
 }
 
-#define VALUEFLOW_ADAPTOR(cpp, ...)                                                                                    \
+#define VALUEFLOW_ADAPTOR(cpp, local, ...)                                                                             \
     makeValueFlowPassAdaptor(#__VA_ARGS__,                                                                             \
                              (cpp),                                                                                      \
+                             (local),                                                                                    \
                              [](TokenList& tokenlist,                                                                  \
                                 SymbolDatabase& symboldatabase,                                                        \
+                                const std::vector<const Scope*>& functionScopes,                                       \
                                 ErrorLogger& errorLogger,                                                              \
                                 const Settings& settings,                                                              \
                                 const std::set<const Scope*>& skippedFunctions) {                                      \
         (void)tokenlist;                                                                      \
         (void)symboldatabase;                                                                 \
+        (void)functionScopes;                                                                 \
         (void)errorLogger;                                                                    \
         (void)settings;                                                                       \
         (void)skippedFunctions;                                                               \
         __VA_ARGS__;                                                                          \
     })
 
-#define VFA(...) VALUEFLOW_ADAPTOR(false, __VA_ARGS__)
-#define VFA_CPP(...) VALUEFLOW_ADAPTOR(true, __VA_ARGS__)
+#define VFA(...) VALUEFLOW_ADAPTOR(false, false, __VA_ARGS__)
+#define VFA_CPP(...) VALUEFLOW_ADAPTOR(true, false, __VA_ARGS__)
+// passes which only look at the given function scopes, these can be run for several functions in parallel
+#define VFA_LOCAL(...) VALUEFLOW_ADAPTOR(false, true, __VA_ARGS__)
+#define VFA_CPP_LOCAL(...) VALUEFLOW_ADAPTOR(true, true, __VA_ARGS__)
 
 void ValueFlow::setValues(TokenList& tokenlist,
                           SymbolDatabase& symboldatabase,
@@ -7686,15 +7893,15 @@ void ValueFlow::setValues(TokenList& tokenlist,
 
     runner.run({
         VFA(analyzeImpossibleValues(tokenlist, settings)),
-        VFA(valueFlowSymbolicOperators(symboldatabase, settings)),
-        VFA(valueFlowCondition(SymbolicConditionHandler{}, tokenlist, symboldatabase, errorLogger, settings, skippedFunctions)),
-        VFA(valueFlowSymbolicInfer(symboldatabase, settings)),
+        VFA_LOCAL(valueFlowSymbolicOperators(functionScopes, settings)),
+        VFA_LOCAL(valueFlowCondition(SymbolicConditionHandler{}, tokenlist, functionScopes, errorLogger, settings, skippedFunctions)),
+        VFA_LOCAL(valueFlowSymbolicInfer(functionScopes, settings)),
         VFA(analyzeArrayBool(tokenlist, settings)),
         VFA(analyzeArrayElement(tokenlist, settings)),
         VFA(analyzeRightShift(tokenlist, settings)),
-        VFA(valueFlowAfterAssign(tokenlist, symboldatabase, errorLogger, settings, skippedFunctions)),
-        VFA_CPP(valueFlowAfterSwap(tokenlist, symboldatabase, errorLogger, settings)),
-        VFA(valueFlowCondition(SimpleConditionHandler{}, tokenlist, symboldatabase, errorLogger, settings, skippedFunctions)),
+        VFA_LOCAL(valueFlowAfterAssign(tokenlist, functionScopes, errorLogger, settings, skippedFunctions)),
+        VFA_CPP_LOCAL(valueFlowAfterSwap(tokenlist, functionScopes, errorLogger, settings)),
+        VFA_LOCAL(valueFlowCondition(SimpleConditionHandler{}, tokenlist, functionScopes, errorLogger, settings, skippedFunctions)),
         VFA(valueFlowInferCondition(tokenlist, settings)),
         VFA(valueFlowSwitchVariable(tokenlist, symboldatabase, errorLogger, settings)),
         VFA(valueFlowForLoop(tokenlist, symboldatabase, errorLogger, settings)),
@@ -7703,16 +7910,16 @@ void ValueFlow::setValues(TokenList& tokenlist,
         VFA(valueFlowLifetime(tokenlist, errorLogger, settings)),
         VFA(valueFlowFunctionDefaultParameter(tokenlist, symboldatabase, errorLogger, settings)),
         VFA(valueFlowUninit(tokenlist, errorLogger, settings)),
-        VFA_CPP(valueFlowAfterMove(tokenlist, symboldatabase, errorLogger, settings)),
+        VFA_CPP_LOCAL(valueFlowAfterMove(tokenlist, functionScopes, errorLogger, settings)),
         VFA_CPP(valueFlowSmartPointer(tokenlist, errorLogger, settings)),
         VFA_CPP(analyzeIterators(tokenlist, settings)),
-        VFA_CPP(
-            valueFlowCondition(IteratorConditionHandler{}, tokenlist, symboldatabase, errorLogger, settings, skippedFunctions)),
+        VFA_CPP_LOCAL(
+            valueFlowCondition(IteratorConditionHandler{}, tokenlist, functionScopes, errorLogger, settings, skippedFunctions)),
         VFA_CPP(analyzeIteratorInfer(tokenlist, settings)),
         VFA_CPP(valueFlowContainerSize(tokenlist, symboldatabase, errorLogger, settings, skippedFunctions)),
-        VFA_CPP(
-            valueFlowCondition(ContainerConditionHandler{}, tokenlist, symboldatabase, errorLogger, settings, skippedFunctions)),
-        VFA(valueFlowSafeFunctions(tokenlist, symboldatabase, errorLogger, settings)),
+        VFA_CPP_LOCAL(
+            valueFlowCondition(ContainerConditionHandler{}, tokenlist, functionScopes, errorLogger, settings, skippedFunctions)),
+        VFA_LOCAL(valueFlowSafeFunctions(tokenlist, functionScopes, errorLogger, settings)),
     });
 
     runner.run_once({
@@ -7737,7 +7944,7 @@ std::string ValueFlow::eitherTheConditionIsRedundant(const Token *condition)
     return "Either the condition '" + condition->expressionString() + "' is redundant";
 }
 
-const ValueFlow::Value* ValueFlow::findValue(const std::list<ValueFlow::Value>& values,
+const ValueFlow::Value* ValueFlow::findValue(const ValueFlow::ValueList& values,
                                              const Settings& settings,
                                              const std::function<bool(const ValueFlow::Value&)> &pred)
 {
@@ -61,7 +61,7 @@ namespace ValueFlow {
 
     size_t getSizeOf(const ValueType &vt, const Settings &settings, int maxRecursion = 0);
 
-    const Value* findValue(const std::list<Value>& values,
+    const Value* findValue(const ValueList& values,
                            const Settings& settings,
                            const std::function<bool(const Value&)> &pred);
 
@@ -395,7 +395,7 @@ namespace ValueFlow
         v.debugPath.emplace_back(tok, std::move(s));
     }
 
-    std::list<Value> getIteratorValues(std::list<Value> values, const Value::ValueKind* kind)
+    ValueList getIteratorValues(ValueList values, const Value::ValueKind* kind)
     {
         values.remove_if([&](const Value& v) {
             if (kind && v.valueKind != *kind)
@@ -52,7 +52,7 @@ namespace ValueFlow
                            const Token* tok,
                            SourceLocation local = SourceLocation::current());
 
-    std::list<Value> getIteratorValues(std::list<Value> values, const Value::ValueKind* kind = nullptr);
+    ValueList getIteratorValues(ValueList values, const Value::ValueKind* kind = nullptr);
 }
 
 #endif // vfCommonH
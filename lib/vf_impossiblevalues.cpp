@@ -25,6 +25,7 @@
 #include "symboldatabase.h"
 #include "token.h"
 #include "tokenlist.h"
+#include "tokenmatch.h"
 #include "utils.h"
 #include "vfvalue.h"
 
@@ -83,6 +84,8 @@ namespace ValueFlow
         return vt.type != ValueType::UNKNOWN_INT && vt.isIntegral();
     }
 
+    static constexpr char absCall[] = "abs|labs|llabs|fabs|fabsf|fabsl (";
+
     void analyzeImpossibleValues(TokenList& tokenList, const Settings& settings)
     {
         for (Token* tok = tokenList.front(); tok; tok = tok->next()) {
@@ -157,7 +160,7 @@ namespace ValueFlow
                 value.bound = Value::Bound::Lower;
                 value.setImpossible();
                 setTokenValue(tok, std::move(value), settings);
-            } else if (Token::Match(tok, "abs|labs|llabs|fabs|fabsf|fabsl (")) {
+            } else if (Token::Match<absCall>(tok)) {
                 Value value{-1};
                 value.bound = Value::Bound::Upper;
                 value.setImpossible();
@@ -38,7 +38,7 @@ namespace ValueFlow
                 continue;
             if (!tok->scope()->isExecutable())
                 continue;
-            std::list<Value> values = getIteratorValues(tok->values());
+            ValueList values = getIteratorValues(tok->values());
             values.remove_if([&](const Value& v) {
                 if (!v.isImpossible())
                     return true;
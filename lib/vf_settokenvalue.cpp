@@ -400,7 +400,7 @@ namespace ValueFlow
                     const Token *op = cond ? tok->astOperand1() : tok->astOperand2();
                     if (!op) // #7769 segmentation fault at setTokenValue()
                         return;
-                    const std::list<Value> &values = op->values();
+                    const ValueList &values = op->values();
                     if (std::find(values.cbegin(), values.cend(), value) != values.cend())
                         setTokenValue(parent, std::move(value), settings);
                 }
@@ -432,7 +432,7 @@ namespace ValueFlow
 
         else if (parent->str() == "?" && value.isIntValue() && tok == parent->astOperand1() && value.isKnown() &&
                  parent->astOperand2() && parent->astOperand2()->astOperand1() && parent->astOperand2()->astOperand2()) {
-            const std::list<Value> &values = (value.intvalue == 0
+            const ValueList &values = (value.intvalue == 0
                 ? parent->astOperand2()->astOperand2()->values()
                 : parent->astOperand2()->astOperand1()->values());
 
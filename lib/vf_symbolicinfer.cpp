@@ -53,9 +53,9 @@ namespace ValueFlow
         }
     };
 
-    void valueFlowSymbolicInfer(const SymbolDatabase& symboldatabase, const Settings& settings)
+    void valueFlowSymbolicInfer(const std::vector<const Scope*>& functionScopes, const Settings& settings)
     {
-        for (const Scope* scope : symboldatabase.functionScopes) {
+        for (const Scope* scope : functionScopes) {
             for (auto* tok = const_cast<Token*>(scope->bodyStart); tok != scope->bodyEnd; tok = tok->next()) {
                 if (!Token::Match(tok, "-|%comp%"))
                     continue;
@@ -19,12 +19,14 @@
 #ifndef vfSymbolicInferH
 #define vfSymbolicInferH
 
-class SymbolDatabase;
+#include <vector>
+
+class Scope;
 class Settings;
 
 namespace ValueFlow
 {
-    void valueFlowSymbolicInfer(const SymbolDatabase& symboldatabase, const Settings& settings);
+    void valueFlowSymbolicInfer(const std::vector<const Scope*>& functionScopes, const Settings& settings);
 }
 
 #endif // vfSymbolicInferH
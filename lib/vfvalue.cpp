@@ -21,6 +21,7 @@
 #include "errortypes.h"
 #include "token.h"
 
+#include <algorithm>
 #include <sstream>
 #include <string>
 
@@ -192,4 +193,106 @@ namespace ValueFlow {
         }
         return "";
     }
+
+    namespace {
+        std::atomic<std::uint64_t> valueArenaId{0};
+    }
+
+    ValueArena::ValueArena()
+        : mId(++valueArenaId)
+    {}
+
+    ValueArena::~ValueArena()
+    {
+        for (const ThreadCache& cache : mThreadCaches) {
+            for (char* block : cache.blocks)
+                ::operator delete(block);
+        }
+    }
+
+    ValueArena::ThreadCache& ValueArena::getThreadCache()
+    {
+        // the values of a token list are mostly added by the same threads, only the
+        // last used cache is remembered, it is checked against the id of its arena
+        static thread_local std::uint64_t lastId{};
+        static thread_local ThreadCache* lastCache{};
+
+        if (lastId == mId)
+            return *lastCache;
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        // the id of a thread is only reused when the thread has ended, its cache is taken over
+        const std::thread::id threadId = std::this_thread::get_id();
+        auto it = std::find_if(mThreadCaches.begin(), mThreadCaches.end(), [&](const ThreadCache& c) {
+            return c.threadId == threadId;
+        });
+        if (it == mThreadCaches.end()) {
+            it = mThreadCaches.emplace(mThreadCaches.end());
+            it->threadId = threadId;
+            // the nodes of all sizes can be freed by this thread
+            it->freeNodes.resize(MaxSize / Alignment + 1);
+        }
+        lastId = mId;
+        lastCache = &*it;
+        return *it;
+    }
+
+    void* ValueArena::allocate(std::size_t size)
+    {
+        size = (size + Alignment - 1) / Alignment * Alignment;
+        if (size > MaxSize)
+            return ::operator new(size);
+        const std::size_t index = size / Alignment;
+        ThreadCache& cache = getThreadCache();
+        // only this thread writes the counters
+        cache.allocated.store(cache.allocated.load(std::memory_order_relaxed) + size, std::memory_order_relaxed);
+        if (cache.freeNodes[index]) {
+            FreeNode* node = cache.freeNodes[index];
+            cache.freeNodes[index] = node->next;
+            return node;
+        }
+        if (static_cast<std::size_t>(cache.end - cache.pos) < size) {
+            cache.blocks.push_back(static_cast<char*>(::operator new(BlockSize)));
+            cache.pos = cache.blocks.back();
+            cache.end = cache.pos + BlockSize;
+            cache.reserved.store(cache.blocks.size() * BlockSize, std::memory_order_relaxed);
+        }
+        void* ret = cache.pos;
+        cache.pos += size;
+        return ret;
+    }
+
+    void ValueArena::deallocate(void* p, std::size_t size) noexcept
+    {
+        size = (size + Alignment - 1) / Alignment * Alignment;
+        if (size > MaxSize) {
+            ::operator delete(p);
+            return;
+        }
+        const std::size_t index = size / Alignment;
+        ThreadCache& cache = getThreadCache();
+        cache.allocated.store(cache.allocated.load(std::memory_order_relaxed) - size, std::memory_order_relaxed);
+        auto* node = static_cast<FreeNode*>(p);
+        node->next = cache.freeNodes[index];
+        cache.freeNodes[index] = node;
+    }
+
+    std::size_t ValueArena::allocated() const
+    {
+        std::ptrdiff_t allocated = 0;
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (const ThreadCache& cache : mThreadCaches)
+            allocated += cache.allocated.load(std::memory_order_relaxed);
+        // the counters of the threads are not read at the same time
+        return allocated > 0 ? static_cast<std::size_t>(allocated) : 0;
+    }
+
+    std::size_t ValueArena::reserved() const
+    {
+        std::size_t reserved = 0;
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (const ThreadCache& cache : mThreadCaches)
+            reserved += cache.reserved.load(std::memory_order_relaxed);
+        return reserved;
+    }
 }
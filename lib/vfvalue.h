@@ -24,12 +24,17 @@
 #include "config.h"
 #include "mathlib.h"
 
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <list>
+#include <mutex>
+#include <new>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -412,6 +417,122 @@ namespace ValueFlow
             }
         };
     };
+
+    /**
+     * @brief Memory pool for the ValueFlow values of the tokens of a TokenList.
+     *
+     * Memory is taken from large blocks and released all at once when the arena
+     * is destroyed. Freed nodes are kept in a free list per size and reused.
+     * Each thread has its own blocks and free lists so the threads do not wait
+     * for each other, a node can be freed by another thread than the one that
+     * allocated it.
+     */
+    class CPPCHECKLIB ValueArena {
+    public:
+        ValueArena();
+        ~ValueArena();
+
+        ValueArena(const ValueArena &) = delete;
+        ValueArena &operator=(const ValueArena &) = delete;
+
+        void* allocate(std::size_t size);
+        void deallocate(void* p, std::size_t size) noexcept;
+
+        /** @return number of bytes that are currently allocated from the arena */
+        std::size_t allocated() const;
+
+        /** @return number of bytes that has been reserved for the arena */
+        std::size_t reserved() const;
+
+    private:
+        struct FreeNode {
+            FreeNode* next;
+        };
+
+        /** the blocks and free lists of a thread, only the counters are read by other threads */
+        struct ThreadCache {
+            std::thread::id threadId;
+            std::vector<char*> blocks;
+            std::vector<FreeNode*> freeNodes;
+            char* pos{};
+            char* end{};
+            /** negative when the thread freed more than it allocated */
+            std::atomic<std::ptrdiff_t> allocated{};
+            std::atomic<std::size_t> reserved{};
+        };
+
+        ThreadCache &getThreadCache();
+
+        static constexpr std::size_t Alignment = alignof(std::max_align_t);
+        static constexpr std::size_t MaxSize = 64 * Alignment;
+        static constexpr std::size_t BlockSize = 64 * 1024;
+
+        /** identifies the caches of this instance in the threads */
+        const std::uint64_t mId;
+        std::list<ThreadCache> mThreadCaches;
+        /** taken when a thread uses the arena for the first time and when the counters are read */
+        mutable std::mutex mMutex;
+    };
+
+    /**
+     * @brief Allocator that takes the memory from a ValueArena.
+     *
+     * A default constructed allocator uses the global heap. Copies of a
+     * container get the global heap so they can outlive the arena.
+     */
+    template<class T>
+    class ValueAllocator {
+    public:
+        using value_type = T;
+        // the arena moves with the nodes, copies use the global heap (see select_on_container_copy_construction())
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        ValueAllocator() = default;
+        explicit ValueAllocator(ValueArena* arena) : mArena(arena) {}
+        template<class U>
+        // cppcheck-suppress noExplicitConstructor
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        ValueAllocator(const ValueAllocator<U>& other) : mArena(other.arena()) {}
+
+        T* allocate(std::size_t n) {
+            if (mArena && n == 1)
+                return static_cast<T*>(mArena->allocate(sizeof(T)));
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T* p, std::size_t n) noexcept {
+            if (mArena && n == 1)
+                mArena->deallocate(p, sizeof(T));
+            else
+                ::operator delete(p);
+        }
+
+        ValueAllocator select_on_container_copy_construction() const {
+            return ValueAllocator();
+        }
+
+        ValueArena* arena() const {
+            return mArena;
+        }
+
+    private:
+        ValueArena* mArena{};
+    };
+
+    template<class T, class U>
+    bool operator==(const ValueAllocator<T>& a, const ValueAllocator<U>& b)
+    {
+        return a.arena() == b.arena();
+    }
+
+    template<class T, class U>
+    bool operator!=(const ValueAllocator<T>& a, const ValueAllocator<U>& b)
+    {
+        return a.arena() != b.arena();
+    }
+
+    using ValueList = std::list<Value, ValueAllocator<Value>>;
 }
 
 #endif // vfvalueH
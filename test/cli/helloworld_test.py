@@ -11,6 +11,13 @@ __script_dir = os.path.dirname(os.path.abspath(__file__))
 __proj_dir = os.path.join(__script_dir, 'helloworld')
 
 
+# remove the project file which is written to the source tree by the tests
+def teardown_function(function):
+    project_file = os.path.join(__proj_dir, 'test.cppcheck')
+    if os.path.exists(project_file):
+        os.remove(project_file)
+
+
 # Get Visual Studio configurations checking a file
 # Checking {file} {config}...
 def getVsConfigs(stdout, filename):
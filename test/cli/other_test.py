@@ -289,6 +289,52 @@ typedef int MISRA_5_6_VIOLATION;
     assert stderr == '{}:2:1: style: misra violation (use --rule-texts=<file> to get proper output) [misra-c2012-2.3]\ntypedef int MISRA_5_6_VIOLATION;\n^\n'.format(test_file)
 
 
+@pytest.mark.skipif(sys.platform == 'win32', reason='--addon-server is not available on Windows')
+def test_addon_server(tmpdir):
+    test_file_1 = os.path.join(tmpdir, 'test1.cpp')
+    with open(test_file_1, 'wt') as f:
+        f.write("""
+typedef int MISRA_5_6_VIOLATION;
+        """)
+    test_file_2 = os.path.join(tmpdir, 'test2.cpp')
+    with open(test_file_2, 'wt') as f:
+        f.write("""
+typedef int MISRA_5_6_VIOLATION_2;
+        """)
+
+    args = ['-q', '--addon=misra', '--enable=all', '--disable=unusedFunction', '--template=simple', '-j2', test_file_1, test_file_2]
+
+    exitcode, stdout, stderr = cppcheck(args)
+    exitcode_server, stdout_server, stderr_server = cppcheck(['--addon-server'] + args)
+    assert exitcode_server == exitcode
+    assert stdout_server == stdout
+    assert sorted(stderr_server.splitlines()) == sorted(stderr.splitlines())
+    assert '{}:2:1: style: misra violation (use --rule-texts=<file> to get proper output) [misra-c2012-2.3]'.format(test_file_2) in stderr_server.splitlines()
+
+
+def test_addon_dump_format_binary(tmpdir):
+    test_file = os.path.join(tmpdir, 'test.cpp')
+    with open(test_file, 'wt') as f:
+        f.write("""
+typedef int MISRA_5_6_VIOLATION;
+char *s = "a&b<c>\\"";
+        """)
+
+    args = ['--addon=misra', '--enable=all', '--disable=unusedFunction', '--template=simple', test_file]
+
+    exitcode, stdout, stderr = cppcheck(args)
+    exitcode_binary, stdout_binary, stderr_binary = cppcheck(['--dump-format=binary'] + args)
+    assert exitcode_binary == exitcode
+    assert stdout_binary == stdout
+    assert stderr_binary == stderr
+    assert '{}:2:1: style: misra violation (use --rule-texts=<file> to get proper output) [misra-c2012-2.3]'.format(test_file) in stderr_binary.splitlines()
+
+    exitcode, _, _ = cppcheck(['--dump', '--dump-format=binary', test_file])
+    assert exitcode == 0
+    with open(test_file + '.dump', 'rb') as f:
+        assert f.read(16) == b'cppcheck-dump 1\n'
+
+
 def test_addon_y2038(tmpdir):
     test_file = os.path.join(tmpdir, 'test.cpp')
     # TODO: trigger warning
@@ -836,6 +882,158 @@ def test_showtime_top5_file(tmpdir):
     assert stderr == ''
 
 
+def __test_showtime_trace(tmpdir, extra_args, trace_file='cppcheck-trace.json'):
+    test_file_1 = os.path.join(tmpdir, 'test1.cpp')
+    with open(test_file_1, 'wt') as f:
+        f.write("""
+                #ifdef A
+                int a;
+                #endif
+                int main(int argc)
+                {
+                }
+                """)
+    test_file_2 = os.path.join(tmpdir, 'test2.cpp')
+    with open(test_file_2, 'wt') as f:
+        f.write("void f() {}\n")
+
+    args = ['--quiet', '--force', 'test1.cpp', 'test2.cpp'] + extra_args
+    if not any(arg.startswith('--showtime=') for arg in extra_args):
+        args.append('--showtime=trace')
+
+    exitcode, stdout, stderr = cppcheck(args, cwd=tmpdir)
+    assert exitcode == 0
+    assert stdout == ''
+    assert stderr == ''
+
+    with open(os.path.join(tmpdir, trace_file), 'rt') as f:
+        trace = json.load(f)
+    events = trace['traceEvents']
+    for event in events:
+        assert event['ph'] == 'X'
+        assert event['dur'] >= 0
+    names = [event['name'] for event in events]
+    assert names.count('test1.cpp') == 1
+    assert names.count('test2.cpp') == 1
+    assert names.count('Configuration') == 2
+    assert names.count('Configuration: A') == 1
+    assert names.count('Tokenizer::createTokens') == 3
+    assert 'Tokenizer::simplifyTokens1::ValueFlow' in names
+    assert 'analyzeNumber(tokenlist, settings)' in names
+    assert 'Null pointer::runChecks' in names
+
+    # the spans of a file are nested in the file span of the same thread
+    for file_event in [event for event in events if event['name'].startswith('test')]:
+        nested = [event for event in events if event['pid'] == file_event['pid'] and event['tid'] == file_event['tid'] and file_event['ts'] <= event['ts'] <= file_event['ts'] + file_event['dur']]
+        assert len(nested) > 10
+    return events
+
+
+def test_showtime_trace(tmpdir):
+    events = __test_showtime_trace(tmpdir, [])
+    assert len(set((event['pid'], event['tid']) for event in events)) == 1
+
+
+def test_showtime_trace_j_thread(tmpdir):
+    events = __test_showtime_trace(tmpdir, ['-j2', '--executor=thread'])
+    # the thread ids are the indexes of the worker threads
+    assert set(event['tid'] for event in events) <= {1, 2}
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason='ProcessExecutor not available on Windows')
+def test_showtime_trace_j_process(tmpdir):
+    events = __test_showtime_trace(tmpdir, ['-j2', '--executor=process'])
+    # each file is checked in its own process
+    assert len(set(event['pid'] for event in events)) == 2
+
+
+def test_showtime_trace_file(tmpdir):
+    __test_showtime_trace(tmpdir, ['--showtime=trace:trace.json'], 'trace.json')
+    assert not os.path.exists(os.path.join(tmpdir, 'cppcheck-trace.json'))
+
+
+def test_showtime_trace_builddir(tmpdir):
+    os.mkdir(os.path.join(tmpdir, 'b1'))
+    __test_showtime_trace(tmpdir, ['--cppcheck-build-dir=b1'], os.path.join('b1', 'cppcheck-trace.json'))
+
+
+def __test_file_statistics_json(tmpdir, extra_args):
+    test_file_1 = os.path.join(tmpdir, 'test1.cpp')
+    with open(test_file_1, 'wt') as f:
+        f.write("""
+                #ifdef A
+                int a;
+                #endif
+                class C {
+                    void g() {}
+                };
+                int main(int argc)
+                {
+                    return argc + 1;
+                }
+                """)
+    test_file_2 = os.path.join(tmpdir, 'test2.cpp')
+    with open(test_file_2, 'wt') as f:
+        f.write("void f() {}\n")
+
+    args = ['--file-statistics=stats.json', '--quiet', '--force', 'test1.cpp', 'test2.cpp'] + extra_args
+
+    exitcode, stdout, stderr = cppcheck(args, cwd=tmpdir)
+    assert exitcode == 0
+    assert stdout == ''
+    assert stderr == ''
+
+    with open(os.path.join(tmpdir, 'stats.json'), 'rt') as f:
+        stats = json.load(f)
+    files = stats['files']
+    assert [(s['file'], s['configuration']) for s in files] == [('test1.cpp', ''), ('test1.cpp', 'A'), ('test2.cpp', '')]
+    for s in files:
+        assert s['tokens'] > 0
+        assert s['peakMemoryDelta'] >= 0
+        assert s['simplifyTokensTime'] >= 0
+        assert s['checksTime'] >= 0
+    assert files[0]['scopes'] == 4  # global, class, 2 functions
+    assert files[0]['functions'] == 2
+    assert files[0]['values'] > 0
+    assert files[1]['tokens'] > files[0]['tokens']
+    assert files[2]['scopes'] == 2
+    assert files[2]['functions'] == 1
+
+
+def test_file_statistics_json(tmpdir):
+    __test_file_statistics_json(tmpdir, [])
+
+
+def test_file_statistics_json_j_thread(tmpdir):
+    __test_file_statistics_json(tmpdir, ['-j2', '--executor=thread'])
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason='ProcessExecutor not available on Windows')
+def test_file_statistics_json_j_process(tmpdir):
+    __test_file_statistics_json(tmpdir, ['-j2', '--executor=process'])
+
+
+def test_file_statistics_text(tmpdir):
+    test_file = os.path.join(tmpdir, 'test.cpp')
+    with open(test_file, 'wt') as f:
+        f.write("void f() {}\n")
+
+    args = ['--file-statistics=stats.txt', '--quiet', 'test.cpp']
+
+    exitcode, stdout, stderr = cppcheck(args, cwd=tmpdir)
+    assert exitcode == 0
+    assert stdout == ''
+    assert stderr == ''
+
+    with open(os.path.join(tmpdir, 'stats.txt'), 'rt') as f:
+        lines = f.read().splitlines()
+    assert len(lines) == 1
+    assert lines[0].startswith('test.cpp: tokens=6 scopes=2 functions=1 values=')
+    assert 'peak-memory-delta=' in lines[0]
+    assert 'simplifyTokens1=' in lines[0]
+    assert 'checks=' in lines[0]
+
+
 def test_missing_addon(tmpdir):
     args = ['--addon=misra3', '--addon=misra', '--addon=misra2', 'file.c']
 
@@ -1257,6 +1455,81 @@ def test_build_dir_j_memleak(tmpdir): #12111
     assert_cppcheck(args, ec_exp=0, err_exp=[], out_exp=out_lines)
 
 
+def __test_build_dir_reused_suppressions_and_remarks(tmpdir, extra_args):
+    build_dir = os.path.join(tmpdir, 'build-dir')
+    os.mkdir(build_dir)
+
+    test_file = os.path.join(tmpdir, 'test.c')
+    with open(test_file, 'wt') as f:
+        f.write("""int f() {
+    // cppcheck-suppress zerodiv
+    int a = 1 / 0;
+    // cppcheck-suppress uninitvar
+    int b = 2 / 0; // REMARK: the remark
+    return a + b;
+}
+""")
+
+    args = [
+        '-q',
+        '--template={file}:{line}:{column}: {severity}: {message} [{id}] {remark}',
+        '--enable=information',
+        '--inline-suppr',
+        '--cppcheck-build-dir={}'.format(build_dir),
+        test_file
+    ] + extra_args
+    exp = [
+        '{}:5:15: error: Division by zero. [zerodiv] the remark'.format(test_file),
+        '{}:5:0: information: Unmatched suppression: uninitvar [unmatchedSuppression] the remark'.format(test_file)
+    ]
+
+    # the results of the second run are reused
+    for _ in range(2):
+        exitcode, stdout, stderr = cppcheck(args)
+        assert exitcode == 0, stdout
+        # the checkers which ran are not recorded in the build dir
+        lines = [line for line in stderr.splitlines() if not line.endswith('[checkersReport] ')]
+        assert sorted(lines) == sorted(exp)
+
+
+def test_build_dir_reused_suppressions_and_remarks(tmpdir):
+    __test_build_dir_reused_suppressions_and_remarks(tmpdir, ['-j2', '--executor=thread'])
+
+
+def __test_build_dir_durations_reused(tmpdir, extra_args):
+    build_dir = os.path.join(tmpdir, 'build-dir')
+    os.mkdir(build_dir)
+
+    test_file = os.path.join(tmpdir, 'test.cpp')
+    with open(test_file, 'wt') as f:
+        f.write('int main() {}')
+
+    args = ['-q', '--cppcheck-build-dir={}'.format(build_dir), test_file] + extra_args
+    exitcode, _, _ = cppcheck(args)
+    assert exitcode == 0
+
+    durations_file = os.path.join(build_dir, 'durations.txt')
+    with open(durations_file, 'rt') as f:
+        assert f.read().endswith(' {}\n'.format(test_file))
+    with open(durations_file, 'wt') as f:
+        f.write('12345 {}\n'.format(test_file))
+
+    # the results are reused so the duration of the previous analysis is kept
+    exitcode, _, _ = cppcheck(args)
+    assert exitcode == 0
+    with open(durations_file, 'rt') as f:
+        assert f.read() == '12345 {}\n'.format(test_file)
+
+
+def test_build_dir_durations_reused_thread(tmpdir):
+    __test_build_dir_durations_reused(tmpdir, ['-j2', '--executor=thread'])
+
+
+@pytest.mark.skipif(sys.platform == 'win32', reason='ProcessExecutor not available on Windows')
+def test_build_dir_durations_reused_process(tmpdir):
+    __test_build_dir_durations_reused(tmpdir, ['-j2', '--executor=process'])
+
+
 def __test_addon_json_invalid(tmpdir, addon_json, expected):
     addon_file = os.path.join(tmpdir, 'invalid.json')
     with open(addon_file, 'wt') as f:
@@ -1310,6 +1583,60 @@ def test_addon_json_invalid_script_2(tmpdir):
     __test_addon_json_invalid(tmpdir, json.dumps({'script':0}), "'script' must be a string.")
 
 
+def test_addon_json_invalid_dump_1(tmpdir):
+    __test_addon_json_invalid(tmpdir, json.dumps({'dump':0}), "'dump' must be an array.")
+
+
+def test_addon_json_invalid_dump_2(tmpdir):
+    __test_addon_json_invalid(tmpdir, json.dumps({'dump':[0]}), "'dump' entry is not a string.")
+
+
+def test_addon_json_invalid_dump_3(tmpdir):
+    __test_addon_json_invalid(tmpdir, json.dumps({'dump':['ast']}), "Unknown 'dump' section 'ast'.")
+
+
+def __test_addon_json_dump(tmpdir, addon_json, expected):
+    addon_script = os.path.join(tmpdir, 'sections.py')
+    with open(addon_script, 'wt') as f:
+        f.write("""
+import cppcheck
+
+@cppcheck.checker
+def sections(cfg, data):
+    found = [len(data.rawTokens) > 0, len(cfg.directives) > 0, len(cfg.scopes) > 0, len(cfg.valueflow) > 0]
+    cppcheck.reportError(cfg.tokenlist[0], 'style', 'rawtokens:{} directives:{} scopes:{} valueflow:{}'.format(*found))
+""")
+    addon_json['script'] = addon_script
+    addon_file = os.path.join(tmpdir, 'sections.json')
+    with open(addon_file, 'wt') as f:
+        f.write(json.dumps(addon_json))
+
+    test_file = os.path.join(tmpdir, 'file.cpp')
+    with open(test_file, 'wt') as f:
+        f.write("""
+#define X 1
+int f(int x) { return x + X; }
+""")
+
+    args = ['--addon={}'.format(addon_file), '--enable=style', '--template={message}', test_file]
+
+    exitcode, _, stderr = cppcheck(args)
+    assert exitcode == 0
+    assert stderr.splitlines() == [expected]
+
+
+def test_addon_json_dump_all(tmpdir):
+    __test_addon_json_dump(tmpdir, {}, 'rawtokens:True directives:True scopes:True valueflow:True')
+
+
+def test_addon_json_dump_tokens(tmpdir):
+    __test_addon_json_dump(tmpdir, {'dump': ['tokens']}, 'rawtokens:False directives:False scopes:False valueflow:False')
+
+
+def test_addon_json_dump_sections(tmpdir):
+    __test_addon_json_dump(tmpdir, {'dump': ['tokens', 'directives', 'valueflow']}, 'rawtokens:False directives:True scopes:False valueflow:True')
+
+
 def test_unknown_extension(tmpdir):
     test_file = os.path.join(tmpdir, 'test_2')
     with open(test_file, 'wt') as f:
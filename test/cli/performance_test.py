@@ -237,3 +237,25 @@ def test_crash_array_in_namespace(tmpdir):
                     };
                 }""")
     cppcheck([filename]) # should not take more than ~5 seconds
+
+
+@pytest.mark.timeout(10)
+def test_slow_many_suppressions(tmpdir):
+    # checking each error against a large suppressions list
+    filename = os.path.join(tmpdir, 'hang.c')
+    with open(filename, 'wt') as f:
+        for i in range(10000):
+            f.write('#include "missing{}.h"\n'.format(i))
+    suppressions_file = os.path.join(tmpdir, 'suppressions.txt')
+    with open(suppressions_file, 'wt') as f:
+        for i in range(4000):
+            if i % 100 == 0:
+                f.write('missingInclude:legacy/module{}/*.c\n'.format(i))
+            else:
+                f.write('missingInclude:legacy/module{}/file{}.c\n'.format(i // 100, i))
+        f.write('missingInclude:{}:1\n'.format(filename))
+    args = ['-q', '--enable=missingInclude', '--suppressions-list={}'.format(suppressions_file), filename]
+    _, _, stderr = cppcheck(args) # should not take more than ~3 seconds
+    lines = stderr.splitlines()
+    assert len(lines) == 3 * 9999
+    assert 'missing0.h' not in stderr
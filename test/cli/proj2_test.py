@@ -14,6 +14,15 @@ ERR_B = ('%s:1:7: error: Division by zero. [zerodiv]\n' +
          'x = 3 / 0;\n' +
          '      ^\n') % os.path.join('b', 'b.c')
 
+__script_dir = os.path.dirname(os.path.abspath(__file__))
+
+# remove the project files which are written to the source tree by the tests
+def teardown_function(function):
+    for f in (os.path.join('proj2', COMPILE_COMMANDS_JSON), os.path.join('proj2', 'test.cppcheck'), 'test.cppcheck'):
+        f = os.path.join(__script_dir, f)
+        if os.path.exists(f):
+            os.remove(f)
+
 def realpath(s):
     return os.path.realpath(s).replace('\\', '/')
 
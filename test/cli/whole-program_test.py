@@ -253,6 +253,16 @@ def test_checkclass_builddir(tmpdir):
     __test_checkclass(['--cppcheck-build-dir={}'.format(build_dir)])
 
 
+def test_checkclass_builddir_j(tmpdir):
+    build_dir = os.path.join(tmpdir, 'b1')
+    os.mkdir(build_dir)
+    __test_checkclass(['-j2', '--cppcheck-build-dir={}'.format(build_dir)])
+
+
+def test_checkclass_checks_jobs():
+    __test_checkclass(['-j1', '--checks-jobs=2'])
+
+
 def __test_checkclass_project(tmpdir, extra_args):
     odr_file_1 = os.path.join(__script_dir, 'whole-program', 'odr1.cpp')
 
@@ -18,9 +18,24 @@
 
 
 #include "analyzerinfo.h"
+#include "check.h"
+#include "ctu.h"
+#include "errorlogger.h"
 #include "fixture.h"
+#include "helpers.h"
+#include "path.h"
+#include "preprocessor.h"
+#include "suppressions.h"
 
+#include <cstdio>
+#include <cstddef>
+#include <fstream>
+#include <list>
+#include <map>
+#include <set>
 #include <sstream>
+#include <string>
+#include <vector>
 
 class TestAnalyzerInformation : public TestFixture, private AnalyzerInformation {
 public:
@@ -30,6 +45,9 @@ private:
 
     void run() override {
         TEST_CASE(getAnalyzerInfoFile);
+        TEST_CASE(isUnchanged);
+        TEST_CASE(isUnchangedReplay);
+        TEST_CASE(loadFileInfo);
     }
 
     void getAnalyzerInfoFile() const {
@@ -41,6 +59,233 @@ private:
         ASSERT_EQUALS("builddir/file1.c.analyzerinfo", AnalyzerInformation::getAnalyzerInfoFile("builddir", "file1.c", ""));
         ASSERT_EQUALS("builddir/file1.c.analyzerinfo", AnalyzerInformation::getAnalyzerInfoFile("builddir", "some/path/file1.c", ""));
     }
+
+    static bool unchanged(const std::string &sourcefile, std::size_t settingsHash) {
+        std::list<ErrorMessage> errors;
+        std::list<SuppressionList::Suppression> suppressions;
+        std::vector<RemarkComment> remarkComments;
+        std::map<std::pair<std::string, int>, std::set<std::string>> locationMacros;
+        return AnalyzerInformation::isUnchanged(".", sourcefile, "", settingsHash, errors, suppressions, remarkComments, locationMacros);
+    }
+
+    void isUnchanged() {
+        ScopedFile header("analyzerinfo_header.h", "int x;\n", "analyzerinfo_inc");
+        ScopedFile source("analyzerinfo_source.c", "#include \"analyzerinfo_header.h\"\n", "analyzerinfo_src");
+        const std::vector<std::string> files{source.path(), header.path()};
+        const std::list<std::string> includePaths{"analyzerinfo_shadow/", "analyzerinfo_inc/"};
+        std::list<ErrorMessage> errors;
+
+        {
+            AnalyzerInformation analyzerInformation;
+            analyzerInformation.setDependencies(1, files, includePaths);
+            ASSERT(analyzerInformation.analyzeFile(".", source.path(), "", 123, errors));
+        }
+        ASSERT(unchanged(source.path(), 1));
+        ASSERT(!unchanged(source.path(), 2));
+
+        {
+            std::ofstream fout(header.path());
+            fout << "int x, y;\n";
+        }
+        ASSERT(!unchanged(source.path(), 1));
+
+        // same hash => results are reused and the dependencies are updated
+        {
+            AnalyzerInformation analyzerInformation;
+            analyzerInformation.setDependencies(1, files, includePaths);
+            ASSERT(!analyzerInformation.analyzeFile(".", source.path(), "", 123, errors));
+        }
+        ASSERT(unchanged(source.path(), 1));
+
+        // a header in an include path which is searched first shadows the included one
+        {
+            ScopedFile shadow("analyzerinfo_header.h", "int z;\n", "analyzerinfo_shadow");
+            ASSERT(!unchanged(source.path(), 1));
+        }
+        ASSERT(unchanged(source.path(), 1));
+
+        std::remove(AnalyzerInformation::getAnalyzerInfoFile(".", source.path(), "").c_str());
+    }
+
+    // the inline suppressions, remark comments and macros are restored with the errors
+    void isUnchangedReplay() const {
+        ScopedFile source("analyzerinfo_replay.c", "int x;\n", "analyzerinfo_replay");
+        const std::vector<std::string> files{source.path()};
+        std::list<ErrorMessage> errors;
+
+        {
+            AnalyzerInformation analyzerInformation;
+            analyzerInformation.setDependencies(1, files, {});
+            ASSERT(analyzerInformation.analyzeFile(".", source.path(), "", 123, errors));
+
+            ErrorMessage::FileLocation loc(source.path(), 1, 5);
+            const ErrorMessage msg({std::move(loc)}, emptyString, Severity::style, "msg", "id", Certainty::normal);
+            analyzerInformation.reportErr(msg, {"M1", "M2"});
+
+            SuppressionList::Suppression matched("id1", source.path(), 1);
+            matched.isInline = true;
+            matched.matched = true;
+            matched.checked = true;
+            SuppressionList::Suppression block("id2", source.path(), 2);
+            block.isInline = true;
+            block.type = SuppressionList::Type::block;
+            block.lineBegin = 2;
+            block.lineEnd = 3;
+            block.symbolName = "x";
+            analyzerInformation.setSuppressionsAndRemarks({matched, block}, {RemarkComment(source.path(), 1, "a \"remark\"")});
+        }
+
+        std::list<SuppressionList::Suppression> suppressions;
+        std::vector<RemarkComment> remarkComments;
+        std::map<std::pair<std::string, int>, std::set<std::string>> locationMacros;
+        ASSERT(AnalyzerInformation::isUnchanged(".", source.path(), "", 1, errors, suppressions, remarkComments, locationMacros));
+
+        ASSERT_EQUALS(1, errors.size());
+        ASSERT_EQUALS("id", errors.front().id);
+
+        ASSERT_EQUALS(2, suppressions.size());
+        const SuppressionList::Suppression &s1 = suppressions.front();
+        ASSERT_EQUALS("id1", s1.errorId);
+        ASSERT_EQUALS(source.path(), s1.fileName);
+        ASSERT_EQUALS(1, s1.lineNumber);
+        ASSERT(s1.isInline);
+        ASSERT(s1.matched);
+        ASSERT(s1.checked);
+        const SuppressionList::Suppression &s2 = suppressions.back();
+        ASSERT_EQUALS("id2", s2.errorId);
+        ASSERT(s2.type == SuppressionList::Type::block);
+        ASSERT_EQUALS(2, s2.lineBegin);
+        ASSERT_EQUALS(3, s2.lineEnd);
+        ASSERT_EQUALS("x", s2.symbolName);
+        ASSERT(!s2.matched);
+        ASSERT(!s2.checked);
+
+        ASSERT_EQUALS(1, remarkComments.size());
+        ASSERT_EQUALS(source.path(), remarkComments[0].file);
+        ASSERT_EQUALS(1, remarkComments[0].lineNumber);
+        ASSERT_EQUALS("a \"remark\"", remarkComments[0].str);
+
+        ASSERT_EQUALS(1, locationMacros.size());
+        const std::set<std::string> macroNames{"M1", "M2"};
+        ASSERT(locationMacros[std::make_pair(source.path(), 1)] == macroNames);
+
+        std::remove(AnalyzerInformation::getAnalyzerInfoFile(".", source.path(), "").c_str());
+    }
+
+    static std::size_t fileSize(const std::string &filename) {
+        std::ifstream fin(filename, std::ios::binary | std::ios::ate);
+        return fin.is_open() ? static_cast<std::size_t>(fin.tellg()) : 0;
+    }
+
+    static std::string ctuToString(const FileInfoData &data) {
+        std::string ret;
+        for (const CTU::FileInfo::FunctionCall &functionCall : data.ctu->functionCalls)
+            ret += functionCall.callId + ":" + functionCall.callFunctionName + ":" + std::to_string(functionCall.callArgNr) + ":" + functionCall.callArgumentExpression + ":" + std::to_string(functionCall.callArgValue) + ";";
+        for (const CTU::FileInfo::NestedCall &nestedCall : data.ctu->nestedCalls)
+            ret += nestedCall.callId + ":" + nestedCall.myId + ":" + std::to_string(nestedCall.myArgNr) + ";";
+        return ret;
+    }
+
+    void loadFileInfo() const {
+        ScopedFile filesTxt("files.txt", "file1.a1::file1.c\nfile2.a1:A=1:file2.c\n", "fileinfo_builddir");
+        const std::string buildDir = "fileinfo_builddir";
+        const std::string file1 = Path::join(buildDir, "file1.a1");
+        const std::string file2 = Path::join(buildDir, "file2.a1");
+        const std::string store = Path::join(buildDir, "fileinfo.bin");
+
+        {
+            std::ofstream fout(file1);
+            fout << "<?xml version=\"1.0\"?>\n"
+                    "<analyzerinfo hash=\"1\">\n"
+                    "  <error id=\"x\" severity=\"error\" msg=\"m\" verbose=\"m\"/>\n"
+                    "  <FileInfo check=\"ctu\">\n"
+                    "    <function-call call-id=\"file1.c:1:1\" call-funcname=\"f\" call-argnr=\"1\" file=\"file1.c\" line=\"3\" col=\"5\""
+                    " call-argexpr=\"p\" call-argvaluetype=\"0\" call-argvalue=\"0\"/>\n"
+                    "    <nested-call call-id=\"file1.c:1:1\" call-funcname=\"f\" call-argnr=\"1\" file=\"file1.c\" line=\"4\" col=\"5\""
+                    " my-id=\"file1.c:2:1\" my-argnr=\"1\"/>\n"
+                    "  </FileInfo>\n"
+                    "  <FileInfo check=\"Null pointer\">\n"
+                    "    <unsafe-usage my-id=\"file1.c:1:1\" my-argnr=\"1\" my-argname=\"p\" file=\"file1.c\" line=\"2\" col=\"6\" value=\"0\"/>\n"
+                    "  </FileInfo>\n"
+                    "</analyzerinfo>\n";
+        }
+        const std::string ctu1 = "file1.c:1:1:f:1:p:0;file1.c:1:1:file1.c:2:1:1;";
+
+        // file2.a1 does not exist
+        std::list<FileInfoData> data = AnalyzerInformation::loadFileInfo(buildDir);
+        ASSERT_EQUALS(1, data.size());
+        ASSERT_EQUALS("file1.c", data.front().sourcefile);
+        ASSERT_EQUALS(1, data.front().errors.size());
+        ASSERT_EQUALS("x", data.front().errors.front().id);
+        ASSERT_EQUALS(ctu1, ctuToString(data.front()));
+        ASSERT_EQUALS(1, data.front().fileInfo.size());
+        ASSERT_EQUALS("Null pointer", data.front().fileInfo.front().first);
+        const std::string nullPointer1 = data.front().fileInfo.front().second->toString();
+        ASSERT(nullPointer1.find("my-argname=\"p\"") != std::string::npos);
+        const std::size_t storeSize = fileSize(store);
+        ASSERT(storeSize > 0);
+
+        // nothing changed => the data is decoded from the store and the store is not written
+        data = AnalyzerInformation::loadFileInfo(buildDir, 2);
+        ASSERT_EQUALS(1, data.size());
+        ASSERT_EQUALS(1, data.front().errors.size());
+        ASSERT_EQUALS("x", data.front().errors.front().id);
+        ASSERT_EQUALS("m", data.front().errors.front().shortMessage());
+        ASSERT_EQUALS(ctu1, ctuToString(data.front()));
+        ASSERT_EQUALS(1, data.front().fileInfo.size());
+        ASSERT_EQUALS("Null pointer", data.front().fileInfo.front().first);
+        ASSERT_EQUALS(nullPointer1, data.front().fileInfo.front().second->toString());
+        ASSERT_EQUALS(storeSize, fileSize(store));
+
+        // the record of the new file is appended
+        {
+            std::ofstream fout(file2);
+            fout << "<?xml version=\"1.0\"?>\n"
+                    "<analyzerinfo hash=\"2\">\n"
+                    "  <FileInfo check=\"CheckUnusedFunctions\">\n"
+                    "    <functiondecl functionName=\"g\" lineNumber=\"1\"/>\n"
+                    "    <functioncall functionName=\"f\"/>\n"
+                    "  </FileInfo>\n"
+                    "  <FileInfo>\n"
+                    "  </FileInfo>\n"
+                    "</analyzerinfo>\n";
+        }
+        data = AnalyzerInformation::loadFileInfo(buildDir);
+        ASSERT_EQUALS(2, data.size());
+        ASSERT_EQUALS("file1.c", data.front().sourcefile);
+        ASSERT_EQUALS(ctu1, ctuToString(data.front()));
+        ASSERT_EQUALS("file2.c", data.back().sourcefile);
+        ASSERT_EQUALS(0, data.back().fileInfo.size());
+        ASSERT_EQUALS(1, data.back().functionDecls.size());
+        ASSERT_EQUALS("g", data.back().functionDecls.front().first);
+        ASSERT_EQUALS(1, data.back().functionDecls.front().second);
+        ASSERT_EQUALS(1, data.back().functionCalls.size());
+        ASSERT_EQUALS("f", data.back().functionCalls.front());
+        const std::size_t appendedSize = fileSize(store);
+        ASSERT(appendedSize > storeSize);
+
+        // the stored record of file2.a1 is used
+        data = AnalyzerInformation::loadFileInfo(buildDir);
+        ASSERT_EQUALS(2, data.size());
+        ASSERT_EQUALS("g", data.back().functionDecls.front().first);
+        ASSERT_EQUALS("f", data.back().functionCalls.front());
+        ASSERT_EQUALS(appendedSize, fileSize(store));
+
+        // a broken store is written again
+        {
+            std::ofstream fout(store);
+            fout << "cppcheck";
+        }
+        data = AnalyzerInformation::loadFileInfo(buildDir);
+        ASSERT_EQUALS(2, data.size());
+        ASSERT_EQUALS(ctu1, ctuToString(data.front()));
+        ASSERT_EQUALS(nullPointer1, data.front().fileInfo.front().second->toString());
+        ASSERT(fileSize(store) > storeSize);
+
+        std::remove(file1.c_str());
+        std::remove(file2.c_str());
+        std::remove(store.c_str());
+    }
 };
 
 REGISTER_TEST(TestAnalyzerInformation)
@@ -0,0 +1,85 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2024 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "binarydump.h"
+#include "errortypes.h"
+#include "fixture.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+
+class TestBinaryDump : public TestFixture {
+public:
+    TestBinaryDump() : TestFixture("TestBinaryDump") {}
+
+private:
+    void run() override {
+        TEST_CASE(element);
+        TEST_CASE(elementsInBlocks);
+        TEST_CASE(attributeValue);
+        TEST_CASE(malformed);
+    }
+
+    static std::string numbers(std::size_t width, std::initializer_list<std::uint32_t> values) {
+        std::string out;
+        for (const std::uint32_t value : values) {
+            for (std::size_t i = 0; i < width; ++i)
+                out += static_cast<char>((value >> (8 * i)) & 0xff);
+        }
+        return out;
+    }
+
+    static std::string block(std::initializer_list<std::string> strings, std::initializer_list<std::uint32_t> elements, std::initializer_list<std::uint32_t> attributes) {
+        std::string data;
+        for (const std::string &str : strings) {
+            if (&str != strings.begin())
+                data += '\0';
+            data += str;
+        }
+        return numbers(4, {2, static_cast<std::uint32_t>(strings.size()), static_cast<std::uint32_t>(data.size()), static_cast<std::uint32_t>(elements.size()), static_cast<std::uint32_t>(attributes.size())}) +
+               data + numbers(2, elements) + numbers(2, attributes);
+    }
+
+    void element() const {
+        ASSERT_EQUALS(block({"a", "x", "1", "y"}, {1, 2, 0}, {1, 2, 3, 2}),
+                      BinaryDump::encode("<?xml version=\"1.0\"?>\n<a x=\"1\" y=\"1\"/>\n"));
+        ASSERT_EQUALS(block({"a", "b"}, {1, 0, 2, 0, 0, 2, 0, 0, 0}, {}),
+                      BinaryDump::encode("<a>\n  <b/>\n  <b></b>\n</a>\n"));
+    }
+
+    void elementsInBlocks() const {
+        ASSERT_EQUALS(block({"a"}, {1, 0}, {}), BinaryDump::encode("<a>\n"));
+        ASSERT_EQUALS(block({}, {0}, {}), BinaryDump::encode("</a>\n"));
+        ASSERT_EQUALS(block({}, {}, {}), BinaryDump::encode(""));
+    }
+
+    void attributeValue() const {
+        ASSERT_EQUALS(block({"a", "x", "<>&\"'AB", "y", " ->"}, {1, 2, 0}, {1, 2, 3, 4}),
+                      BinaryDump::encode("<a x=\"&lt;&gt;&amp;&quot;&apos;&#65;&#x42;\" y='\t->'/>"));
+    }
+
+    void malformed() const {
+        ASSERT_THROW_INTERNAL_EQUALS(BinaryDump::encode("<a x=1/>"), INTERNAL, "Failed to encode the binary dump: unquoted attribute value");
+        ASSERT_THROW_INTERNAL_EQUALS(BinaryDump::encode("<a x=\"&nbsp;\"/>"), INTERNAL, "Failed to encode the binary dump: unknown entity 'nbsp'");
+        ASSERT_THROW_INTERNAL_EQUALS(BinaryDump::encode("<a x=\"1\""), INTERNAL, "Failed to encode the binary dump: unterminated element");
+    }
+};
+
+REGISTER_TEST(TestBinaryDump)
@@ -193,6 +193,8 @@ private:
         TEST_CASE(exitcodeSuppressions);
         TEST_CASE(exitcodeSuppressionsNoFile);
         TEST_CASE(fileFilterStdin);
+        TEST_CASE(fileStatistics);
+        TEST_CASE(fileStatisticsEmpty);
         TEST_CASE(fileList);
         TEST_CASE(fileListNoFile);
         TEST_CASE(fileListStdin);
@@ -274,6 +276,9 @@ private:
         TEST_CASE(showtimeTop5);
         TEST_CASE(showtimeTop5File);
         TEST_CASE(showtimeTop5Summary);
+        TEST_CASE(showtimeTrace);
+        TEST_CASE(showtimeTraceFile);
+        TEST_CASE(showtimeTraceFileEmpty);
         TEST_CASE(showtimeNone);
         TEST_CASE(showtimeEmpty);
         TEST_CASE(showtimeInvalid);
@@ -300,6 +305,15 @@ private:
         TEST_CASE(valueFlowMaxIterationsInvalid);
         TEST_CASE(valueFlowMaxIterationsInvalid2);
         TEST_CASE(valueFlowMaxIterationsInvalid3);
+        TEST_CASE(valueFlowJobs);
+        TEST_CASE(valueFlowJobsZero);
+        TEST_CASE(valueFlowJobsInvalid);
+        TEST_CASE(checksJobs);
+        TEST_CASE(checksJobsZero);
+        TEST_CASE(checksJobsInvalid);
+        TEST_CASE(configJobs);
+        TEST_CASE(configJobsZero);
+        TEST_CASE(configJobsInvalid);
         TEST_CASE(checksMaxTime);
         TEST_CASE(checksMaxTime2);
         TEST_CASE(checksMaxTimeInvalid);
@@ -316,6 +330,8 @@ private:
         TEST_CASE(performanceValueflowMaxTimeInvalid);
         TEST_CASE(performanceValueFlowMaxIfCount);
         TEST_CASE(performanceValueFlowMaxIfCountInvalid);
+        TEST_CASE(performanceValueFlowMaxMemory);
+        TEST_CASE(performanceValueFlowMaxMemoryInvalid);
         TEST_CASE(templateMaxTime);
         TEST_CASE(templateMaxTimeInvalid);
         TEST_CASE(templateMaxTimeInvalid2);
@@ -387,6 +403,11 @@ private:
 #else
         TEST_CASE(executorProcessNotSupported);
 #endif
+        TEST_CASE(cacheHeaders);
+        TEST_CASE(addonServer);
+        TEST_CASE(dumpFormatXml);
+        TEST_CASE(dumpFormatBinary);
+        TEST_CASE(dumpFormatInvalid);
         TEST_CASE(checkLevelDefault);
         TEST_CASE(checkLevelNormal);
         TEST_CASE(checkLevelExhaustive);
@@ -1111,6 +1132,20 @@ private:
         ASSERT_EQUALS("file2.cpp", settings->fileFilters[1]);
     }
 
+    void fileStatistics() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--file-statistics=stats.json", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS("stats.json", settings->fileStatistics);
+    }
+
+    void fileStatisticsEmpty() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--file-statistics=", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS("cppcheck: error: no file name specified for '--file-statistics'.\n", logger->str());
+    }
+
     void fileList() {
         REDIRECT;
         ScopedFile file("files.txt",
@@ -1762,6 +1797,29 @@ private:
         ASSERT(settings->showtime == SHOWTIME_MODES::SHOWTIME_TOP5_SUMMARY);
     }
 
+    void showtimeTrace() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--showtime=trace", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parser->parseFromArgs(3, argv));
+        ASSERT(settings->showtime == SHOWTIME_MODES::SHOWTIME_TRACE);
+        ASSERT_EQUALS("", settings->showtimeTraceFile);
+    }
+
+    void showtimeTraceFile() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--showtime=trace:out/trace.json", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parser->parseFromArgs(3, argv));
+        ASSERT(settings->showtime == SHOWTIME_MODES::SHOWTIME_TRACE);
+        ASSERT_EQUALS("out/trace.json", settings->showtimeTraceFile);
+    }
+
+    void showtimeTraceFileEmpty() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--showtime=trace:", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS("cppcheck: error: no file name specified for '--showtime=trace:'.\n", logger->str());
+    }
+
     void showtimeNone() {
         REDIRECT;
         const char * const argv[] = {"cppcheck", "--showtime=none", "file.cpp"};
@@ -1780,7 +1838,7 @@ private:
         REDIRECT;
         const char * const argv[] = {"cppcheck", "--showtime=top10", "file.cpp"};
         ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parser->parseFromArgs(3, argv));
-        ASSERT_EQUALS("cppcheck: error: unrecognized --showtime mode: 'top10'. Supported modes: file, file-total, summary, top5, top5_file, top5_summary.\n", logger->str());
+        ASSERT_EQUALS("cppcheck: error: unrecognized --showtime mode: 'top10'. Supported modes: file, file-total, summary, top5, top5_file, top5_summary, trace, trace:<file>.\n", logger->str());
     }
 
     void errorlist() {
@@ -1945,6 +2003,69 @@ private:
         ASSERT_EQUALS("cppcheck: error: argument to '--valueflow-max-iterations=' is not valid - needs to be positive.\n", logger->str());
     }
 
+    void valueFlowJobs() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--valueflow-jobs=4", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS(4, settings->vfOptions.jobs);
+    }
+
+    void valueFlowJobsZero() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--valueflow-jobs=0", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS("cppcheck: error: argument for '--valueflow-jobs=' must be greater than 0.\n", logger->str());
+    }
+
+    void valueFlowJobsInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--valueflow-jobs=one", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--valueflow-jobs=' is not valid - not an integer.\n", logger->str());
+    }
+
+    void checksJobs() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--checks-jobs=4", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS(4, settings->checksJobs);
+    }
+
+    void checksJobsZero() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--checks-jobs=0", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS("cppcheck: error: argument for '--checks-jobs=' must be greater than 0.\n", logger->str());
+    }
+
+    void checksJobsInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--checks-jobs=one", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--checks-jobs=' is not valid - not an integer.\n", logger->str());
+    }
+
+    void configJobs() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--config-jobs=3", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS(3, settings->configJobs);
+    }
+
+    void configJobsZero() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--config-jobs=0", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS("cppcheck: error: argument for '--config-jobs=' must be greater than 0.\n", logger->str());
+    }
+
+    void configJobsInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--config-jobs=one", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--config-jobs=' is not valid - not an integer.\n", logger->str());
+    }
+
     void checksMaxTime() {
         REDIRECT;
         const char * const argv[] = {"cppcheck", "--checks-max-time=12", "file.cpp"};
@@ -2038,6 +2159,20 @@ private:
         ASSERT_EQUALS("cppcheck: error: argument to '--performance-valueflow-max-if-count=' is not valid - not an integer.\n", logger->str());
     }
 
+    void performanceValueFlowMaxMemory() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--performance-valueflow-max-memory=12", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS(12 * 1024 * 1024, settings->vfOptions.maxMemory);
+    }
+
+    void performanceValueFlowMaxMemoryInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--performance-valueflow-max-memory=-1", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS("cppcheck: error: argument to '--performance-valueflow-max-memory=' is not valid - needs to be positive.\n", logger->str());
+    }
+
     void templateMaxTime() {
         REDIRECT;
         const char * const argv[] = {"cppcheck", "--template-max-time=12", "file.cpp"};
@@ -2601,6 +2736,44 @@ private:
     }
 #endif
 
+    void cacheHeaders() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--cache-headers", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS(true, settings->cacheHeaders);
+    }
+
+    void addonServer() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--addon-server", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS(true, settings->addonServer);
+#if defined(HAS_THREADING_MODEL_THREAD)
+        ASSERT_EQUALS_ENUM(Settings::ExecutorType::Thread, settings->executor);
+#endif
+    }
+
+    void dumpFormatXml() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--dump-format=xml", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS_ENUM(Settings::DumpFormat::Xml, settings->dumpFormat);
+    }
+
+    void dumpFormatBinary() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--dump-format=binary", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Success, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS_ENUM(Settings::DumpFormat::Binary, settings->dumpFormat);
+    }
+
+    void dumpFormatInvalid() {
+        REDIRECT;
+        const char * const argv[] = {"cppcheck", "--dump-format=json", "file.cpp"};
+        ASSERT_EQUALS_ENUM(CmdLineParser::Result::Fail, parser->parseFromArgs(3, argv));
+        ASSERT_EQUALS("cppcheck: error: unknown dump format: 'json'.\n", logger->str());
+    }
+
     // the CLI default to --check-level=normal
     void checkLevelDefault() {
         REDIRECT;
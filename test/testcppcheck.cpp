@@ -55,6 +55,8 @@ private:
         TEST_CASE(getErrorMessages);
         TEST_CASE(checkWithFile);
         TEST_CASE(checkWithFS);
+        TEST_CASE(checkWithChecksJobs);
+        TEST_CASE(checkWithConfigJobs);
         TEST_CASE(suppress_error_library);
         TEST_CASE(unique_errors);
         TEST_CASE(isPremiumCodingStandardId);
@@ -133,6 +135,68 @@ private:
         ASSERT_EQUALS("nullPointer", *errorLogger.ids.cbegin());
     }
 
+    void checkWithChecksJobs() const
+    {
+        ScopedFile file("test.cpp",
+                        "int main()\n"
+                        "{\n"
+                        "  int i = *((int*)0);\n"
+                        "  char buf[10];\n"
+                        "  buf[10] = 0;\n"
+                        "  return i;\n"
+                        "}");
+
+        ErrorLogger2 errorLogger1;
+        CppCheck cppcheck1(errorLogger1, false, {});
+        cppcheck1.settings().severity.enable(Severity::warning);
+        ASSERT_EQUALS(1, cppcheck1.check(FileWithDetails(file.path())));
+
+        ErrorLogger2 errorLogger4;
+        CppCheck cppcheck4(errorLogger4, false, {});
+        cppcheck4.settings().severity.enable(Severity::warning);
+        cppcheck4.settings().checksJobs = 4;
+        ASSERT_EQUALS(1, cppcheck4.check(FileWithDetails(file.path())));
+
+        // the findings are reported in the same order regardless of the number of threads
+        ASSERT(std::find(errorLogger1.ids.cbegin(), errorLogger1.ids.cend(), "nullPointer") != errorLogger1.ids.cend());
+        ASSERT(std::find(errorLogger1.ids.cbegin(), errorLogger1.ids.cend(), "arrayIndexOutOfBounds") != errorLogger1.ids.cend());
+        ASSERT_EQUALS(errorLogger1.ids.size(), errorLogger4.ids.size());
+        ASSERT(errorLogger1.ids == errorLogger4.ids);
+    }
+
+    void checkWithConfigJobs() const
+    {
+        ScopedFile file("test.cpp",
+                        "#ifdef A\n"
+                        "void fa() { int *p = 0; *p = 1; }\n"
+                        "#endif\n"
+                        "#ifdef B\n"
+                        "void fb() { char b[2]; b[2] = 0; }\n"
+                        "#endif\n"
+                        "#ifdef C\n"
+                        "#endif\n"
+                        "void g() { int a[3]; a[3] = 1; }\n");
+
+        ErrorLogger2 errorLogger1;
+        CppCheck cppcheck1(errorLogger1, false, {});
+        cppcheck1.settings().force = true;
+        cppcheck1.settings().debugwarnings = true;
+        ASSERT_EQUALS(1, cppcheck1.check(FileWithDetails(file.path())));
+
+        ErrorLogger2 errorLogger4;
+        CppCheck cppcheck4(errorLogger4, false, {});
+        cppcheck4.settings().force = true;
+        cppcheck4.settings().debugwarnings = true;
+        cppcheck4.settings().configJobs = 4;
+        ASSERT_EQUALS(1, cppcheck4.check(FileWithDetails(file.path())));
+
+        // the findings are reported in the order of the configurations regardless of the number of threads
+        ASSERT(std::find(errorLogger1.ids.cbegin(), errorLogger1.ids.cend(), "nullPointer") != errorLogger1.ids.cend());
+        ASSERT(std::find(errorLogger1.ids.cbegin(), errorLogger1.ids.cend(), "purgedConfiguration") != errorLogger1.ids.cend());
+        ASSERT_EQUALS(errorLogger1.ids.size(), errorLogger4.ids.size());
+        ASSERT(errorLogger1.ids == errorLogger4.ids);
+    }
+
     void suppress_error_library() const
     {
         ScopedFile file("test.cpp",
@@ -0,0 +1,97 @@
+/*
+ * Cppcheck - A tool for static C/C++ code analysis
+ * Copyright (C) 2007-2024 Cppcheck team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "errortypes.h"
+#include "filestatistics.h"
+#include "fixture.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+class TestFileStatistics : public TestFixture {
+public:
+    TestFileStatistics() : TestFixture("TestFileStatistics") {}
+
+private:
+    void run() override {
+        TEST_CASE(json);
+        TEST_CASE(jsonInvalid);
+        TEST_CASE(text);
+        TEST_CASE(sort);
+    }
+
+    static FileStatistics create(const std::string &file, const std::string &cfg) {
+        FileStatistics s;
+        s.file = file;
+        s.configuration = cfg;
+        s.tokens = 100;
+        s.scopes = 3;
+        s.functions = 2;
+        s.values = 40;
+        s.peakMemoryDelta = 1024;
+        s.simplifyTokensSeconds = 0.5;
+        s.checksSeconds = 0.25;
+        return s;
+    }
+
+    void json() const {
+        const std::vector<FileStatistics> statistics{create("a.c", ""), create("b \"1\".c", "A=1")};
+        const std::vector<FileStatistics> read = FileStatistics::fromJson(FileStatistics::toJson(statistics));
+        ASSERT_EQUALS(2, read.size());
+        ASSERT_EQUALS("a.c", read[0].file);
+        ASSERT_EQUALS("", read[0].configuration);
+        ASSERT_EQUALS("b \"1\".c", read[1].file);
+        ASSERT_EQUALS("A=1", read[1].configuration);
+        ASSERT_EQUALS(100, read[1].tokens);
+        ASSERT_EQUALS(3, read[1].scopes);
+        ASSERT_EQUALS(2, read[1].functions);
+        ASSERT_EQUALS(40, read[1].values);
+        ASSERT_EQUALS(1024, read[1].peakMemoryDelta);
+        ASSERT_EQUALS_DOUBLE(0.5, read[1].simplifyTokensSeconds, 0.001);
+        ASSERT_EQUALS_DOUBLE(0.25, read[1].checksSeconds, 0.001);
+
+        ASSERT_EQUALS(0, FileStatistics::fromJson(FileStatistics::toJson({})).size());
+    }
+
+    void jsonInvalid() const {
+        ASSERT_THROW_INTERNAL(FileStatistics::fromJson("{"), INTERNAL);
+        ASSERT_THROW_INTERNAL(FileStatistics::fromJson("[]"), INTERNAL);
+        ASSERT_THROW_INTERNAL_EQUALS(FileStatistics::fromJson("{\"files\":[{\"file\":\"a.c\"}]}"), INTERNAL, "Failed to read the file statistics: invalid 'configuration'");
+    }
+
+    void text() const {
+        std::ostringstream out;
+        FileStatistics::writeText(out, {create("a.c", ""), create("b.c", "A=1")});
+        ASSERT_EQUALS("a.c: tokens=100 scopes=3 functions=2 values=40 peak-memory-delta=1024KiB simplifyTokens1=0.5s checks=0.25s\n"
+                      "b.c (A=1): tokens=100 scopes=3 functions=2 values=40 peak-memory-delta=1024KiB simplifyTokens1=0.5s checks=0.25s\n",
+                      out.str());
+    }
+
+    void sort() const {
+        std::vector<FileStatistics> statistics{create("b.c", ""), create("a.c", "B"), create("a.c", "A")};
+        FileStatistics::sort(statistics);
+        ASSERT_EQUALS("a.c", statistics[0].file);
+        ASSERT_EQUALS("A", statistics[0].configuration);
+        ASSERT_EQUALS("a.c", statistics[1].file);
+        ASSERT_EQUALS("B", statistics[1].configuration);
+        ASSERT_EQUALS("b.c", statistics[2].file);
+    }
+};
+
+REGISTER_TEST(TestFileStatistics)
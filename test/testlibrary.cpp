@@ -69,6 +69,7 @@ private:
         TEST_CASE(version);
         TEST_CASE(loadLibErrors);
         TEST_CASE(loadLibCombinations);
+        TEST_CASE(copy);
     }
 
     void isCompliantValidationExpression() const {
@@ -1122,6 +1123,35 @@ private:
         LOADLIB_ERROR_INVALID_RANGE("-10:0,.5:");
     }
 
+    void copy() const {
+        constexpr char xmldata1[] = "<?xml version=\"1.0\"?>\n"
+                                    "<def>\n"
+                                    "  <function name=\"foo\"/>\n"
+                                    "</def>";
+        constexpr char xmldata2[] = "<?xml version=\"1.0\"?>\n"
+                                    "<def>\n"
+                                    "  <function name=\"bar\"/>\n"
+                                    "</def>";
+
+        Library library1;
+        ASSERT(LibraryHelper::loadxmldata(library1, xmldata1, sizeof(xmldata1)));
+
+        // the data is shared until one of the libraries is modified
+        Library library2(library1);
+        ASSERT_EQUALS(&library1.functions(), &library2.functions());
+        Library library3;
+        library3 = library1;
+        ASSERT_EQUALS(&library1.functions(), &library3.functions());
+
+        ASSERT(LibraryHelper::loadxmldata(library2, xmldata2, sizeof(xmldata2)));
+        ASSERT(&library1.functions() != &library2.functions());
+        ASSERT_EQUALS(1U, library1.functions().size());
+        ASSERT_EQUALS(1U, library1.functions().count("foo"));
+        ASSERT_EQUALS(2U, library2.functions().size());
+        ASSERT_EQUALS(1U, library3.functions().size());
+        ASSERT_EQUALS(&library1.functions(), &library3.functions());
+    }
+
     void loadLibCombinations() const {
         {
             const Settings s = settingsBuilder().library("std.cfg").library("gnu.cfg").library("bsd.cfg").build();
@@ -173,6 +173,7 @@ private:
         TEST_CASE(isPointerDeRefFunctionDecl);
 
         TEST_CASE(ctuTest);
+        TEST_CASE(ctuDepth);
     }
 
 #define check(...) check_(__FILE__, __LINE__, __VA_ARGS__)
@@ -4649,6 +4650,50 @@ private:
             "}\n");
         ASSERT_EQUALS("", errout_str());
     }
+
+    void ctuDepth() {
+        setMultiline();
+
+        const char code[] = "void f0(int *p) { a = *p; }\n"
+                            "void f1(int x, int *p) { f0(p); }\n"
+                            "void f2(int *p) { f1(1, p); }\n"
+                            "void f3(int *p) { f2(p); }\n"
+                            "void f4(int *p) { f3(p); }\n"
+                            "void g() { f3(0); }\n"
+                            "void h() { f4(0); }\n";
+
+        struct RestoreMaxCtuDepth {
+            const int maxCtuDepth = CTU::maxCtuDepth;
+            ~RestoreMaxCtuDepth() {
+                CTU::maxCtuDepth = maxCtuDepth;
+            }
+        } restoreMaxCtuDepth;
+
+        CTU::maxCtuDepth = 1;
+        ctu(code);
+        ASSERT_EQUALS("", errout_str());
+
+        // ValueFlow forwards the null value to f2
+        CTU::maxCtuDepth = 2;
+        ctu(code);
+        ASSERT_EQUALS("test.cpp:1:error:Null pointer dereference: p\n"
+                      "test.cpp:6:note:Calling function 'f3', 1st argument '0' value is 0\n"
+                      "test.cpp:4:note:Calling function 'f2', 1st argument 'p' value is 0\n"
+                      "test.cpp:3:note:Calling function f1, 2nd argument is null\n"
+                      "test.cpp:2:note:Calling function f0, 1st argument is null\n"
+                      "test.cpp:1:note:Dereferencing argument p that is null\n", errout_str());
+
+        // the first path in the order of the calls is reported
+        CTU::maxCtuDepth = 5;
+        ctu(code);
+        ASSERT_EQUALS("test.cpp:1:error:Null pointer dereference: p\n"
+                      "test.cpp:7:note:Calling function f4, 1st argument is null\n"
+                      "test.cpp:5:note:Calling function f3, 1st argument is null\n"
+                      "test.cpp:4:note:Calling function f2, 1st argument is null\n"
+                      "test.cpp:3:note:Calling function f1, 2nd argument is null\n"
+                      "test.cpp:2:note:Calling function f0, 1st argument is null\n"
+                      "test.cpp:1:note:Dereferencing argument p that is null\n", errout_str());
+    }
 };
 
 REGISTER_TEST(TestNullPointer)
@@ -21,6 +21,7 @@
 #include "helpers.h"
 #include "standards.h"
 
+#include <cstdint>
 #include <list>
 #include <set>
 #include <string>
@@ -43,6 +44,7 @@ private:
         TEST_CASE(join);
         TEST_CASE(isDirectory);
         TEST_CASE(isFile);
+        TEST_CASE(getFileStamp);
         TEST_CASE(sameFileName);
         TEST_CASE(getFilenameExtension);
         TEST_CASE(identify);
@@ -164,6 +166,17 @@ private:
         ASSERT_EQUALS(true, Path::isFile("testpath2.txt"));
     }
 
+    void getFileStamp() const {
+        ScopedFile file("testpath.txt", "abc", "testpath");
+        std::uint64_t size = 0;
+        std::uint64_t mtime = 0;
+        ASSERT_EQUALS(true, Path::getFileStamp("testpath/testpath.txt", size, mtime));
+        ASSERT_EQUALS(3, size);
+        ASSERT(mtime > 0);
+        ASSERT_EQUALS(true, Path::getFileStamp("testpath", size, mtime));
+        ASSERT_EQUALS(false, Path::getFileStamp("testpath/none.txt", size, mtime));
+    }
+
     void sameFileName() const {
         ASSERT(Path::sameFileName("test", "test"));
 
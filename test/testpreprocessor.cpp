@@ -266,6 +266,9 @@ private:
         TEST_CASE(limitsDefines);
 
         TEST_CASE(hashCalculation);
+
+        TEST_CASE(headerCache);
+        TEST_CASE(headerCacheEviction);
     }
 
     std::string getConfigsStr(const char filedata[], const char *arg = nullptr) {
@@ -286,6 +289,18 @@ private:
         return ret;
     }
 
+    std::string getcodeWithHeaderCache(HeaderTokenCache *cache, const char code[], const char filename[]) {
+        const Settings settings;
+        Preprocessor preprocessor(settings, *this);
+        preprocessor.setHeaderCache(cache);
+        std::vector<std::string> files;
+        std::istringstream istr(code);
+        simplecpp::TokenList tokens1(istr, files, filename);
+        if (!preprocessor.loadFiles(tokens1, files))
+            return "";
+        return preprocessor.getcode(tokens1, "", files, true);
+    }
+
     std::size_t getHash(const char filedata[]) {
         Settings settings;
         Preprocessor preprocessor(settings, *this);
@@ -2536,6 +2551,66 @@ private:
         ASSERT(getHash(code) != getHash(code3));
         ASSERT(getHash(code2) != getHash(code3));
     }
+
+    void headerCache() {
+        HeaderTokenCache cache;
+        const char code1[] = "#include \"header.h\"\nint a = X;\n";
+        const char code2[] = "#include \"other.h\"\n#include \"header.h\"\nint b = X;\n";
+
+        {
+            ScopedFile header("header.h", "// comment\nint x;\n#define X 1\n");
+            ScopedFile other("other.h", "int y;\n");
+
+            const std::string expected1 = getcodeWithHeaderCache(nullptr, code1, "test1.c");
+            const std::string expected2 = getcodeWithHeaderCache(nullptr, code2, "test2.c");
+            ASSERT_EQUALS(expected1, getcodeWithHeaderCache(&cache, code1, "test1.c"));
+            ASSERT_EQUALS(0, cache.hits());
+            ASSERT_EQUALS(1, cache.misses());
+
+            // file indexes differ in the second file
+            ASSERT_EQUALS(expected2, getcodeWithHeaderCache(&cache, code2, "test2.c"));
+            ASSERT_EQUALS(1, cache.hits());
+            ASSERT_EQUALS(2, cache.misses());
+        }
+
+        {
+            // modified header must be lexed again
+            ScopedFile header("header.h", "int z;\n#define X 2\n");
+            const std::string expected1 = getcodeWithHeaderCache(nullptr, code1, "test1.c");
+            ASSERT_EQUALS(expected1, getcodeWithHeaderCache(&cache, code1, "test1.c"));
+            ASSERT_EQUALS(1, cache.hits());
+            ASSERT_EQUALS(3, cache.misses());
+        }
+
+        cache.clear();
+        ASSERT_EQUALS(0, cache.hits());
+        ASSERT_EQUALS(0, cache.misses());
+        ASSERT_EQUALS(0, cache.tokens());
+    }
+
+    void headerCacheEviction() {
+        ScopedFile header1("header1.h", "int x;\n");
+        ScopedFile header2("header2.h", "int y;\n");
+        const char code1[] = "#include \"header1.h\"\nint a;\n";
+        const char code2[] = "#include \"header2.h\"\nint b;\n";
+
+        // room for one of the headers
+        HeaderTokenCache cache(4);
+        const std::string expected1 = getcodeWithHeaderCache(nullptr, code1, "test1.c");
+        ASSERT_EQUALS(expected1, getcodeWithHeaderCache(&cache, code1, "test1.c"));
+        ASSERT_EQUALS(expected1, getcodeWithHeaderCache(&cache, code1, "test1.c"));
+        ASSERT_EQUALS(1, cache.hits());
+        ASSERT_EQUALS(1, cache.misses());
+        ASSERT_EQUALS(3, cache.tokens());
+
+        // header1.h is removed
+        getcodeWithHeaderCache(&cache, code2, "test2.c");
+        ASSERT_EQUALS(2, cache.misses());
+        ASSERT_EQUALS(3, cache.tokens());
+        ASSERT_EQUALS(expected1, getcodeWithHeaderCache(&cache, code1, "test1.c"));
+        ASSERT_EQUALS(1, cache.hits());
+        ASSERT_EQUALS(3, cache.misses());
+    }
 };
 
 REGISTER_TEST(TestPreprocessor)
@@ -130,6 +130,7 @@ private:
 #if !defined(WIN32) && !defined(__MINGW32__) && !defined(__CYGWIN__)
         TEST_CASE(deadlock_with_many_errors);
         TEST_CASE(many_threads);
+        TEST_CASE(many_errors_per_file);
         TEST_CASE(many_threads_showtime);
         TEST_CASE(many_threads_plist);
         TEST_CASE(no_errors_more_files);
@@ -173,6 +174,22 @@ private:
         ASSERT_EQUALS(num_files, cppcheck::count_all_of(errout_str(), "(error) Null pointer dereference: (int*)0"));
     }
 
+    // several messages are read from the pipe at once
+    void many_errors_per_file() {
+        std::ostringstream oss;
+        oss << "int main()\n"
+            << "{\n";
+        const int num_err = 500;
+        for (int i = 0; i < num_err; i++) {
+            oss << "  {int i = *((int*)0);}\n";
+        }
+        oss << "  return 0;\n"
+            << "}\n";
+        const int num_files = 4;
+        check(2, num_files, num_files, oss.str());
+        ASSERT_EQUALS(1LL * num_err * num_files, cppcheck::count_all_of(errout_str(), "(error) Null pointer dereference: (int*)0"));
+    }
+
     // #11249 - reports TSAN errors
     void many_threads_showtime() {
         SUPPRESS;
@@ -310,6 +327,7 @@ private:
                     $.showtime = SHOWTIME_MODES::SHOWTIME_FILE));
         const std::string output_s = GET_REDIRECT_OUTPUT;
         TODO_ASSERT_EQUALS(2, 0, cppcheck::count_all_of(output_s, "Overall time:"));
+        ASSERT_EQUALS(2, cppcheck::count_all_of(output_str(), "Function lookups:"));
     }
 
     void showtime_summary() {
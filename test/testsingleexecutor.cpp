@@ -188,6 +188,7 @@ private:
               "}", dinit(CheckOptions, $.showtime = SHOWTIME_MODES::SHOWTIME_SUMMARY));
         // we are not interested in the results - so just consume them
         ignore_errout();
+        ASSERT_EQUALS(1, cppcheck::count_all_of(output_str(), "Function lookups:"));
     }
 
     void many_files_plist() {
@@ -316,6 +317,7 @@ private:
                     $.showtime = SHOWTIME_MODES::SHOWTIME_FILE));
         const std::string output_s = GET_REDIRECT_OUTPUT;
         ASSERT_EQUALS(2, cppcheck::count_all_of(output_s, "Overall time:"));
+        ASSERT_EQUALS(2, cppcheck::count_all_of(output_str(), "Function lookups:"));
     }
 
     void showtime_summary() {
@@ -328,6 +330,7 @@ private:
         // should only report the actual summary once
         ASSERT(output_s.find("1 result(s)") == std::string::npos);
         ASSERT(output_s.find("2 result(s)") != std::string::npos);
+        ASSERT_EQUALS(1, cppcheck::count_all_of(output_str(), "Function lookups:"));
     }
 
     void showtime_file_total() {
@@ -94,6 +94,7 @@ private:
         TEST_CASE(suppressingSyntaxErrorAndExitCodeMultiFileFiles);
         TEST_CASE(suppressingSyntaxErrorAndExitCodeMultiFileFS);
         TEST_CASE(suppressLocal);
+        TEST_CASE(suppressionsIndex);
 
         TEST_CASE(suppressUnmatchedSuppressions);
 
@@ -1392,6 +1393,46 @@ private:
         ASSERT_EQUALS(false, suppressions.isSuppressed(errorMessage("errorid2", "test2.cpp", 1), false));
     }
 
+    void suppressionsIndex() const {
+        SuppressionList suppressions;
+        std::istringstream s("errorid:test.cpp\n"
+                             "errorid:sub\\test2.cpp\n"
+                             "errorid:*3.cpp\n"
+                             "errorid\n"
+                             "err*\n"
+                             "otherid:test.cpp:5\n");
+        ASSERT_EQUALS("", suppressions.parseFile(s));
+        ASSERT_EQUALS("", suppressions.addSuppressionLine("errorid:test.cpp"));
+        ASSERT_EQUALS(6, suppressions.getSuppressions().size());
+
+        // all the matching suppressions are marked as matched
+        ASSERT_EQUALS(true, suppressions.isSuppressed(errorMessage("errorid", "test.cpp", 1)));
+        std::list<SuppressionList::Suppression> matched;
+        for (const SuppressionList::Suppression &suppression : suppressions.getSuppressions()) {
+            if (suppression.matched)
+                matched.push_back(suppression);
+        }
+        ASSERT_EQUALS(3, matched.size());
+        ASSERT_EQUALS("errorid fileName=test.cpp", matched.front().getText());
+        ASSERT_EQUALS("err*", matched.back().getText());
+
+        ASSERT_EQUALS(true, suppressions.isSuppressed(errorMessage("errorid", "sub/test2.cpp", 1), false));
+        ASSERT_EQUALS(true, suppressions.isSuppressed(errorMessage("errorid", "test3.cpp", 1)));
+        ASSERT_EQUALS(false, suppressions.isSuppressed(errorMessage("errorid", "test4.cpp", 1), false));
+        ASSERT_EQUALS(true, suppressions.isSuppressed(errorMessage("otherid", "test.cpp", 5)));
+        ASSERT_EQUALS(false, suppressions.isSuppressed(errorMessage("otherid", "test.cpp", 6)));
+        ASSERT_EQUALS(false, suppressions.isSuppressed(errorMessage("otherid", "test2.cpp", 5)));
+
+        // the first matching suppression is used
+        SuppressionList copy(suppressions);
+        ASSERT_EQUALS(true, copy.isSuppressedExplicitly(errorMessage("errorid", "test3.cpp", 1)));
+        ASSERT_EQUALS(false, copy.isSuppressedExplicitly(errorMessage("errorjd", "test3.cpp", 1)));
+        ASSERT_EQUALS(true, copy.isSuppressed(errorMessage("errorjd", "test3.cpp", 1)));
+        ASSERT_EQUALS("", copy.addSuppressionLine("errorid:*3.cpp"));
+        ASSERT_EQUALS(6, copy.getSuppressions().size());
+        ASSERT_EQUALS(6, suppressions.getSuppressions().size());
+    }
+
     void suppressUnmatchedSuppressions() {
         std::list<SuppressionList::Suppression> suppressions;
 
@@ -23,6 +23,7 @@
 #include "settings.h"
 #include "sourcelocation.h"
 #include "symboldatabase.h"
+#include "timer.h"
 #include "token.h"
 #include "tokenize.h"
 #include "tokenlist.h"
@@ -519,6 +520,7 @@ private:
         TEST_CASE(findFunctionContainer);
         TEST_CASE(findFunctionExternC);
         TEST_CASE(findFunctionGlobalScope); // ::foo
+        TEST_CASE(findFunctionIndex);
 
         TEST_CASE(overloadedFunction1);
 
@@ -8342,6 +8344,54 @@ private:
         ASSERT(bar->function());
     }
 
+    void findFunctionIndex() {
+        SymbolDatabase::resetFunctionLookups();
+        {
+            // the lookups are only counted when they are shown
+            GET_SYMBOL_DB("int f(int a);\n"
+                          "int g() { return f(1) + unknown(1); }");
+            ASSERT_EQUALS(0, SymbolDatabase::functionLookups());
+        }
+
+        Settings settings = settings1;
+        settings.showtime = SHOWTIME_MODES::SHOWTIME_SUMMARY;
+        SimpleTokenizer tokenizer(settings, *this);
+        const SymbolDatabase *db = getSymbolDB_inner(tokenizer, "namespace {\n"
+                                                    "    int f(int a);\n"
+                                                    "}\n"
+                                                    "struct B {\n"
+                                                    "    int g(int a, int b = 0);\n"
+                                                    "};\n"
+                                                    "struct D : B {\n"
+                                                    "    int g(int a, int b, int c);\n"
+                                                    "    int h() { return f(1) + g(1) + g(1, 2) + g(1, 2, 3) + unknown(1); }\n"
+                                                    "};", true);
+        ASSERT(db);
+
+        const Token *f = Token::findsimplematch(tokenizer.tokens(), "f ( 1 )");
+        ASSERT(f && f->function());
+        ASSERT_EQUALS(2, f->function()->tokenDef->linenr());
+
+        const Token *g1 = Token::findsimplematch(tokenizer.tokens(), "g ( 1 )");
+        ASSERT(g1 && g1->function());
+        ASSERT_EQUALS(5, g1->function()->tokenDef->linenr());
+
+        const Token *g2 = Token::findsimplematch(tokenizer.tokens(), "g ( 1 , 2 )");
+        ASSERT(g2 && g2->function());
+        ASSERT_EQUALS(5, g2->function()->tokenDef->linenr());
+
+        const Token *g3 = Token::findsimplematch(tokenizer.tokens(), "g ( 1 , 2 , 3 )");
+        ASSERT(g3 && g3->function());
+        ASSERT_EQUALS(8, g3->function()->tokenDef->linenr());
+
+        const Token *unknown = Token::findsimplematch(tokenizer.tokens(), "unknown (");
+        ASSERT(unknown && !unknown->function());
+
+        ASSERT(SymbolDatabase::functionLookups() > 0);
+        ASSERT(SymbolDatabase::functionLookupsRejected() > 0);
+        ASSERT(SymbolDatabase::functionLookupsRejected() < SymbolDatabase::functionLookups());
+    }
+
     void overloadedFunction1() {
         GET_SYMBOL_DB("struct S {\n"
                       "    int operator()(int);\n"
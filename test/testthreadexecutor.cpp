@@ -27,6 +27,7 @@
 
 #include <cstdlib>
 #include <list>
+#include <map>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -145,6 +146,8 @@ private:
         TEST_CASE(showtime_file_total);
         TEST_CASE(suppress_error_library);
         TEST_CASE(unique_errors);
+        TEST_CASE(schedule_size);
+        TEST_CASE(schedule_durations);
     }
 
     void deadlock_with_many_errors() {
@@ -184,6 +187,7 @@ private:
               "}", dinit(CheckOptions, $.showtime = SHOWTIME_MODES::SHOWTIME_SUMMARY));
         // we are not interested in the results - so just consume them
         ignore_errout();
+        ASSERT_EQUALS(1, cppcheck::count_all_of(output_str(), "Function lookups:"));
     }
 
     void many_threads_plist() {
@@ -308,6 +312,7 @@ private:
                     $.showtime = SHOWTIME_MODES::SHOWTIME_FILE));
         const std::string output_s = GET_REDIRECT_OUTPUT;
         ASSERT_EQUALS(2, cppcheck::count_all_of(output_s, "Overall time:"));
+        ASSERT_EQUALS(2, cppcheck::count_all_of(output_str(), "Function lookups:"));
     }
 
     void showtime_summary() {
@@ -320,6 +325,7 @@ private:
         // should only report the actual summary once
         ASSERT(output_s.find("1 result(s)") == std::string::npos);
         ASSERT(output_s.find("2 result(s)") != std::string::npos);
+        ASSERT_EQUALS(1, cppcheck::count_all_of(output_str(), "Function lookups:"));
     }
 
     void showtime_file_total() {
@@ -361,6 +367,39 @@ private:
         ASSERT_EQUALS("[" + inc_h.name() + ":3]: (error) Null pointer dereference: (int*)0\n", errout_str());
     }
 
+    std::string schedule(const std::vector<std::pair<std::string, std::size_t>> &files, const std::map<std::string, std::size_t> &durations) const
+    {
+        std::list<FileWithDetails> filelist;
+        std::list<FileSettings> fileSettings;
+        for (const std::pair<std::string, std::size_t> &f : files) {
+            if (useFS)
+                fileSettings.emplace_back(f.first, f.second);
+            else
+                filelist.emplace_back(f.first, f.second);
+        }
+        std::map<std::string, std::size_t> names;
+        for (const std::pair<const std::string, std::size_t> &d : durations)
+            names[useFS ? (d.first + ' ') : d.first] = d.second;
+
+        std::string ret;
+        for (const Executor::ScheduledFile &f : Executor::scheduleFiles(filelist, fileSettings, names))
+            ret += (f.fs ? f.fs->filename() : f.file->path()) + ' ';
+        return ret;
+    }
+
+    void schedule_size() {
+        ASSERT_EQUALS("c.c b.c a.c d.c ", schedule({{"a.c", 10}, {"b.c", 200}, {"c.c", 3000}, {"d.c", 10}}, {}));
+        ASSERT_EQUALS("", schedule({}, {}));
+    }
+
+    void schedule_durations() {
+        // the durations of the previous analysis take precedence over the size
+        ASSERT_EQUALS("a.c c.c b.c ", schedule({{"a.c", 10}, {"b.c", 100}, {"c.c", 3000}}, {{"a.c", 5000}, {"c.c", 300}}));
+        // files without a duration are estimated from the size relative to the known files
+        ASSERT_EQUALS("b.c a.c ", schedule({{"a.c", 100}, {"b.c", 200}}, {{"a.c", 1000}}));
+        ASSERT_EQUALS("a.c b.c c.c ", schedule({{"a.c", 100}, {"b.c", 200}, {"c.c", 1000}}, {{"a.c", 5000}, {"c.c", 100}}));
+    }
+
     // TODO: test whole program analysis
 };
 
@@ -19,8 +19,14 @@
 #include "fixture.h"
 #include "timer.h"
 
+#include <chrono>
 #include <cmath>
-#include <ctime>
+#include <future>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
 
 class TestTimer : public TestFixture {
 public:
@@ -30,15 +36,127 @@ private:
 
     void run() override {
         TEST_CASE(result);
+        TEST_CASE(threadResults);
+        TEST_CASE(threadOutlivesResults);
+        TEST_CASE(wallTime);
+        TEST_CASE(traceEvents);
+        TEST_CASE(writeTrace);
     }
 
     void result() const {
         TimerResultsData t1;
-        t1.mClocks = ~(std::clock_t)0;
+        t1.mCpuTime = std::chrono::hours(1);
         ASSERT(t1.seconds() > 100.0);
 
-        t1.mClocks = CLOCKS_PER_SEC * 5 / 2;
+        t1.mCpuTime = std::chrono::milliseconds(2500);
         ASSERT(std::fabs(t1.seconds()-2.5) < 0.01);
+
+        t1.mWallTime = std::chrono::milliseconds(1500);
+        ASSERT(std::fabs(t1.wallSeconds()-1.5) < 0.01);
+    }
+
+    void threadResults() const {
+        TimerResults timerResults;
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 4; ++i) {
+            threads.emplace_back([&timerResults]() {
+                for (int j = 0; j < 100; ++j)
+                    timerResults.addResults(j % 2 ? "a" : "b", std::chrono::milliseconds(1), std::chrono::milliseconds(2));
+            });
+        }
+        for (std::thread &t : threads)
+            t.join();
+
+        std::map<std::string, TimerResultsData> results = timerResults.getResults();
+        ASSERT_EQUALS(2, results.size());
+        ASSERT_EQUALS(200, results["a"].mNumberOfResults);
+        ASSERT_EQUALS(200, std::chrono::duration_cast<std::chrono::milliseconds>(results["a"].mCpuTime).count());
+        ASSERT_EQUALS(400, std::chrono::duration_cast<std::chrono::milliseconds>(results["a"].mWallTime).count());
+        ASSERT_EQUALS(200, results["b"].mNumberOfResults);
+
+        timerResults.reset();
+        ASSERT_EQUALS(0, timerResults.getResults().size());
+        timerResults.addResults("c", std::chrono::milliseconds(1), std::chrono::milliseconds(1));
+        ASSERT_EQUALS(1, timerResults.getResults().size());
+    }
+
+    void threadOutlivesResults() const {
+        std::promise<void> added;
+        std::promise<void> destroyed;
+        std::thread thread;
+        {
+            TimerResults timerResults;
+            thread = std::thread([&timerResults, &added, &destroyed]() {
+                timerResults.addResults("a", std::chrono::milliseconds(1), std::chrono::milliseconds(1));
+                added.set_value();
+                // the buffer of this thread is not folded into a TimerResults which does not exist anymore
+                destroyed.get_future().wait();
+            });
+            added.get_future().wait();
+            ASSERT_EQUALS(1, timerResults.getResults()["a"].mNumberOfResults);
+        }
+        destroyed.set_value();
+        thread.join();
+
+        // a new instance does not get the results of the old one
+        TimerResults timerResults;
+        std::thread([&timerResults]() {
+            timerResults.addResults("b", std::chrono::milliseconds(1), std::chrono::milliseconds(1));
+        }).join();
+        const std::map<std::string, TimerResultsData> results = timerResults.getResults();
+        ASSERT_EQUALS(1, results.size());
+        ASSERT_EQUALS(1, results.at("b").mNumberOfResults);
+    }
+
+    void wallTime() const {
+        TimerResults timerResults;
+        {
+            Timer t("sleep", SHOWTIME_MODES::SHOWTIME_SUMMARY, &timerResults);
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        std::map<std::string, TimerResultsData> results = timerResults.getResults();
+        ASSERT_EQUALS(1, results["sleep"].mNumberOfResults);
+        ASSERT(results["sleep"].wallSeconds() >= 0.05);
+        // a sleeping thread does not use CPU time
+        ASSERT(results["sleep"].seconds() < 0.05);
+    }
+
+    void traceEvents() const {
+        TimerResults timerResults;
+        {
+            Timer t1("file \"a.c\"", SHOWTIME_MODES::SHOWTIME_TRACE, &timerResults);
+            Timer t2("Tokenizer", SHOWTIME_MODES::SHOWTIME_TRACE, &timerResults);
+        }
+        std::thread([&timerResults]() {
+            Timer t("runChecks", SHOWTIME_MODES::SHOWTIME_TRACE, &timerResults);
+        }).join();
+        ASSERT_EQUALS(0, timerResults.getResults().size());
+
+        std::istringstream events(timerResults.getTraceEvents());
+        std::string event;
+        ASSERT(static_cast<bool>(std::getline(events, event)));
+        ASSERT_EQUALS(0, event.find("{\"name\":\"Tokenizer\",\"ph\":\"X\",\"ts\":"));
+        ASSERT(event.find(",\"tid\":1}") != std::string::npos);
+        ASSERT(static_cast<bool>(std::getline(events, event)));
+        ASSERT_EQUALS(0, event.find("{\"name\":\"file \\\"a.c\\\"\",\"ph\":\"X\",\"ts\":"));
+        ASSERT(event.find(",\"tid\":1}") != std::string::npos);
+        ASSERT(static_cast<bool>(std::getline(events, event)));
+        ASSERT_EQUALS(0, event.find("{\"name\":\"runChecks\",\"ph\":\"X\",\"ts\":"));
+        ASSERT(event.find(",\"tid\":2}") != std::string::npos);
+        ASSERT(!std::getline(events, event));
+
+        timerResults.reset();
+        ASSERT_EQUALS("", timerResults.getTraceEvents());
+    }
+
+    void writeTrace() const {
+        std::ostringstream out1;
+        TimerResults::writeTrace(out1, "");
+        ASSERT_EQUALS("{\"traceEvents\":[\n\n],\"displayTimeUnit\":\"ms\"}\n", out1.str());
+
+        std::ostringstream out2;
+        TimerResults::writeTrace(out2, "{\"name\":\"a\"}\n{\"name\":\"b\"}\n");
+        ASSERT_EQUALS("{\"traceEvents\":[\n{\"name\":\"a\"},\n{\"name\":\"b\"}\n],\"displayTimeUnit\":\"ms\"}\n", out2.str());
     }
 };
 
@@ -21,13 +21,50 @@
 #include "standards.h"
 #include "token.h"
 #include "tokenlist.h"
+#include "tokenmatch.h"
+#include "tokenstrings.h"
 #include "vfvalue.h"
 
 #include <algorithm>
+#include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 
+namespace {
+    constexpr char ifWhileFor[] = "if|while|for (";
+    constexpr char nameParen[] = "%name% (";
+    constexpr char separator[] = ":|;|,";
+    constexpr char conditionOp[] = "&&|%oror%|?|!";
+    constexpr char parenSemicolon[] = ")|;";
+    constexpr char nameScope[] = "%name%|::";
+    constexpr char varCall[] = "%var% (|{";
+    constexpr char openChars[] = "[{([]";
+    constexpr char closeChars[] = "[})]]";
+    constexpr char optionalParen[] = "%name% )| (";
+    constexpr char declaration[] = "%type% %var% [,)]";
+    constexpr char assignValue[] = "%var% %assign% %num%|%str%|%bool%|%char% ;";
+    constexpr char anyOp[] = "%comp%|%cop%|%op%";
+    constexpr char bitOr[] = "%or%";
+    constexpr char notElse[] = "!!else";
+    constexpr char braceNotElse[] = "} !!else";
+    constexpr char ifParen[] = "if (";
+    constexpr char returnAny[] = "return|throw %any%";
+    constexpr char optionalType[] = "int|char|";
+    constexpr char optionalTypeName[] = "int|char| %name%";
+    constexpr char assignVar[] = ";|{|} %var% =";
+    constexpr char optionalXY[] = "x|y|";
+    constexpr char stlString[] = "std :: string|wstring !!::";
+    constexpr char optionalName[] = "%name% %name%| %var%";
+    constexpr char pipeChar[] = "[|]";
+    constexpr char emptyAlternative[] = "a||b";
+    constexpr char pipes[] = "||";
+    constexpr char notNot[] = "!!";
+
+    constexpr char varidEq[] = "%varid% ==";
+}
+
 class TestToken : public TestFixture {
 public:
     TestToken() : TestFixture("TestToken") {
@@ -64,6 +101,7 @@ private:
         TEST_CASE(getStrSize);
         TEST_CASE(strValue);
         TEST_CASE(concatStr);
+        TEST_CASE(strId);
 
         TEST_CASE(deleteLast);
         TEST_CASE(deleteFirst);
@@ -83,6 +121,7 @@ private:
         TEST_CASE(matchOr);
         TEST_CASE(matchOp);
         TEST_CASE(matchConstOp);
+        TEST_CASE(matchPattern);
 
         TEST_CASE(isArithmeticalOp);
         TEST_CASE(isOp);
@@ -114,6 +153,11 @@ private:
         TEST_CASE(expressionString);
 
         TEST_CASE(hasKnownIntValue);
+        TEST_CASE(valueCount);
+        TEST_CASE(noPossibleValues);
+        TEST_CASE(valueArena);
+        TEST_CASE(valueArenaThreads);
+        TEST_CASE(coldData);
     }
 
     void nextprevious() const {
@@ -545,6 +589,42 @@ private:
         ASSERT(tok.isUtf8());
     }
 
+    void strId() const {
+        static_assert(TokenStrings::fixedId("if", 0, 2) != 0, "");
+        static_assert(TokenStrings::fixedId("x if", 2, 4) == TokenStrings::fixedId("if", 0, 2), "");
+        static_assert(TokenStrings::fixedId("iff", 0, 3) == 0, "");
+
+        ASSERT(TokenStrings::fixedId("if") != 0);
+        ASSERT_EQUALS(TokenStrings::fixedId("if", 0, 2), TokenStrings::fixedId("if"));
+        ASSERT_EQUALS(TokenStrings::fixedId("(", 0, 1), TokenStrings::fixedId("("));
+        ASSERT_EQUALS(0, TokenStrings::fixedId("abc"));
+        ASSERT_EQUALS(0, TokenStrings::fixedId(""));
+        ASSERT_EQUALS(0, TokenStrings::fixedId(std::string(100, 'x')));
+
+        TokensFrontBack tokensFrontBack(list);
+        Token tok(tokensFrontBack);
+        tok.str("if");
+        ASSERT_EQUALS(TokenStrings::fixedId("if"), tok.strId());
+        ASSERT(tok.isControlFlowKeyword());
+
+        tok.str("abc");
+        ASSERT_EQUALS(0, tok.strId());
+        ASSERT(!tok.isControlFlowKeyword());
+
+        tok.str("\"a\"");
+        tok.concatStr("\"b\"");
+        ASSERT_EQUALS(0, tok.strId());
+
+        tok.str("return");
+        tok.insertToken("(");
+        tok.swapWithNext();
+        ASSERT_EQUALS(TokenStrings::fixedId("("), tok.strId());
+        ASSERT_EQUALS(TokenStrings::fixedId("return"), tok.next()->strId());
+        ASSERT(!tok.isControlFlowKeyword());
+        ASSERT(tok.next()->isControlFlowKeyword());
+        tok.deleteNext();
+    }
+
     void deleteLast() const {
         TokensFrontBack listEnds(list);
         Token ** const tokensBack = &(listEnds.back);
@@ -843,6 +923,57 @@ private:
         }
     }
 
+    template<const char* pattern>
+    void checkMatchPattern(const Token* tokens) {
+        for (const Token* tok = tokens; tok; tok = tok->next())
+            ASSERT_EQUALS_MSG(Token::Match(tok, pattern), Token::Match<pattern>(tok), std::string(pattern) + " at " + tok->str());
+    }
+
+    void matchPattern() {
+        const SimpleTokenizer tokenizer(*this, "int f(int x, char *s) {\n"
+                                        "    if (x == 0 || x > 1) { x |= 2; return sizeof(x); }\n"
+                                        "    while (s && *s == 'a') ++s;\n"
+                                        "    std::string str = \"abc\";\n"
+                                        "    bool b = true;\n"
+                                        "    for (;;) { if (x) break; else continue; }\n"
+                                        "    return x | 1;\n"
+                                        "}");
+        const Token* tokens = tokenizer.tokens();
+
+        checkMatchPattern<ifWhileFor>(tokens);
+        checkMatchPattern<nameParen>(tokens);
+        checkMatchPattern<separator>(tokens);
+        checkMatchPattern<conditionOp>(tokens);
+        checkMatchPattern<parenSemicolon>(tokens);
+        checkMatchPattern<nameScope>(tokens);
+        checkMatchPattern<varCall>(tokens);
+        checkMatchPattern<openChars>(tokens);
+        checkMatchPattern<closeChars>(tokens);
+        checkMatchPattern<optionalParen>(tokens);
+        checkMatchPattern<declaration>(tokens);
+        checkMatchPattern<assignValue>(tokens);
+        checkMatchPattern<anyOp>(tokens);
+        checkMatchPattern<bitOr>(tokens);
+        checkMatchPattern<notElse>(tokens);
+        checkMatchPattern<braceNotElse>(tokens);
+        checkMatchPattern<ifParen>(tokens);
+        checkMatchPattern<returnAny>(tokens);
+        checkMatchPattern<optionalType>(tokens);
+        checkMatchPattern<optionalTypeName>(tokens);
+        checkMatchPattern<assignVar>(tokens);
+        checkMatchPattern<optionalXY>(tokens);
+        checkMatchPattern<stlString>(tokens);
+        checkMatchPattern<optionalName>(tokens);
+        checkMatchPattern<pipeChar>(tokens);
+        checkMatchPattern<emptyAlternative>(tokens);
+        checkMatchPattern<pipes>(tokens);
+        checkMatchPattern<notNot>(tokens);
+
+        const Token* x = Token::findsimplematch(tokens, "x ==");
+        ASSERT_EQUALS(true, Token::Match<varidEq>(x, x->varId()));
+        ASSERT_EQUALS(false, Token::Match<varidEq>(x->next(), x->varId()));
+        ASSERT_THROW_INTERNAL(Token::Match<varidEq>(x), INTERNAL);
+    }
 
     void isArithmeticalOp() const {
         std::vector<std::string>::const_iterator test_op, test_ops_end = arithmeticalOps.cend();
@@ -1238,6 +1369,153 @@ private:
         ASSERT_EQUALS(true, token.addValue(v2));
         ASSERT_EQUALS(false, token.hasKnownIntValue());
     }
+
+    void valueCount() const {
+        TokensFrontBack tokensFrontBack(list);
+        auto *token = new Token(tokensFrontBack);
+        token->str("x");
+        Token *token2 = token->insertToken("y");
+        ASSERT_EQUALS(0U, tokensFrontBack.values);
+
+        ASSERT_EQUALS(true, token->addValue(ValueFlow::Value(1)));
+        ASSERT_EQUALS(true, token->addValue(ValueFlow::Value(2)));
+        ASSERT_EQUALS(true, token2->addValue(ValueFlow::Value(3)));
+        ASSERT_EQUALS(3U, tokensFrontBack.values);
+
+        // the same value is not added twice
+        ASSERT_EQUALS(false, token->addValue(ValueFlow::Value(1)));
+        ASSERT_EQUALS(3U, tokensFrontBack.values);
+
+        // a known value replaces the other values
+        ValueFlow::Value known(4);
+        known.setKnown();
+        ASSERT_EQUALS(true, token->addValue(known));
+        ASSERT_EQUALS(2U, tokensFrontBack.values);
+
+        token2->removeValues([](const ValueFlow::Value&) {
+            return true;
+        });
+        ASSERT_EQUALS(1U, tokensFrontBack.values);
+        token2->addValue(ValueFlow::Value(5));
+        token->deleteNext();
+        ASSERT_EQUALS(1U, tokensFrontBack.values);
+        token->clearValueFlow();
+        ASSERT_EQUALS(0U, tokensFrontBack.values);
+
+        TokenList::deleteTokens(token);
+    }
+
+    void noPossibleValues() const {
+        TokensFrontBack tokensFrontBack(list);
+        auto *token = new Token(tokensFrontBack);
+        token->str("x");
+        ValueFlow::Value possible(1);
+        possible.setPossible();
+        ValueFlow::Value known(2);
+        known.setKnown();
+
+        tokensFrontBack.possibleValues = false;
+        ASSERT_EQUALS(false, token->addValue(possible));
+        ASSERT_EQUALS(true, token->addValue(known));
+        ASSERT_EQUALS(1U, token->values().size());
+        ASSERT_EQUALS(1U, tokensFrontBack.values);
+
+        TokenList::deleteTokens(token);
+    }
+
+    void valueArena() const {
+        TokensFrontBack tokensFrontBack(list);
+        const ValueFlow::ValueArena& arena = tokensFrontBack.valueArena;
+        auto *token = new Token(tokensFrontBack);
+        token->str("x");
+        ASSERT_EQUALS(0U, arena.allocated());
+
+        // the values of the token are allocated in the arena
+        ASSERT_EQUALS(true, token->addValue(ValueFlow::Value(1)));
+        ASSERT_EQUALS(true, token->addValue(ValueFlow::Value(2)));
+        const std::size_t allocated = arena.allocated();
+        ASSERT(allocated >= 2 * sizeof(ValueFlow::Value));
+        ASSERT_EQUALS(64U * 1024U, arena.reserved());
+
+        // copies of the values are not allocated in the arena
+        {
+            const ValueFlow::ValueList values = token->values();
+            ASSERT_EQUALS(2U, values.size());
+            ASSERT_EQUALS(allocated, arena.allocated());
+        }
+
+        // released memory is reused
+        token->removeValues([](const ValueFlow::Value& v) {
+            return v.intvalue == 1;
+        });
+        ASSERT(arena.allocated() < allocated);
+        ASSERT_EQUALS(true, token->addValue(ValueFlow::Value(3)));
+        ASSERT_EQUALS(allocated, arena.allocated());
+        ASSERT_EQUALS(64U * 1024U, arena.reserved());
+
+        token->clearValueFlow();
+        ASSERT_EQUALS(0U, arena.allocated());
+
+        TokenList::deleteTokens(token);
+    }
+
+    void valueArenaThreads() const {
+        TokensFrontBack tokensFrontBack(list);
+        const ValueFlow::ValueArena& arena = tokensFrontBack.valueArena;
+        auto *token = new Token(tokensFrontBack);
+        token->str("x");
+
+        // the values are allocated from the blocks of the thread that adds them
+        bool added = false;
+        std::thread([token, &added]() {
+            added = token->addValue(ValueFlow::Value(1));
+        }).join();
+        ASSERT_EQUALS(true, added);
+        ASSERT(arena.allocated() >= sizeof(ValueFlow::Value));
+        ASSERT_EQUALS(64U * 1024U, arena.reserved());
+
+        // the values can be released by another thread which then reuses the memory
+        token->clearValueFlow();
+        ASSERT_EQUALS(0U, arena.allocated());
+        ASSERT_EQUALS(true, token->addValue(ValueFlow::Value(2)));
+        ASSERT(arena.allocated() >= sizeof(ValueFlow::Value));
+        ASSERT_EQUALS(64U * 1024U, arena.reserved());
+
+        TokenList::deleteTokens(token);
+    }
+
+    void coldData() const {
+        TokensFrontBack tokensFrontBack(list);
+        Token tok(tokensFrontBack);
+        tok.str("x");
+        ASSERT(!tok.mImpl->mCold);
+
+        // empty data does not allocate the cold data
+        tok.setMacroName("");
+        tok.scopeInfo(nullptr);
+        ASSERT(!tok.mImpl->mCold);
+        ASSERT_EQUALS(false, tok.isExpandedMacro());
+        ASSERT_EQUALS("", tok.originalName());
+
+        tok.setMacroName("MACRO");
+        ASSERT(!!tok.mImpl->mCold);
+        ASSERT_EQUALS(true, tok.isExpandedMacro());
+        ASSERT_EQUALS("MACRO", tok.getMacroName());
+
+        // the cold data is released when the scope information is cleared and nothing else is stored
+        Token tok2(tokensFrontBack);
+        tok2.str("y");
+        tok2.scopeInfo(std::make_shared<ScopeInfo2>("A", nullptr));
+        ASSERT(!!tok2.mImpl->mCold);
+        ASSERT_EQUALS("A", tok2.scopeInfo()->name);
+        tok2.scopeInfo(nullptr);
+        ASSERT(!tok2.mImpl->mCold);
+
+        tok.scopeInfo(std::make_shared<ScopeInfo2>("A", nullptr));
+        tok.scopeInfo(nullptr);
+        ASSERT(!!tok.mImpl->mCold);
+        ASSERT_EQUALS("MACRO", tok.getMacroName());
+    }
 };
 
 REGISTER_TEST(TestToken)
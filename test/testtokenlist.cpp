@@ -47,6 +47,7 @@ private:
         TEST_CASE(isKeyword);
         TEST_CASE(notokens);
         TEST_CASE(ast1);
+        TEST_CASE(memoryUsage);
     }
 
     // inspired by #5895
@@ -189,6 +190,21 @@ private:
         }
         tokenlist.createAst(); // do not crash
     }
+
+    void memoryUsage() const {
+        const std::size_t tokenSize = sizeof(Token) + sizeof(TokenImpl);
+        TokenList tokenlist(&settings);
+        ASSERT_EQUALS(0, tokenlist.memoryUsage());
+        std::istringstream istr("int x = 1;");
+        tokenlist.createTokens(istr, Standards::Language::C);
+        ASSERT_EQUALS(5 * tokenSize, tokenlist.memoryUsage());
+
+        // the removed tokens are not counted anymore
+        tokenlist.front()->deleteNext(2);
+        ASSERT_EQUALS(3 * tokenSize, tokenlist.memoryUsage());
+        tokenlist.deallocateTokens();
+        ASSERT_EQUALS(0, tokenlist.memoryUsage());
+    }
 };
 
 REGISTER_TEST(TestTokenList)
@@ -21,6 +21,7 @@
 #include "mathlib.h"
 #include "platform.h"
 #include "settings.h"
+#include "symboldatabase.h"
 #include "token.h"
 #include "tokenize.h"
 #include "vfvalue.h"
@@ -164,6 +165,9 @@ private:
         TEST_CASE(valueFlowBailoutIncompleteVar);
 
         TEST_CASE(performanceIfCount);
+        TEST_CASE(performanceMaxMemory);
+
+        TEST_CASE(jobs);
     }
 
     static bool isNotTokValue(const ValueFlow::Value &val) {
@@ -488,15 +492,15 @@ private:
     }
 
 #define tokenValues(...) tokenValues_(__FILE__, __LINE__, __VA_ARGS__)
-    std::list<ValueFlow::Value> tokenValues_(const char* file, int line, const char code[], const char tokstr[], const Settings *s = nullptr) {
+    ValueFlow::ValueList tokenValues_(const char* file, int line, const char code[], const char tokstr[], const Settings *s = nullptr) {
         SimpleTokenizer tokenizer(s ? *s : settings, *this);
         ASSERT_LOC(tokenizer.tokenize(code), file, line);
         const Token *tok = Token::findmatch(tokenizer.tokens(), tokstr);
-        return tok ? tok->values() : std::list<ValueFlow::Value>();
+        return tok ? tok->values() : ValueFlow::ValueList();
     }
 
-    std::list<ValueFlow::Value> tokenValues_(const char* file, int line, const char code[], const char tokstr[], ValueFlow::Value::ValueType vt, const Settings *s = nullptr) {
-        std::list<ValueFlow::Value> values = tokenValues_(file, line, code, tokstr, s);
+    ValueFlow::ValueList tokenValues_(const char* file, int line, const char code[], const char tokstr[], ValueFlow::Value::ValueType vt, const Settings *s = nullptr) {
+        ValueFlow::ValueList values = tokenValues_(file, line, code, tokstr, s);
         values.remove_if([&](const ValueFlow::Value& v) {
             return v.valueType != vt;
         });
@@ -524,11 +528,11 @@ private:
 
 #define valueOfTok(code, tokstr) valueOfTok_(code, tokstr, __FILE__, __LINE__)
     ValueFlow::Value valueOfTok_(const char code[], const char tokstr[], const char* file, int line) {
-        std::list<ValueFlow::Value> values = removeImpossible(tokenValues_(file, line, code, tokstr));
+        ValueFlow::ValueList values = removeImpossible(tokenValues_(file, line, code, tokstr));
         return values.size() == 1U && !values.front().isTokValue() ? values.front() : ValueFlow::Value();
     }
 
-    static std::list<ValueFlow::Value> removeSymbolicTok(std::list<ValueFlow::Value> values)
+    static ValueFlow::ValueList removeSymbolicTok(ValueFlow::ValueList values)
     {
         values.remove_if([](const ValueFlow::Value& v) {
             return v.isSymbolicValue() || v.isTokValue();
@@ -536,7 +540,7 @@ private:
         return values;
     }
 
-    static std::list<ValueFlow::Value> removeImpossible(std::list<ValueFlow::Value> values)
+    static ValueFlow::ValueList removeImpossible(ValueFlow::ValueList values)
     {
         values.remove_if(std::mem_fn(&ValueFlow::Value::isImpossible));
         return values;
@@ -586,7 +590,7 @@ private:
 
     void valueFlowPointerAlias() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        ValueFlow::ValueList values;
 
         code  = "const char * f() {\n"
                 "    static const char *x;\n"
@@ -968,7 +972,7 @@ private:
                 "    if (x==2) {}\n"
                 "    if (x==4) {}\n"
                 "}";
-        std::list<ValueFlow::Value> values = tokenValues(code,"*");
+        ValueFlow::ValueList values = tokenValues(code,"*");
         ASSERT_EQUALS(2U, values.size());
         ASSERT_EQUALS(4, values.front().intvalue);
         ASSERT_EQUALS(16, values.back().intvalue);
@@ -1164,7 +1168,7 @@ private:
 
     void valueFlowSizeof() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        ValueFlow::ValueList values;
 
         // array size
         code  = "void f() {\n"
@@ -1503,7 +1507,7 @@ private:
     void valueFlowComma()
     {
         const char* code;
-        std::list<ValueFlow::Value> values;
+        ValueFlow::ValueList values;
 
         code = "void f(int i) {\n"
                "    int x = (i, 4);\n"
@@ -4098,7 +4102,7 @@ private:
 
     void valueFlowFwdAnalysis() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        ValueFlow::ValueList values;
 
         code = "void f() {\n"
                "  struct Foo foo;\n"
@@ -4483,7 +4487,7 @@ private:
                "    for (x = 0; x < 10; x++)\n"
                "        x;\n"
                "}";
-        std::list<ValueFlow::Value> values = tokenValues(code, "x <");
+        ValueFlow::ValueList values = tokenValues(code, "x <");
         ASSERT(std::none_of(values.cbegin(), values.cend(), std::mem_fn(&ValueFlow::Value::isUninitValue)));
 
         // #9637
@@ -5432,7 +5436,7 @@ private:
 
     void valueFlowUninit() {
         const char* code;
-        std::list<ValueFlow::Value> values;
+        ValueFlow::ValueList values;
 
         code = "void f() {\n"
                "    int x;\n"
@@ -5839,7 +5843,7 @@ private:
 
     void valueFlowConditionExpressions() {
         const char* code;
-        std::list<ValueFlow::Value> values;
+        ValueFlow::ValueList values;
 
         // opposite condition
         code = "void f(int i, int j) {\n"
@@ -6068,7 +6072,7 @@ private:
         ASSERT_EQUALS(true, testValueOfXKnown(code, 6U, 0));
     }
 
-    static std::string isPossibleContainerSizeValue(std::list<ValueFlow::Value> values,
+    static std::string isPossibleContainerSizeValue(ValueFlow::ValueList values,
                                                     MathLib::bigint i,
                                                     bool unique = true) {
         values.remove_if(std::mem_fn(&ValueFlow::Value::isSymbolicValue));
@@ -6086,7 +6090,7 @@ private:
         return "";
     }
 
-    static std::string isImpossibleContainerSizeValue(std::list<ValueFlow::Value> values,
+    static std::string isImpossibleContainerSizeValue(ValueFlow::ValueList values,
                                                       MathLib::bigint i,
                                                       bool unique = true) {
         values.remove_if(std::mem_fn(&ValueFlow::Value::isSymbolicValue));
@@ -6104,7 +6108,7 @@ private:
         return "";
     }
 
-    static std::string isInconclusiveContainerSizeValue(std::list<ValueFlow::Value> values,
+    static std::string isInconclusiveContainerSizeValue(ValueFlow::ValueList values,
                                                         MathLib::bigint i,
                                                         bool unique = true) {
         values.remove_if(std::mem_fn(&ValueFlow::Value::isSymbolicValue));
@@ -6122,7 +6126,7 @@ private:
         return "";
     }
 
-    static std::string isKnownContainerSizeValue(std::list<ValueFlow::Value> values, MathLib::bigint i, bool unique = true) {
+    static std::string isKnownContainerSizeValue(ValueFlow::ValueList values, MathLib::bigint i, bool unique = true) {
         values.remove_if(std::mem_fn(&ValueFlow::Value::isSymbolicValue));
         values.remove_if(std::mem_fn(&ValueFlow::Value::isTokValue));
         if (!unique)
@@ -7014,7 +7018,7 @@ private:
 
     void valueFlowSafeFunctionParameterValues() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        ValueFlow::ValueList values;
         /*const*/ Settings s = settingsBuilder().library("std.cfg").build();
         s.safeChecks.classes = s.safeChecks.externalFunctions = s.safeChecks.internalFunctions = true;
 
@@ -7065,7 +7069,7 @@ private:
 
     void valueFlowUnknownFunctionReturn() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        ValueFlow::ValueList values;
         /*const*/ Settings s = settingsBuilder().library("std.cfg").build();
         s.checkUnknownFunctionReturn.insert("rand");
 
@@ -7960,7 +7964,7 @@ private:
 
     void valueFlowIncDec() {
         const char *code;
-        std::list<ValueFlow::Value> values;
+        ValueFlow::ValueList values;
 
         // #11591
         code = "int f() {\n"
@@ -8612,6 +8616,83 @@ private:
                "}\n";
         ASSERT_EQUALS(1U, tokenValues(code, "v .", &s).size());
     }
+
+    void performanceMaxMemory() {
+        /*const*/ Settings s = settingsBuilder(settings).severity(Severity::information).build();
+
+        const char code[] = "int f(int x) {\n"
+                            "  int a = 14;\n"
+                            "  int b = 1;\n"
+                            "  if (x) { a = 2; }\n"
+                            "  return a+b;\n"
+                            "}\n";
+        ASSERT_EQUALS(2U, tokenValues(code, "a +").size());
+        ASSERT_EQUALS(1U, tokenValues(code, "b ; }").size());
+
+        // dropping the possible values is enough when the budget is just below the full usage
+        {
+            SimpleTokenizer tokenizer(settings, *this);
+            ASSERT(tokenizer.tokenize(code));
+            s.vfOptions.maxMemory = tokenizer.list.memoryUsage() + tokenizer.getSymbolDatabase()->memoryUsage() - 1;
+        }
+        ASSERT_EQUALS(0U, tokenValues(code, "a +", &s).size());
+        ASSERT_EQUALS("[test.cpp:0]: (information) Limiting ValueFlow analysis since the memory budget is exceeded, the possible values are dropped. Please increase --performance-valueflow-max-memory to perform full analysis.\n", errout_str());
+        ASSERT_EQUALS(1U, tokenValues(code, "b ; }", &s).size());
+        ASSERT_EQUALS("[test.cpp:0]: (information) Limiting ValueFlow analysis since the memory budget is exceeded, the possible values are dropped. Please increase --performance-valueflow-max-memory to perform full analysis.\n", errout_str());
+
+        // only the basic analysis is done
+        s.vfOptions.maxMemory = 1;
+        ASSERT_EQUALS(0U, tokenValues(code, "b ; }", &s).size());
+        ASSERT_EQUALS("[test.cpp:0]: (information) Limiting ValueFlow analysis since the memory budget is exceeded, the possible values are dropped. Please increase --performance-valueflow-max-memory to perform full analysis.\n"
+                      "[test.cpp:0]: (information) Limiting ValueFlow analysis since the memory budget is exceeded, the extended analysis is skipped. Please increase --performance-valueflow-max-memory to perform full analysis.\n", errout_str());
+        ASSERT_EQUALS(1U, tokenValues(code, "14", &s).size());
+        ASSERT_EQUALS("[test.cpp:0]: (information) Limiting ValueFlow analysis since the memory budget is exceeded, the possible values are dropped. Please increase --performance-valueflow-max-memory to perform full analysis.\n"
+                      "[test.cpp:0]: (information) Limiting ValueFlow analysis since the memory budget is exceeded, the extended analysis is skipped. Please increase --performance-valueflow-max-memory to perform full analysis.\n", errout_str());
+    }
+
+#define allTokenValues(...) allTokenValues_(__FILE__, __LINE__, __VA_ARGS__)
+    std::string allTokenValues_(const char* file, int line, const char code[], const Settings &s) {
+        SimpleTokenizer tokenizer(s, *this);
+        ASSERT_LOC(tokenizer.tokenize(code), file, line);
+        std::string ret;
+        for (const Token *tok = tokenizer.tokens(); tok; tok = tok->next()) {
+            ret += tok->str();
+            for (const ValueFlow::Value &v : tok->values())
+                ret += " " + v.toString();
+            ret += '\n';
+        }
+        return ret;
+    }
+
+    void jobs() {
+        const char code[] = "int g(int x) {\n"
+                            "  if (x == 1) { return 0; }\n"
+                            "  return x + 1;\n"
+                            "}\n"
+                            "void f1(int *p) {\n"
+                            "  int a = 0;\n"
+                            "  if (p) {}\n"
+                            "  *p = a + g(1);\n"
+                            "}\n"
+                            "int f2(std::vector<int> v) {\n"
+                            "  int i = 10;\n"
+                            "  if (v.empty()) { i = 2; }\n"
+                            "  return v[i];\n"
+                            "}\n"
+                            "struct S {\n"
+                            "  void f3() {\n"
+                            "    struct L { int h(int y) { return y > 2 ? y : 3; } };\n"
+                            "    int b = L().h(4);\n"
+                            "    std::swap(b, c);\n"
+                            "  }\n"
+                            "  int c;\n"
+                            "};\n";
+
+        /*const*/ Settings s(settings);
+        const std::string expected = allTokenValues(code, s);
+        s.vfOptions.jobs = 4;
+        ASSERT_EQUALS(expected, allTokenValues(code, s));
+    }
 };
 
 REGISTER_TEST(TestValueFlow)
@@ -461,6 +461,7 @@ int main(int argc, char **argv)
         libfiles_h.emplace_back(fname + ".h");
     }
     libfiles_h.emplace_back("analyzer.h");
+    libfiles_h.emplace_back("binarystream.h");
     libfiles_h.emplace_back("calculate.h");
     libfiles_h.emplace_back("config.h");
     libfiles_h.emplace_back("filesettings.h");
@@ -469,6 +470,8 @@ int main(int argc, char **argv)
     libfiles_h.emplace_back("precompiled.h");
     libfiles_h.emplace_back("smallvector.h");
     libfiles_h.emplace_back("standards.h");
+    libfiles_h.emplace_back("tokenmatch.h");
+    libfiles_h.emplace_back("tokenstrings.h");
     libfiles_h.emplace_back("tokenrange.h");
     libfiles_h.emplace_back("valueptr.h");
     libfiles_h.emplace_back("version.h");